@@ -30,6 +30,8 @@ namespace bn::hw::decompress
     {
         HuffUnComp(src, dst);
     }
+
+    BN_CODE_IWRAM void fast_lz(const void* src, void* dst);
 }
 
 #endif
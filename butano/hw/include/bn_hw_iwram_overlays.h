@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_IWRAM_OVERLAYS_H
+#define BN_HW_IWRAM_OVERLAYS_H
+
+#include "bn_common.h"
+
+// Provided by the devkitARM linker script (BN_IWRAM_OVERLAYS_SUPPORTED).
+// Weak, so toolchains without IWRAM overlays can still link:
+extern char __iwram_overlay_start[] __attribute__((weak));
+extern char __iwram_overlay_end[] __attribute__((weak));
+
+#define BN_HW_IWRAM_OVERLAY_SYMBOLS(index) \
+    extern char __load_start_iwram##index[] __attribute__((weak)); \
+    extern char __load_stop_iwram##index[] __attribute__((weak));
+
+BN_HW_IWRAM_OVERLAY_SYMBOLS(0)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(1)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(2)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(3)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(4)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(5)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(6)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(7)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(8)
+BN_HW_IWRAM_OVERLAY_SYMBOLS(9)
+
+#undef BN_HW_IWRAM_OVERLAY_SYMBOLS
+
+namespace bn::hw::iwram_overlays
+{
+    constexpr int count = 10;
+
+    [[nodiscard]] inline char* region_start()
+    {
+        return __iwram_overlay_start;
+    }
+
+    [[nodiscard]] inline int region_size()
+    {
+        return __iwram_overlay_end - __iwram_overlay_start;
+    }
+
+    [[nodiscard]] inline const char* load_start(int index)
+    {
+        const char* load_starts[] = {
+            __load_start_iwram0, __load_start_iwram1, __load_start_iwram2, __load_start_iwram3,
+            __load_start_iwram4, __load_start_iwram5, __load_start_iwram6, __load_start_iwram7,
+            __load_start_iwram8, __load_start_iwram9
+        };
+
+        return load_starts[index];
+    }
+
+    [[nodiscard]] inline int size(int index)
+    {
+        const char* load_stops[] = {
+            __load_stop_iwram0, __load_stop_iwram1, __load_stop_iwram2, __load_stop_iwram3,
+            __load_stop_iwram4, __load_stop_iwram5, __load_stop_iwram6, __load_stop_iwram7,
+            __load_stop_iwram8, __load_stop_iwram9
+        };
+
+        return load_stops[index] - load_start(index);
+    }
+}
+
+#endif
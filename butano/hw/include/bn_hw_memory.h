@@ -6,10 +6,16 @@
 #ifndef BN_HW_MEMORY_H
 #define BN_HW_MEMORY_H
 
+#include "bn_hw_dma.h"
 #include "bn_hw_tonc.h"
+#include "bn_config_memory.h"
 #include "../3rd_party/agbabi/include/aeabi.h"
 #include "../3rd_party/agbabi/include/agbabi.h"
 
+#if BN_CFG_MEMORY_DMA_COPY_MIN_BYTES
+    #include "bn_hw_audio.h"
+#endif
+
 extern unsigned BN_IWRAM_START;
 extern unsigned BN_IWRAM_TOP;
 extern unsigned BN_IWRAM_END;
@@ -80,6 +86,33 @@ namespace bn::hw::memory
         return memctrl_register == fast_ewram_memctrl_value;
     }
 
+    #if BN_CFG_MEMORY_DMA_COPY_MIN_BYTES
+        static_assert(audio::dma_channel_free(dma::low_priority_channel()),
+                      "DMA copies are not supported by the audio backend");
+
+        // Updated by bn::memory::set_dma_enabled:
+        inline bool dma_copy_enabled = true;
+    #endif
+
+    inline void set_dma_copy_enabled([[maybe_unused]] bool enabled)
+    {
+        #if BN_CFG_MEMORY_DMA_COPY_MIN_BYTES
+            dma_copy_enabled = enabled;
+        #endif
+    }
+
+    [[nodiscard]] inline bool dma_copy_allowed([[maybe_unused]] int elements, [[maybe_unused]] int element_size)
+    {
+        #if BN_CFG_MEMORY_DMA_COPY_MIN_BYTES
+            constexpr int dma_channel = dma::low_priority_channel();
+
+            return elements * element_size >= BN_CFG_MEMORY_DMA_COPY_MIN_BYTES && elements <= 0xFFFF &&
+                    dma_copy_enabled && ! (REG_DMA[dma_channel].cnt & DMA_ENABLE);
+        #else
+            return false;
+        #endif
+    }
+
     inline void copy_bytes(const void* source, int bytes, void* destination)
     {
         __aeabi_memcpy(destination, source, size_t(bytes));
@@ -87,12 +120,26 @@ namespace bn::hw::memory
 
     inline void copy_half_words(const void* source, int half_words, void* destination)
     {
-        __agbabi_memcpy2(destination, source, size_t(half_words) * 2);
+        if(dma_copy_allowed(half_words, 2))
+        {
+            dma::copy_half_words(source, half_words, destination);
+        }
+        else
+        {
+            __agbabi_memcpy2(destination, source, size_t(half_words) * 2);
+        }
     }
 
     inline void copy_words(const void* source, int words, void* destination)
     {
-        __aeabi_memcpy4(destination, source, size_t(words) * 4);
+        if(dma_copy_allowed(words, 4))
+        {
+            dma::copy_words(source, words, destination);
+        }
+        else
+        {
+            __aeabi_memcpy4(destination, source, size_t(words) * 4);
+        }
     }
 
     inline void copy_words_fiq(const void* source, int words, void* destination)
@@ -111,6 +158,11 @@ namespace bn::hw::memory
         __aeabi_memcpy4(destination, source, size_t(words) * 4);
     }
 
+    [[nodiscard]] inline int compare_bytes(const void* lhs, const void* rhs, int bytes)
+    {
+        return __builtin_memcmp(lhs, rhs, size_t(bytes));
+    }
+
     inline void set_bytes(uint8_t value, int bytes, void* destination)
     {
         __aeabi_memset(destination, size_t(bytes), int(value));
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_common.h"
+
+namespace
+{
+    // Returns the difference between the first different bytes of the given (little endian) words:
+    [[nodiscard]] int _words_diff(unsigned a_word, unsigned b_word)
+    {
+        unsigned diff = a_word ^ b_word;
+        int shift = 0;
+
+        if(! (diff & 0xFFFF))
+        {
+            shift = 16;
+            diff >>= 16;
+        }
+
+        if(! (diff & 0xFF))
+        {
+            shift += 8;
+        }
+
+        return int((a_word >> shift) & 0xFF) - int((b_word >> shift) & 0xFF);
+    }
+}
+
+extern "C"
+{
+
+int memcmp(const void* lhs, const void* rhs, size_t count)
+{
+    auto a = static_cast<const uint8_t*>(lhs);
+    auto b = static_cast<const uint8_t*>(rhs);
+
+    if(count >= 8) [[likely]]
+    {
+        uintptr_t alignment = uintptr_t(a) % 4;
+
+        if(alignment == uintptr_t(b) % 4) [[likely]]
+        {
+            if(alignment)
+            {
+                size_t head = 4 - alignment;
+                count -= head;
+
+                while(head)
+                {
+                    if(int result = int(*a) - int(*b))
+                    {
+                        return result;
+                    }
+
+                    ++a;
+                    ++b;
+                    --head;
+                }
+            }
+
+            auto a_words = reinterpret_cast<const unsigned*>(a);
+            auto b_words = reinterpret_cast<const unsigned*>(b);
+
+            while(count >= 8)
+            {
+                unsigned a_word_0 = a_words[0];
+                unsigned a_word_1 = a_words[1];
+                unsigned b_word_0 = b_words[0];
+                unsigned b_word_1 = b_words[1];
+
+                if(a_word_0 != b_word_0)
+                {
+                    return _words_diff(a_word_0, b_word_0);
+                }
+
+                if(a_word_1 != b_word_1)
+                {
+                    return _words_diff(a_word_1, b_word_1);
+                }
+
+                a_words += 2;
+                b_words += 2;
+                count -= 8;
+            }
+
+            if(count >= 4)
+            {
+                unsigned a_word = *a_words;
+                unsigned b_word = *b_words;
+
+                if(a_word != b_word)
+                {
+                    return _words_diff(a_word, b_word);
+                }
+
+                ++a_words;
+                ++b_words;
+                count -= 4;
+            }
+
+            a = reinterpret_cast<const uint8_t*>(a_words);
+            b = reinterpret_cast<const uint8_t*>(b_words);
+        }
+    }
+
+    while(count)
+    {
+        if(int result = int(*a) - int(*b))
+        {
+            return result;
+        }
+
+        ++a;
+        ++b;
+        --count;
+    }
+
+    return 0;
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_decompress.h"
+
+namespace bn::hw::decompress
+{
+
+// Fast LZ format:
+//
+// Header word: 0x40 | (decompressed bytes << 8).
+//
+// Each sequence starts with a control word followed by its literal words:
+// * Bits 0-7: literal words count.
+// * Bits 8-15: match words count.
+// * Bits 16-31: match offset in words.
+//
+// Since only words are read and written, decompression can target VRAM directly.
+void fast_lz(const void* src, void* dst)
+{
+    auto src_words = static_cast<const unsigned*>(src);
+    auto dst_words = static_cast<unsigned*>(dst);
+    unsigned* dst_end = dst_words + (*src_words >> 10);
+    ++src_words;
+
+    while(dst_words < dst_end)
+    {
+        unsigned control = *src_words;
+        ++src_words;
+
+        unsigned literals = control & 0xFF;
+
+        while(literals >= 4)
+        {
+            unsigned a = src_words[0];
+            unsigned b = src_words[1];
+            unsigned c = src_words[2];
+            unsigned d = src_words[3];
+            dst_words[0] = a;
+            dst_words[1] = b;
+            dst_words[2] = c;
+            dst_words[3] = d;
+            src_words += 4;
+            dst_words += 4;
+            literals -= 4;
+        }
+
+        while(literals)
+        {
+            *dst_words = *src_words;
+            ++src_words;
+            ++dst_words;
+            --literals;
+        }
+
+        unsigned matches = (control >> 8) & 0xFF;
+
+        if(matches)
+        {
+            // Matches can overlap the words being written, so they are copied one by one:
+            const unsigned* match_words = dst_words - (control >> 16);
+
+            while(matches)
+            {
+                *dst_words = *match_words;
+                ++match_words;
+                ++dst_words;
+                --matches;
+            }
+        }
+    }
+}
+
+}
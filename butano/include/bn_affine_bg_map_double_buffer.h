@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_AFFINE_BG_MAP_DOUBLE_BUFFER_H
+#define BN_AFFINE_BG_MAP_DOUBLE_BUFFER_H
+
+/**
+ * @file
+ * bn::affine_bg_map_double_buffer header file.
+ *
+ * @ingroup affine_bg
+ * @ingroup bg_map
+ */
+
+#include "bn_affine_bg_map_ptr.h"
+
+namespace bn
+{
+
+class affine_bg_ptr;
+
+/**
+ * @brief Pair of allocated affine background maps which allows to rewrite a map without tearing.
+ *
+ * The front map is displayed, while the back map can be modified at any time of the frame.
+ * When the back map is ready, flip displays it by changing the map used by an affine background,
+ * which takes effect in the next V-Blank.
+ *
+ * After a flip call, the new back map is still displayed until the next V-Blank,
+ * so it must not be modified until the next core::update call.
+ *
+ * Since map cells are not copied in V-Blank, map updates are not bounded by the V-Blank length.
+ *
+ * @ingroup affine_bg
+ * @ingroup bg_map
+ */
+class affine_bg_map_double_buffer
+{
+
+public:
+    /**
+     * @brief Allocates the front and back maps.
+     * @param dimensions Size in map cells of each map.
+     * @param tiles Referenced tiles of the maps.
+     * @param palette Referenced color palette of the maps.
+     * @return The requested affine_bg_map_double_buffer.
+     */
+    [[nodiscard]] static affine_bg_map_double_buffer allocate(
+            const size& dimensions, affine_bg_tiles_ptr tiles, bg_palette_ptr palette);
+
+    /**
+     * @brief Allocates the front and back maps.
+     * @param dimensions Size in map cells of each map.
+     * @param tiles Referenced tiles of the maps.
+     * @param palette Referenced color palette of the maps.
+     * @return The requested affine_bg_map_double_buffer if both maps can be allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<affine_bg_map_double_buffer> allocate_optional(
+            const size& dimensions, affine_bg_tiles_ptr tiles, bg_palette_ptr palette);
+
+    affine_bg_map_double_buffer(const affine_bg_map_double_buffer& other) = delete;
+
+    affine_bg_map_double_buffer& operator=(const affine_bg_map_double_buffer& other) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other affine_bg_map_double_buffer to move.
+     */
+    affine_bg_map_double_buffer(affine_bg_map_double_buffer&& other) noexcept = default;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other affine_bg_map_double_buffer to move.
+     * @return Reference to this.
+     */
+    affine_bg_map_double_buffer& operator=(affine_bg_map_double_buffer&& other) noexcept = default;
+
+    /**
+     * @brief Returns the map which should be displayed.
+     */
+    [[nodiscard]] const affine_bg_map_ptr& front_map() const
+    {
+        return _front_map;
+    }
+
+    /**
+     * @brief Returns the map which can be modified without tearing.
+     */
+    [[nodiscard]] const affine_bg_map_ptr& back_map() const
+    {
+        return _back_map;
+    }
+
+    /**
+     * @brief Returns the VRAM cells of the map which should be displayed.
+     */
+    [[nodiscard]] span<const affine_bg_map_cell> front_vram();
+
+    /**
+     * @brief Returns the VRAM cells of the map which can be modified without tearing.
+     *
+     * After a flip call, they are still displayed until the next V-Blank,
+     * so they should not be modified until the next core::update call.
+     */
+    [[nodiscard]] span<affine_bg_map_cell> back_vram();
+
+    /**
+     * @brief Copies the cells of the front map to the back map,
+     * so the back map can be updated incrementally after a flip.
+     *
+     * After a flip call, it must not be called until the next core::update call.
+     */
+    void copy_front_to_back();
+
+    /**
+     * @brief Displays the back map in the given affine background from the next V-Blank,
+     * and exchanges the front and back maps.
+     * @param bg Affine background which must be displaying the front map.
+     *
+     * The new back map is still displayed until the next V-Blank,
+     * so back_vram must not be written until the next core::update call. Otherwise, it tears.
+     */
+    void flip(affine_bg_ptr& bg);
+
+private:
+    affine_bg_map_ptr _front_map;
+    affine_bg_map_ptr _back_map;
+
+    affine_bg_map_double_buffer(affine_bg_map_ptr&& front_map, affine_bg_map_ptr&& back_map);
+};
+
+}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_BINARY_LOG_H
+#define BN_BINARY_LOG_H
+
+/**
+ * @file
+ * BN_BINARY_LOG header file.
+ *
+ * @ingroup log
+ */
+
+#include "bn_config_log.h"
+#include "bn_config_doxygen.h"
+
+/**
+ * @def BN_BINARY_LOG(format, ...)
+ *
+ * Stores the given format string and arguments in a ring buffer without formatting them,
+ * so it can be called inside hot loops.
+ *
+ * Stored records are printed as hexadecimal lines by bn::binary_log::flush,
+ * which is called by bn::core::update after measuring CPU usage and when an assert fails.
+ * Records longer than BN_CFG_LOG_MAX_SIZE are split in multiple lines.
+ *
+ * Printed lines can be decoded back to text with `butano/tools/butano_binary_log_tool.py`,
+ * which reads format strings from the ROM.
+ *
+ * The format string must be a string literal, with a `{}` placeholder per argument (like bn::format).
+ *
+ * Supported arguments are integers, enums, bn::fixed_t, `bool`, `char`, pointers and string literals.
+ *
+ * Example:
+ *
+ * @code{.cpp}
+ * BN_BINARY_LOG("Enemy {} position: ({}, {})", enemy_index, enemy_position.x(), enemy_position.y());
+ * @endcode
+ *
+ * @ingroup log
+ */
+
+#if BN_CFG_LOG_ENABLED || BN_DOXYGEN
+    #include "bn_fixed_fwd.h"
+    #include "bn_type_traits.h"
+
+    #define BN_BINARY_LOG(format, ...) \
+        _bn::binary_log::write(format __VA_OPT__(,) __VA_ARGS__)
+
+    /// @cond DO_NOT_DOCUMENT
+
+    namespace _bn::binary_log
+    {
+        enum class arg_type : uint8_t
+        {
+            INT,
+            UNSIGNED,
+            BOOL,
+            CHAR,
+            POINTER,
+            STRING,
+            INT64,
+            UNSIGNED64,
+            FIXED = 0x80
+        };
+
+        template<typename Type>
+        struct fixed_precision
+        {
+            static constexpr int value = -1;
+        };
+
+        template<int Precision>
+        struct fixed_precision<bn::fixed_t<Precision>>
+        {
+            static constexpr int value = Precision;
+        };
+
+        template<typename Type>
+        [[nodiscard]] constexpr uint8_t type_code()
+        {
+            if constexpr(bn::is_same_v<Type, bool>)
+            {
+                return uint8_t(arg_type::BOOL);
+            }
+            else if constexpr(bn::is_same_v<Type, char>)
+            {
+                return uint8_t(arg_type::CHAR);
+            }
+            else if constexpr(bn::is_same_v<Type, const char*> || bn::is_same_v<Type, char*>)
+            {
+                return uint8_t(arg_type::STRING);
+            }
+            else if constexpr(bn::is_pointer_v<Type> || bn::is_same_v<Type, decltype(nullptr)>)
+            {
+                return uint8_t(arg_type::POINTER);
+            }
+            else if constexpr(bn::is_enum_v<Type>)
+            {
+                return type_code<bn::underlying_type_t<Type>>();
+            }
+            else if constexpr(bn::is_integral_v<Type>)
+            {
+                if constexpr(sizeof(Type) > sizeof(int))
+                {
+                    return uint8_t(bn::is_signed_v<Type> ? arg_type::INT64 : arg_type::UNSIGNED64);
+                }
+                else
+                {
+                    return uint8_t(bn::is_signed_v<Type> ? arg_type::INT : arg_type::UNSIGNED);
+                }
+            }
+            else
+            {
+                static_assert(fixed_precision<Type>::value >= 0, "Unsupported binary log argument type");
+
+                return uint8_t(int(arg_type::FIXED) | fixed_precision<Type>::value);
+            }
+        }
+
+        template<typename... Args>
+        inline constexpr uint8_t types[] = { uint8_t(sizeof...(Args)), type_code<bn::decay_t<Args>>()... };
+
+        template<typename Type>
+        [[nodiscard]] constexpr int arg_words()
+        {
+            return type_code<Type>() == uint8_t(arg_type::INT64) ||
+                    type_code<Type>() == uint8_t(arg_type::UNSIGNED64) ? 2 : 1;
+        }
+
+        template<typename Type>
+        void put(unsigned*& output, const Type& value)
+        {
+            using decayed_type = bn::decay_t<Type>;
+
+            if constexpr(fixed_precision<decayed_type>::value >= 0)
+            {
+                *output++ = unsigned(value.data());
+            }
+            else if constexpr(arg_words<decayed_type>() == 2)
+            {
+                *output++ = unsigned(value);
+                *output++ = unsigned(uint64_t(value) >> 32);
+            }
+            else if constexpr(bn::is_pointer_v<decayed_type> || bn::is_same_v<decayed_type, decltype(nullptr)>)
+            {
+                *output++ = unsigned(reinterpret_cast<uintptr_t>(static_cast<const void*>(value)));
+            }
+            else
+            {
+                *output++ = unsigned(value);
+            }
+        }
+
+        void init();
+
+        void write_record(const unsigned* words, int words_count);
+
+        template<typename... Args>
+        void write(const char* format, const Args&... args)
+        {
+            constexpr int args_words = (0 + ... + arg_words<bn::decay_t<Args>>());
+            constexpr int record_words = args_words + 2;
+            static_assert(record_words <= 30, "Too many binary log arguments");
+
+            unsigned record[record_words];
+            record[0] = unsigned(reinterpret_cast<uintptr_t>(format));
+            record[1] = unsigned(reinterpret_cast<uintptr_t>(types<Args...>));
+
+            [[maybe_unused]] unsigned* output = record + 2;
+            (put(output, args), ...);
+            write_record(record, record_words);
+        }
+    }
+
+    /// @endcond
+
+    /**
+     * @brief Binary log related functions.
+     *
+     * @ingroup log
+     */
+    namespace bn::binary_log
+    {
+        /**
+         * @brief Prints all stored records.
+         */
+        void flush();
+
+        /**
+         * @brief Prints the oldest stored records.
+         * @param max_records Maximum number of records to print.
+         */
+        void flush(int max_records);
+
+        /**
+         * @brief Returns the number of bytes of the stored records.
+         */
+        [[nodiscard]] int used_bytes();
+
+        /**
+         * @brief Returns the number of records discarded because the ring buffer was full
+         * since the last flush.
+         */
+        [[nodiscard]] int dropped_records();
+    }
+#else
+    #define BN_BINARY_LOG(format, ...) \
+        do \
+        { \
+        } while(false)
+
+    namespace bn::binary_log
+    {
+        inline void flush()
+        {
+        }
+
+        inline void flush(int)
+        {
+        }
+
+        [[nodiscard]] inline int used_bytes()
+        {
+            return 0;
+        }
+
+        [[nodiscard]] inline int dropped_records()
+        {
+            return 0;
+        }
+    }
+#endif
+
+#endif
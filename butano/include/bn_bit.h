@@ -18,6 +18,8 @@
 
 namespace bn
 {
+    using std::bit_ceil;
+
     using std::has_single_bit;
 
     using std::popcount;
@@ -26,6 +26,12 @@ namespace bn
  *
  * The camera is released when the last remaining camera_ptr owning it is destroyed.
  *
+ * A parallax camera follows a parent camera: its position is the position of the parent camera
+ * multiplied by a parallax factor, so multiple background layers can be scrolled at different speeds
+ * by moving only the parent camera.
+ *
+ * Only the sprites, backgrounds and windows attached to a camera whose position has changed are updated.
+ *
  * @ingroup camera
  */
 class camera_ptr
@@ -74,6 +80,23 @@ public:
      */
     [[nodiscard]] static optional<camera_ptr> create_optional(const fixed_point& position);
 
+    /**
+     * @brief Creates a parallax camera_ptr.
+     * @param parent Camera followed by the new one. It can't be a parallax camera.
+     * @param parallax_factor Multiplies the position of the parent camera to obtain the position of the new one.
+     * @return The requested camera_ptr.
+     */
+    [[nodiscard]] static camera_ptr create_parallax(const camera_ptr& parent, const fixed_point& parallax_factor);
+
+    /**
+     * @brief Creates a parallax camera_ptr.
+     * @param parent Camera followed by the new one. It can't be a parallax camera.
+     * @param parallax_factor Multiplies the position of the parent camera to obtain the position of the new one.
+     * @return The requested camera_ptr if it could be allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<camera_ptr> create_parallax_optional(
+            const camera_ptr& parent, const fixed_point& parallax_factor);
+
     /**
      * @brief Copy constructor.
      * @param other camera_ptr to copy.
@@ -128,6 +151,8 @@ public:
 
     /**
      * @brief Sets the horizontal position of the camera.
+     *
+     * The camera can't be a parallax camera.
      */
     void set_x(fixed x);
 
@@ -138,6 +163,8 @@ public:
 
     /**
      * @brief Sets the vertical position of the camera.
+     *
+     * The camera can't be a parallax camera.
      */
     void set_y(fixed y);
 
@@ -150,14 +177,42 @@ public:
      * @brief Sets the position of the camera.
      * @param x Horizontal position of the camera.
      * @param y Vertical position of the camera.
+     *
+     * The camera can't be a parallax camera.
      */
     void set_position(fixed x, fixed y);
 
     /**
      * @brief Sets the position of the camera.
+     *
+     * The camera can't be a parallax camera.
      */
     void set_position(const fixed_point& position);
 
+    /**
+     * @brief Indicates if this camera follows a parent camera or not.
+     */
+    [[nodiscard]] bool parallax() const;
+
+    /**
+     * @brief Returns the camera followed by this one if it is a parallax camera; bn::nullopt otherwise.
+     */
+    [[nodiscard]] optional<camera_ptr> parent() const;
+
+    /**
+     * @brief Returns the factor which multiplies the position of the parent camera
+     * to obtain the position of this one.
+     */
+    [[nodiscard]] const fixed_point& parallax_factor() const;
+
+    /**
+     * @brief Sets the factor which multiplies the position of the parent camera
+     * to obtain the position of this one.
+     *
+     * The camera must be a parallax camera.
+     */
+    void set_parallax_factor(const fixed_point& parallax_factor);
+
     /**
      * @brief Exchanges the contents of this camera_ptr with those of the other one.
      * @param other camera_ptr to exchange the contents with.
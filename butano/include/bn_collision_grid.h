@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_COLLISION_GRID_H
+#define BN_COLLISION_GRID_H
+
+/**
+ * @file
+ * bn::icollision_grid and bn::collision_grid implementation header file.
+ *
+ * @ingroup math
+ */
+
+#include "bn_bit.h"
+#include "bn_fixed_rect.h"
+#include "bn_top_left_fixed_rect.h"
+
+namespace bn
+{
+
+/**
+ * @brief Base class of bn::collision_grid.
+ *
+ * It's a broad-phase collision detection structure: items are stored in the cells of an unbounded uniform grid
+ * indexed with a hash table, so only the items stored near a rectangle are tested against it.
+ *
+ * Each item is stored only in the cell that contains its center point,
+ * so moving an item is cheap, specially if it doesn't change of cell.
+ *
+ * Two rectangles intersect if there is at least one point that is within both rectangles, excluding their edges.
+ *
+ * @ingroup math
+ */
+class icollision_grid
+{
+
+public:
+    using size_type = int; //!< Size type alias.
+
+    icollision_grid(const icollision_grid& other) = delete;
+
+    icollision_grid& operator=(const icollision_grid& other) = delete;
+
+    /**
+     * @brief Returns the current items count.
+     */
+    [[nodiscard]] size_type size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the maximum possible items count.
+     */
+    [[nodiscard]] size_type max_size() const
+    {
+        return _max_size;
+    }
+
+    /**
+     * @brief Indicates if it doesn't contain any item.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Indicates if it can't contain any more items.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _size == _max_size;
+    }
+
+    /**
+     * @brief Returns the width and height in pixels of each cell.
+     */
+    [[nodiscard]] int cell_size() const
+    {
+        return 1 << _cell_size_shift;
+    }
+
+    /**
+     * @brief Indicates if the given item ID is valid or not.
+     */
+    [[nodiscard]] bool contains(int id) const
+    {
+        return id >= 0 && id < _max_size && _items[id].bucket >= 0;
+    }
+
+    /**
+     * @brief Returns the rectangle of the item with the given ID.
+     */
+    [[nodiscard]] top_left_fixed_rect rect(int id) const;
+
+    /**
+     * @brief Inserts a new item.
+     * @param rect Rectangle of the new item.
+     * @return ID of the new item.
+     */
+    int insert(const fixed_rect& rect)
+    {
+        return _insert(rect.left().data(), rect.top().data(), rect.right().data(), rect.bottom().data());
+    }
+
+    /**
+     * @brief Inserts a new item.
+     * @param rect Rectangle of the new item.
+     * @return ID of the new item.
+     */
+    int insert(const top_left_fixed_rect& rect)
+    {
+        return _insert(rect.left().data(), rect.top().data(), rect.right().data(), rect.bottom().data());
+    }
+
+    /**
+     * @brief Sets the rectangle of the item with the given ID.
+     * @param id ID of the item to update.
+     * @param rect New rectangle of the item.
+     */
+    void update(int id, const fixed_rect& rect)
+    {
+        _update(id, rect.left().data(), rect.top().data(), rect.right().data(), rect.bottom().data());
+    }
+
+    /**
+     * @brief Sets the rectangle of the item with the given ID.
+     * @param id ID of the item to update.
+     * @param rect New rectangle of the item.
+     */
+    void update(int id, const top_left_fixed_rect& rect)
+    {
+        _update(id, rect.left().data(), rect.top().data(), rect.right().data(), rect.bottom().data());
+    }
+
+    /**
+     * @brief Removes the item with the given ID.
+     */
+    void erase(int id);
+
+    /**
+     * @brief Removes all items.
+     */
+    void clear();
+
+    /**
+     * @brief Calls the given function with the ID of each item which intersects with the given rectangle.
+     */
+    template<typename Function>
+    void for_each_intersection(const fixed_rect& rect, Function&& function) const
+    {
+        _for_each_intersection(rect.left().data(), rect.top().data(), rect.right().data(), rect.bottom().data(),
+                               -1, function);
+    }
+
+    /**
+     * @brief Calls the given function with the ID of each item which intersects with the given rectangle.
+     */
+    template<typename Function>
+    void for_each_intersection(const top_left_fixed_rect& rect, Function&& function) const
+    {
+        _for_each_intersection(rect.left().data(), rect.top().data(), rect.right().data(), rect.bottom().data(),
+                               -1, function);
+    }
+
+    /**
+     * @brief Calls the given function with the IDs of each pair of items which intersect.
+     *
+     * Each pair is reported only once, with the lower ID first.
+     */
+    template<typename Function>
+    void for_each_pair(Function&& function) const
+    {
+        const item_type* items = _items;
+
+        for(int id = 0, limit = _max_size; id < limit; ++id)
+        {
+            const item_type& item = items[id];
+
+            if(item.bucket >= 0)
+            {
+                auto pair_function = [&function, id](int other_id)
+                {
+                    function(id, other_id);
+                };
+
+                _for_each_intersection(item.left, item.top, item.right, item.bottom, id, pair_function);
+            }
+        }
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    class item_type
+    {
+
+    public:
+        int left;
+        int top;
+        int right;
+        int bottom;
+        int cell_x;
+        int cell_y;
+        int16_t previous;
+        int16_t next;
+        int16_t bucket;
+    };
+
+    icollision_grid(item_type* items, int16_t* buckets, int max_size, int buckets_count, int cell_size_shift);
+
+    /// @endcond
+
+private:
+    item_type* _items;
+    int16_t* _buckets;
+    int _max_size;
+    int _buckets_count;
+    int _cell_size_shift;
+    int _size = 0;
+    int _free_id = 0;
+    int _max_half_width = 0;
+    int _max_half_height = 0;
+
+    [[nodiscard]] int _bucket(int cell_x, int cell_y) const
+    {
+        unsigned hash = (unsigned(cell_x) * 0x9E3779B1u) ^ (unsigned(cell_y) * 0x85EBCA77u);
+        return int((hash ^ (hash >> 16)) & unsigned(_buckets_count - 1));
+    }
+
+    [[nodiscard]] int _insert(int left, int top, int right, int bottom);
+
+    void _update(int id, int left, int top, int right, int bottom);
+
+    void _update_max_half_size(int left, int top, int right, int bottom);
+
+    void _link(int id);
+
+    void _unlink(int id);
+
+    template<typename Function>
+    void _for_each_intersection(int left, int top, int right, int bottom, int min_id, Function& function) const
+    {
+        int precision = fixed::precision();
+        int cell_size_shift = _cell_size_shift;
+        int first_cell_x = ((left >> precision) - _max_half_width) >> cell_size_shift;
+        int last_cell_x = (((right + fixed::scale() - 1) >> precision) + _max_half_width) >> cell_size_shift;
+        int first_cell_y = ((top >> precision) - _max_half_height) >> cell_size_shift;
+        int last_cell_y = (((bottom + fixed::scale() - 1) >> precision) + _max_half_height) >> cell_size_shift;
+        const item_type* items = _items;
+
+        if((last_cell_x - first_cell_x + 1) * (last_cell_y - first_cell_y + 1) > _buckets_count) [[unlikely]]
+        {
+            for(int id = min_id + 1, limit = _max_size; id < limit; ++id)
+            {
+                const item_type& item = items[id];
+
+                if(item.bucket >= 0 && item.left < right && item.right > left && item.top < bottom &&
+                        item.bottom > top)
+                {
+                    function(id);
+                }
+            }
+
+            return;
+        }
+
+        const int16_t* buckets = _buckets;
+
+        for(int cell_y = first_cell_y; cell_y <= last_cell_y; ++cell_y)
+        {
+            for(int cell_x = first_cell_x; cell_x <= last_cell_x; ++cell_x)
+            {
+                for(int id = buckets[_bucket(cell_x, cell_y)]; id >= 0; )
+                {
+                    const item_type& item = items[id];
+
+                    if(id > min_id && item.cell_x == cell_x && item.cell_y == cell_y &&
+                            item.left < right && item.right > left && item.top < bottom && item.bottom > top)
+                    {
+                        function(id);
+                    }
+
+                    id = item.next;
+                }
+            }
+        }
+    }
+};
+
+
+/**
+ * @brief Uniform grid broad-phase collision detection structure with a fixed number of items.
+ *
+ * @tparam MaxItems Maximum number of items.
+ * @tparam CellSize Width and height in pixels of each cell (it must be a power of two greater than or equal to 8).
+ *
+ * @ingroup math
+ */
+template<int MaxItems, int CellSize>
+class collision_grid : public icollision_grid
+{
+    static_assert(MaxItems > 0 && MaxItems <= 8192);
+    static_assert(CellSize >= 8 && has_single_bit(unsigned(CellSize)));
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    collision_grid() :
+        icollision_grid(_items_array, _buckets_array, MaxItems, _buckets_count, popcount(unsigned(CellSize - 1)))
+    {
+    }
+
+private:
+    static constexpr int _buckets_count = int(bit_ceil(unsigned(MaxItems < 8 ? 16 : MaxItems * 2)));
+
+    item_type _items_array[MaxItems];
+    int16_t _buckets_array[_buckets_count];
+};
+
+}
+
+#endif
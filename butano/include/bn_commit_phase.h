@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_COMMIT_PHASE_H
+#define BN_COMMIT_PHASE_H
+
+/**
+ * @file
+ * bn::commit_phase header file.
+ *
+ * @ingroup core
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+
+/**
+ * @brief Specifies the phases in which the GBA display components are updated in V-Blank by bn::core::update.
+ *
+ * If they don't fit in the commit budget, sprite phases (sprite tiles, sprite palettes and OAM)
+ * or background phases (background tiles and maps, background palettes and registers)
+ * can be deferred to the next V-Blank as a whole.
+ *
+ * @ingroup core
+ */
+enum class commit_phase : uint8_t
+{
+    SPRITES, //!< Sprites attributes and affine matrices (OAM).
+    PALETTES, //!< Sprite and background palettes.
+    SPRITE_TILES, //!< Uncompressed sprite tiles.
+    BIG_MAPS, //!< Big background maps rows and columns.
+    BG_BLOCKS, //!< Uncompressed background tiles and maps.
+    COMPRESSED //!< Compressed sprite tiles, background tiles and maps.
+};
+
+}
+
+#endif
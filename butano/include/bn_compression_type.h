@@ -28,7 +28,8 @@ enum class compression_type : uint8_t
     NONE, //!< Uncompressed data.
     LZ77, //!< LZ77 compressed data.
     RUN_LENGTH, //!< Run-length compressed data.
-    HUFFMAN //!< Huffman compressed data.
+    HUFFMAN, //!< Huffman compressed data.
+    FAST_LZ //!< LZ compressed data with word granularity, faster to decompress than the other compressions.
 };
 
 }
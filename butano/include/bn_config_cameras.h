@@ -18,12 +18,15 @@
 /**
  * @def BN_CFG_CAMERA_MAX_ITEMS
  *
- * Specifies the maximum number of cameras that can be created with bn::camera_ptr static constructors.
+ * Specifies the maximum number of cameras that can be created with bn::camera_ptr static constructors,
+ * including parallax cameras.
+ *
+ * It must be in the range [1..32].
  *
  * @ingroup camera
  */
 #ifndef BN_CFG_CAMERA_MAX_ITEMS
-    #define BN_CFG_CAMERA_MAX_ITEMS 4
+    #define BN_CFG_CAMERA_MAX_ITEMS 16
 #endif
 
 #endif
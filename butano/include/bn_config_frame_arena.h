@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_FRAME_ARENA_H
+#define BN_CONFIG_FRAME_ARENA_H
+
+/**
+ * @file
+ * Frame arena configuration header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_FRAME_ARENA_EWRAM_SIZE
+ *
+ * Specifies the size in bytes of the EWRAM frame arena.
+ *
+ * It is disabled (`0`) by default, so games which don't use it don't lose any EWRAM.
+ *
+ * It must be a multiple of 4.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_FRAME_ARENA_EWRAM_SIZE
+    #define BN_CFG_FRAME_ARENA_EWRAM_SIZE 0
+#endif
+
+/**
+ * @def BN_CFG_FRAME_ARENA_IWRAM_SIZE
+ *
+ * Specifies the size in bytes of the IWRAM frame arena.
+ *
+ * It is taken from the 32KB of IWRAM shared with the stack, so it is disabled (`0`) by default.
+ *
+ * It must be a multiple of 4.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_FRAME_ARENA_IWRAM_SIZE
+    #define BN_CFG_FRAME_ARENA_IWRAM_SIZE 0
+#endif
+
+static_assert(BN_CFG_FRAME_ARENA_EWRAM_SIZE >= 0 && BN_CFG_FRAME_ARENA_EWRAM_SIZE % 4 == 0);
+static_assert(BN_CFG_FRAME_ARENA_IWRAM_SIZE >= 0 && BN_CFG_FRAME_ARENA_IWRAM_SIZE % 4 == 0);
+
+#endif
@@ -52,4 +52,35 @@
 
 static_assert(BN_CFG_LOG_MAX_SIZE >= 16);
 
+/**
+ * @def BN_CFG_LOG_BINARY_BUFFER_SIZE
+ *
+ * Specifies the size in bytes of the EWRAM ring buffer used by BN_BINARY_LOG.
+ *
+ * It must be a power of two.
+ *
+ * @ingroup log
+ */
+#ifndef BN_CFG_LOG_BINARY_BUFFER_SIZE
+    #define BN_CFG_LOG_BINARY_BUFFER_SIZE 2048
+#endif
+
+static_assert(BN_CFG_LOG_BINARY_BUFFER_SIZE >= 128);
+static_assert((BN_CFG_LOG_BINARY_BUFFER_SIZE & (BN_CFG_LOG_BINARY_BUFFER_SIZE - 1)) == 0);
+
+/**
+ * @def BN_CFG_LOG_BINARY_FLUSH_MAX_RECORDS
+ *
+ * Specifies the maximum number of BN_BINARY_LOG records printed by each bn::core::update call.
+ *
+ * It must be greater than 0.
+ *
+ * @ingroup log
+ */
+#ifndef BN_CFG_LOG_BINARY_FLUSH_MAX_RECORDS
+    #define BN_CFG_LOG_BINARY_FLUSH_MAX_RECORDS 16
+#endif
+
+static_assert(BN_CFG_LOG_BINARY_FLUSH_MAX_RECORDS > 0);
+
 #endif
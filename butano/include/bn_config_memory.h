@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_MEMORY_H
+#define BN_CONFIG_MEMORY_H
+
+/**
+ * @file
+ * Memory configuration header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_ewram_allocator.h"
+
+/**
+ * @def BN_CFG_MEMORY_EWRAM_ALLOCATOR
+ *
+ * Specifies the allocator used to manage the EWRAM heap.
+ *
+ * bn::best_fit_allocator wastes less memory,
+ * while bn::tlsf_allocator allocations and deallocations take constant time.
+ *
+ * Values not specified in BN_EWRAM_ALLOCATOR_* macros are not allowed.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_MEMORY_EWRAM_ALLOCATOR
+    #define BN_CFG_MEMORY_EWRAM_ALLOCATOR BN_EWRAM_ALLOCATOR_BEST_FIT
+#endif
+
+/**
+ * @def BN_CFG_MEMORY_IWRAM_HEAP_SIZE
+ *
+ * Specifies the size in bytes of the IWRAM heap managed by bn::memory::iwram_alloc and such.
+ *
+ * It is taken from the 32KB of IWRAM shared with the stack, so it is disabled by default.
+ *
+ * It must be a multiple of 4.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_MEMORY_IWRAM_HEAP_SIZE
+    #define BN_CFG_MEMORY_IWRAM_HEAP_SIZE 0
+#endif
+
+/**
+ * @def BN_CFG_MEMORY_DMA_COPY_MIN_BYTES
+ *
+ * Specifies the minimum size in bytes of the word and half word copies performed with DMA instead of with the CPU.
+ *
+ * Copies are still performed with the CPU if the DMA channel is busy (for example, with bn::hdma)
+ * or if DMA is disabled with bn::memory::set_dma_enabled.
+ *
+ * It is not supported by audio backends which use the same DMA channel, like AAS.
+ *
+ * Interrupts are not handled while a DMA copy is in progress, so they can delay H-Blank effects
+ * and audio updates. Because of that, it is disabled (`0`) by default.
+ *
+ * The best value depends on the source and destination memory regions,
+ * and it can be measured with the `tests/benchmarks` project.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_MEMORY_DMA_COPY_MIN_BYTES
+    #define BN_CFG_MEMORY_DMA_COPY_MIN_BYTES 0
+#endif
+
+static_assert(BN_CFG_MEMORY_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_BEST_FIT ||
+              BN_CFG_MEMORY_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_TLSF);
+static_assert(BN_CFG_MEMORY_IWRAM_HEAP_SIZE >= 0 && BN_CFG_MEMORY_IWRAM_HEAP_SIZE % 4 == 0);
+static_assert(BN_CFG_MEMORY_DMA_COPY_MIN_BYTES >= 0);
+
+#endif
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_TELEMETRY_H
+#define BN_CONFIG_TELEMETRY_H
+
+/**
+ * @file
+ * Telemetry configuration header file.
+ *
+ * @ingroup profiler
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_TELEMETRY_ENABLED
+ *
+ * Specifies if telemetry counters are sampled or not.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_TELEMETRY_ENABLED
+    #define BN_CFG_TELEMETRY_ENABLED false
+#endif
+
+/**
+ * @def BN_CFG_TELEMETRY_MAX_SAMPLES
+ *
+ * Specifies the maximum number of frames that can be stored by the telemetry ring buffer.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_TELEMETRY_MAX_SAMPLES
+    #define BN_CFG_TELEMETRY_MAX_SAMPLES 60
+#endif
+
+static_assert(BN_CFG_TELEMETRY_MAX_SAMPLES > 0);
+
+#endif
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_TLSF_ALLOCATOR_H
+#define BN_CONFIG_TLSF_ALLOCATOR_H
+
+/**
+ * @file
+ * bn::tlsf_allocator configuration header file.
+ *
+ * @ingroup allocator
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED
+ *
+ * Specifies if bn::tlsf_allocator sanity check is enabled or not.
+ *
+ * Sanity check asserts if the internal state of the allocator is valid.
+ *
+ * @ingroup allocator
+ */
+#ifndef BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED
+    #define BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED false
+#endif
+
+/**
+ * @def BN_CFG_TLSF_ALLOCATOR_FREE_CHECK_ENABLED
+ *
+ * Specifies if bn::tlsf_allocator::free checks if the input pointer is valid or not.
+ *
+ * @ingroup allocator
+ */
+#ifndef BN_CFG_TLSF_ALLOCATOR_FREE_CHECK_ENABLED
+    #define BN_CFG_TLSF_ALLOCATOR_FREE_CHECK_ENABLED false
+#endif
+
+#endif
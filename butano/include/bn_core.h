@@ -23,6 +23,7 @@ namespace bn
 {
     class color;
     class system_font;
+    enum class commit_phase : uint8_t;
 }
 
 namespace bn::keypad
@@ -165,6 +166,86 @@ namespace bn::core
      */
     [[nodiscard]] int last_missed_frames();
 
+    /**
+     * @brief Indicates if commit phases which don't fit in the commit budget are deferred to the next V-Blank or not.
+     *
+     * Sprite uploads are deferred with the sprites attributes (OAM), the sprite palettes and the display registers,
+     * and background uploads are deferred with the backgrounds registers, the background palettes
+     * and the display registers.
+     *
+     * Nothing is deferred if something was deferred in the last V-Blank.
+     */
+    [[nodiscard]] bool commit_budget_enabled();
+
+    /**
+     * @brief Sets if commit phases which don't fit in the commit budget are deferred to the next V-Blank or not.
+     *
+     * Sprite uploads are deferred with the sprites attributes (OAM), the sprite palettes and the display registers,
+     * and background uploads are deferred with the backgrounds registers, the background palettes
+     * and the display registers.
+     * This way the screen keeps showing the last committed frame instead of mixing old and new graphics,
+     * but H-Blank effects and HDMA transfers are always committed.
+     *
+     * Nothing is deferred if something was deferred in the last V-Blank.
+     *
+     * It is disabled by default, since deferred graphics are displayed one frame late.
+     */
+    void set_commit_budget_enabled(bool enabled);
+
+    /**
+     * @brief Returns the V-Blank timer ticks available to commit phases before they are deferred.
+     */
+    [[nodiscard]] int commit_budget_ticks();
+
+    /**
+     * @brief Sets the V-Blank timer ticks available to commit phases before they are deferred.
+     *
+     * By default it is timers::ticks_per_vblank().
+     * It can be reduced to leave room for the V-Blank callback, for example.
+     */
+    void set_commit_budget_ticks(int commit_budget_ticks);
+
+    /**
+     * @brief Indicates if any commit phase was deferred to the next V-Blank in the last core::update call.
+     */
+    [[nodiscard]] bool last_commit_deferred();
+
+    /**
+     * @brief Indicates if the given commit phase was deferred to the next V-Blank in the last core::update call.
+     */
+    [[nodiscard]] bool last_commit_deferred(commit_phase phase);
+
+    /**
+     * @brief Returns the estimated timer ticks of the given commit phase in the last core::update call.
+     *
+     * It is estimated from the number of bytes to copy or to decompress.
+     */
+    [[nodiscard]] int last_commit_estimated_ticks(commit_phase phase);
+
+    /**
+     * @brief Returns the elapsed timer ticks of the given commit phase in the last core::update call.
+     */
+    [[nodiscard]] int last_commit_ticks(commit_phase phase);
+
+    /**
+     * @brief Returns the number of bytes copied or decompressed by the given commit phase
+     * in the last core::update call.
+     *
+     * If the commit phase was deferred, it returns 0.
+     */
+    [[nodiscard]] int last_commit_bytes(commit_phase phase);
+
+    /**
+     * @brief Returns the number of V-Blank periods in which GBA display components were updated
+     * after the screen began to be redrawn.
+     */
+    [[nodiscard]] int vblank_overruns();
+
+    /**
+     * @brief Sets the V-Blank overruns counter to zero.
+     */
+    void reset_vblank_overruns();
+
     /**
      * @brief Returns the user function called in V-Blank.
      */
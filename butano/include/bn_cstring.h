@@ -45,6 +45,18 @@ namespace bn
      * @ingroup std
      */
     void memclear(void* destination, int bytes);
+
+    /**
+     * @brief Compares the given bytes of the objects pointed to by lhs and rhs.
+     * @param lhs Pointer to the first memory location to compare.
+     * @param rhs Pointer to the second memory location to compare.
+     * @param bytes Number of bytes to compare.
+     * @return Negative value if the first different byte (as unsigned) in lhs is less than the one in rhs,
+     * `0` if all bytes are equal, and positive value otherwise.
+     *
+     * @ingroup std
+     */
+    [[nodiscard]] int memcmp(const void* lhs, const void* rhs, int bytes);
 }
 
 #endif
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_EWRAM_ALLOCATOR_H
+#define BN_EWRAM_ALLOCATOR_H
+
+/**
+ * @file
+ * Available EWRAM heap allocators header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_EWRAM_ALLOCATOR_BEST_FIT
+ *
+ * EWRAM heap managed by bn::best_fit_allocator.
+ *
+ * @ingroup memory
+ */
+#define BN_EWRAM_ALLOCATOR_BEST_FIT    0
+
+/**
+ * @def BN_EWRAM_ALLOCATOR_TLSF
+ *
+ * EWRAM heap managed by bn::tlsf_allocator.
+ *
+ * @ingroup memory
+ */
+#define BN_EWRAM_ALLOCATOR_TLSF        1
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FORMAT_TO_H
+#define BN_FORMAT_TO_H
+
+/**
+ * @file
+ * bn::format_to header file.
+ *
+ * @ingroup string
+ */
+
+#include "bn_span.h"
+#include "bn_fixed.h"
+
+/// @cond DO_NOT_DOCUMENT
+
+namespace _bn::format_to
+{
+    [[nodiscard]] int integer(bn::span<char> output, unsigned value, bool negative, int width, char fill);
+
+    [[nodiscard]] int integer(bn::span<char> output, uint64_t value, bool negative, int width, char fill);
+
+    [[nodiscard]] int fixed(bn::span<char> output, int data, int precision, int decimals, int width, char fill);
+}
+
+/// @endcond
+
+
+namespace bn
+{
+
+/**
+ * @brief Writes the character representation of the given int value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ *
+ * It is faster than bn::to_string and bn::ostringstream, so it is suited for HUD texts updated in each frame:
+ *
+ * @code{.cpp}
+ * char buffer[8];
+ * int size = bn::format_to(buffer, score, 6, '0');
+ * text_generator.generate(x, y, bn::string_view(buffer, size), text_sprites);
+ * @endcode
+ *
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * If it is `'0'`, padding is added after the sign.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+[[nodiscard]] inline int format_to(span<char> output, int value, int width = 0, char fill = ' ')
+{
+    bool negative = value < 0;
+    unsigned abs_value = negative ? 0U - unsigned(value) : unsigned(value);
+    return _bn::format_to::integer(output, abs_value, negative, width, fill);
+}
+
+/**
+ * @brief Writes the character representation of the given long value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * If it is `'0'`, padding is added after the sign.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+[[nodiscard]] inline int format_to(span<char> output, long value, int width = 0, char fill = ' ')
+{
+    bool negative = value < 0;
+    uint64_t abs_value = negative ? 0U - uint64_t(value) : uint64_t(value);
+    return _bn::format_to::integer(output, abs_value, negative, width, fill);
+}
+
+/**
+ * @brief Writes the character representation of the given int64_t value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * If it is `'0'`, padding is added after the sign.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+[[nodiscard]] inline int format_to(span<char> output, int64_t value, int width = 0, char fill = ' ')
+{
+    bool negative = value < 0;
+    uint64_t abs_value = negative ? 0U - uint64_t(value) : uint64_t(value);
+    return _bn::format_to::integer(output, abs_value, negative, width, fill);
+}
+
+/**
+ * @brief Writes the character representation of the given unsigned value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+[[nodiscard]] inline int format_to(span<char> output, unsigned value, int width = 0, char fill = ' ')
+{
+    return _bn::format_to::integer(output, value, false, width, fill);
+}
+
+/**
+ * @brief Writes the character representation of the given unsigned long value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+[[nodiscard]] inline int format_to(span<char> output, unsigned long value, int width = 0, char fill = ' ')
+{
+    return _bn::format_to::integer(output, uint64_t(value), false, width, fill);
+}
+
+/**
+ * @brief Writes the character representation of the given uint64_t value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+[[nodiscard]] inline int format_to(span<char> output, uint64_t value, int width = 0, char fill = ' ')
+{
+    return _bn::format_to::integer(output, value, false, width, fill);
+}
+
+/**
+ * @brief Writes the character representation of the given fixed point value to the given characters,
+ * without allocating memory nor adding a null terminator.
+ *
+ * The fractional part is truncated, not rounded.
+ *
+ * @param output Destination characters.
+ * @param value Value to write.
+ * @param decimals Number of fractional digits to write, in the range [0..9].
+ * @param width Minimum number of characters to write.
+ * If the representation of the value is shorter, it is right-aligned by adding fill characters at its left.
+ * @param fill Character used to pad the representation of the value.
+ * If it is `'0'`, padding is added after the sign.
+ * @return Number of written characters.
+ *
+ * @ingroup string
+ */
+template<int Precision>
+[[nodiscard]] int format_to(span<char> output, fixed_t<Precision> value, int decimals, int width = 0,
+                            char fill = ' ')
+{
+    return _bn::format_to::fixed(output, value.data(), Precision, decimals, width, fill);
+}
+
+}
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FRAME_ARENA_H
+#define BN_FRAME_ARENA_H
+
+/**
+ * @file
+ * bn::frame_arena header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_span.h"
+#include "bn_type_traits.h"
+
+/**
+ * @brief Linear allocators for temporary data which is released at the end of each frame.
+ *
+ * Allocating memory from them only increases a pointer, and all allocated memory is released
+ * at the end of each bn::core::update call.
+ *
+ * Memory can also be released before the end of the frame with bn::scoped_scratch.
+ *
+ * Their sizes are specified by @ref BN_CFG_FRAME_ARENA_EWRAM_SIZE and @ref BN_CFG_FRAME_ARENA_IWRAM_SIZE.
+ * Both of them are disabled by default.
+ *
+ * @ingroup memory
+ */
+namespace bn::frame_arena
+{
+    /**
+     * @brief Allocates uninitialized storage in the EWRAM frame arena.
+     * @param bytes Bytes to allocate.
+     * @return Pointer to the beginning of newly allocated memory, aligned to 4 bytes.
+     *
+     * It is valid until the end of the current bn::core::update call.
+     */
+    [[nodiscard]] void* ewram_alloc(int bytes);
+
+    /**
+     * @brief Allocates uninitialized storage in the EWRAM frame arena for an array of trivial objects.
+     * @param count Number of objects.
+     * @return Span pointing to the newly allocated objects.
+     *
+     * It is valid until the end of the current bn::core::update call.
+     */
+    template<typename Type>
+    [[nodiscard]] span<Type> ewram_alloc_array(int count)
+    {
+        static_assert(is_trivially_destructible_v<Type>);
+        static_assert(alignof(Type) <= alignof(int));
+
+        return span<Type>(static_cast<Type*>(ewram_alloc(count * int(sizeof(Type)))), count);
+    }
+
+    /**
+     * @brief Returns the number of bytes currently allocated in the EWRAM frame arena.
+     */
+    [[nodiscard]] int used_ewram();
+
+    /**
+     * @brief Returns the number of bytes that can still be allocated in the EWRAM frame arena.
+     */
+    [[nodiscard]] int available_ewram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the EWRAM frame arena during the current frame.
+     */
+    [[nodiscard]] int frame_peak_ewram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the EWRAM frame arena during the last frame.
+     */
+    [[nodiscard]] int last_frame_peak_ewram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the EWRAM frame arena since bn::core::init
+     * or bn::frame_arena::reset_peaks was called.
+     */
+    [[nodiscard]] int peak_ewram();
+
+    /**
+     * @brief Allocates uninitialized storage in the IWRAM frame arena.
+     * @param bytes Bytes to allocate.
+     * @return Pointer to the beginning of newly allocated memory, aligned to 4 bytes.
+     *
+     * It is valid until the end of the current bn::core::update call.
+     */
+    [[nodiscard]] void* iwram_alloc(int bytes);
+
+    /**
+     * @brief Allocates uninitialized storage in the IWRAM frame arena for an array of trivial objects.
+     * @param count Number of objects.
+     * @return Span pointing to the newly allocated objects.
+     *
+     * It is valid until the end of the current bn::core::update call.
+     */
+    template<typename Type>
+    [[nodiscard]] span<Type> iwram_alloc_array(int count)
+    {
+        static_assert(is_trivially_destructible_v<Type>);
+        static_assert(alignof(Type) <= alignof(int));
+
+        return span<Type>(static_cast<Type*>(iwram_alloc(count * int(sizeof(Type)))), count);
+    }
+
+    /**
+     * @brief Returns the number of bytes currently allocated in the IWRAM frame arena.
+     */
+    [[nodiscard]] int used_iwram();
+
+    /**
+     * @brief Returns the number of bytes that can still be allocated in the IWRAM frame arena.
+     */
+    [[nodiscard]] int available_iwram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the IWRAM frame arena during the current frame.
+     */
+    [[nodiscard]] int frame_peak_iwram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the IWRAM frame arena during the last frame.
+     */
+    [[nodiscard]] int last_frame_peak_iwram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the IWRAM frame arena since bn::core::init
+     * or bn::frame_arena::reset_peaks was called.
+     */
+    [[nodiscard]] int peak_iwram();
+
+    /**
+     * @brief Resets the values returned by bn::frame_arena::peak_ewram and bn::frame_arena::peak_iwram
+     * to the current usage.
+     */
+    void reset_peaks();
+}
+
+#endif
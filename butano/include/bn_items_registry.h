@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_ITEMS_REGISTRY_H
+#define BN_ITEMS_REGISTRY_H
+
+/**
+ * @file
+ * bn::items_registry_entry header file.
+ *
+ * @ingroup tool
+ */
+
+#include "bn_span.h"
+#include "bn_string_view.h"
+
+namespace bn
+{
+
+/**
+ * @brief Maps the name of an item generated by the assets conversion tools to its index in an items registry.
+ *
+ * The assets conversion tools generate a registry in the build folder for all sprite items
+ * (`bn_sprite_registry.h`) and for all regular background items (`bn_regular_bg_registry.h`),
+ * and another one for each `registry_group` field (`bn_sprite_registry_<group>.h`, etc).
+ *
+ * Each registry contains an `id` enum, a `constexpr` array of pointers to the items indexed by it,
+ * and a `constexpr` array of items_registry_entry objects sorted by name hash.
+ *
+ * @ingroup tool
+ */
+class items_registry_entry
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param name_hash Hash of the item name, calculated with bn::hash<string_view>.
+     * @param name Item name.
+     * @param index Item index in its registry.
+     */
+    constexpr items_registry_entry(unsigned name_hash, const string_view& name, int index) :
+        _name_hash(name_hash),
+        _name(name),
+        _index(index)
+    {
+        BN_ASSERT(index >= 0, "Invalid index: ", index);
+    }
+
+    /**
+     * @brief Returns the hash of the item name, calculated with bn::hash<string_view>.
+     */
+    [[nodiscard]] constexpr unsigned name_hash() const
+    {
+        return _name_hash;
+    }
+
+    /**
+     * @brief Returns the item name.
+     */
+    [[nodiscard]] constexpr const string_view& name() const
+    {
+        return _name;
+    }
+
+    /**
+     * @brief Returns the item index in its registry.
+     */
+    [[nodiscard]] constexpr int index() const
+    {
+        return _index;
+    }
+
+private:
+    unsigned _name_hash;
+    string_view _name;
+    int _index;
+};
+
+
+/**
+ * @brief Searches an item by name in the given registry entries with a binary search.
+ * @param entries Registry entries sorted by name hash.
+ * @param name Name of the item to search.
+ * @return Index of the item in its registry if it has been found; -1 otherwise.
+ *
+ * @ingroup tool
+ */
+[[nodiscard]] int items_registry_find(const span<const items_registry_entry>& entries, const string_view& name);
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_IWRAM_OVERLAYS_H
+#define BN_IWRAM_OVERLAYS_H
+
+/**
+ * @file
+ * bn::iwram_overlays header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_optional.h"
+
+/**
+ * @def BN_CODE_IWRAM_OVERLAY(index)
+ *
+ * @brief Stores code or data in the IWRAM overlay indicated by index, in the range [0..9].
+ *
+ * Functions stored in an overlay must be defined in a file with extension `.bn_iwram.cpp`,
+ * and they can be called only while their overlay is loaded (see bn::iwram_overlays::load).
+ *
+ * If the toolchain doesn't support IWRAM overlays, they are stored in static IWRAM instead
+ * (like with `BN_CODE_IWRAM`).
+ *
+ * @ingroup memory
+ */
+#ifdef BN_IWRAM_OVERLAYS_SUPPORTED
+    #define BN_CODE_IWRAM_OVERLAY(index) __attribute__((section(".iwram" #index)))
+#else
+    #define BN_CODE_IWRAM_OVERLAY(index) BN_CODE_IWRAM
+#endif
+
+/**
+ * @brief IWRAM overlays related functions.
+ *
+ * An overlay is a group of functions and data stored in ROM and copied on demand to an IWRAM region
+ * shared by all overlays, so each scene can keep its own hot loops in fast memory
+ * without increasing static IWRAM usage for the others.
+ *
+ * Only one overlay can be loaded at a time.
+ *
+ * IWRAM overlays are provided by the devkitARM linker script.
+ * With other toolchains, overlay code is stored in static IWRAM and all overlays are empty.
+ *
+ * @ingroup memory
+ */
+namespace bn::iwram_overlays
+{
+    /**
+     * @brief Indicates if the toolchain supports IWRAM overlays or not.
+     */
+    [[nodiscard]] constexpr bool supported()
+    {
+        #ifdef BN_IWRAM_OVERLAYS_SUPPORTED
+            return true;
+        #else
+            return false;
+        #endif
+    }
+
+    /**
+     * @brief Returns the number of available overlays.
+     */
+    [[nodiscard]] constexpr int count()
+    {
+        return 10;
+    }
+
+    /**
+     * @brief Returns the size in bytes of the overlay indicated by index.
+     */
+    [[nodiscard]] int size(int index);
+
+    /**
+     * @brief Returns the size in bytes of the IWRAM region shared by all overlays.
+     */
+    [[nodiscard]] int region_size();
+
+    /**
+     * @brief Returns the index of the currently loaded overlay, if any.
+     */
+    [[nodiscard]] optional<int> loaded();
+
+    /**
+     * @brief Copies the overlay indicated by index from ROM to IWRAM,
+     * replacing the currently loaded one (if any).
+     *
+     * If the overlay is already loaded, this function does nothing.
+     */
+    void load(int index);
+
+    /**
+     * @brief Marks the currently loaded overlay (if any) as unloaded.
+     *
+     * Its IWRAM region is not cleared.
+     */
+    void unload();
+}
+
+#endif
@@ -120,6 +120,78 @@ namespace bn::memory
      */
     void log_alloc_ewram_status();
 
+    /**
+     * @brief Allocates uninitialized storage in the IWRAM heap.
+     * @param bytes Bytes to allocate.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     *
+     * The IWRAM heap size is specified by @ref BN_CFG_MEMORY_IWRAM_HEAP_SIZE.
+     *
+     * To avoid a memory leak, the returned pointer must be deallocated with bn::memory::iwram_free.
+     */
+    [[nodiscard]] void* iwram_alloc(int bytes);
+
+    /**
+     * @brief Allocates storage in the IWRAM heap for an array of num objects of bytes size
+     * and initializes all bytes in it to zero.
+     * @param num Number of objects.
+     * @param bytes Size in bytes of each object.
+     * @return On success, returns the pointer to the beginning of newly allocated memory.
+     * On failure, returns `nullptr`.
+     *
+     * To avoid a memory leak, the returned pointer must be deallocated with bn::memory::iwram_free.
+     */
+    [[nodiscard]] void* iwram_calloc(int num, int bytes);
+
+    /**
+     * @brief Reallocates the given storage in the IWRAM heap.
+     * @param ptr Pointer to the storage to reallocate.
+     *
+     * If ptr was not previously allocated by bn::memory::iwram_alloc, bn::memory::iwram_calloc or
+     * bn::memory::iwram_realloc, the behavior is undefined.
+     *
+     * @param new_bytes New size in bytes of the reallocated storage.
+     * @return On success, returns the pointer to the beginning of newly allocated storage.
+     * On failure, returns `nullptr`.
+     *
+     * On success, the original pointer ptr is invalidated and any access to it is undefined behavior
+     * (even if reallocation was in-place).
+     *
+     * To avoid a memory leak, the returned pointer must be deallocated with bn::memory::iwram_free.
+     */
+    [[nodiscard]] void* iwram_realloc(void* ptr, int new_bytes);
+
+    /**
+     * @brief Deallocates the storage previously allocated by bn::memory::iwram_alloc,
+     * bn::memory::iwram_calloc or bn::memory::iwram_realloc.
+     * @param ptr Pointer to the storage to deallocate.
+     * It is invalidated and any access to it is undefined behavior.
+     *
+     * If ptr is `nullptr`, the function does nothing.
+     *
+     * If ptr was not previously allocated by bn::memory::iwram_alloc, bn::memory::iwram_calloc or
+     * bn::memory::iwram_realloc, the behavior is undefined.
+     */
+    void iwram_free(void* ptr);
+
+    /**
+     * @brief Returns the size in bytes of all allocated items in the IWRAM heap with bn::memory::iwram_alloc,
+     * bn::memory::iwram_calloc and bn::memory::iwram_realloc.
+     */
+    [[nodiscard]] int used_alloc_iwram();
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated in the IWRAM heap
+     * with bn::memory::iwram_alloc, bn::memory::iwram_calloc and bn::memory::iwram_realloc.
+     */
+    [[nodiscard]] int available_alloc_iwram();
+
+    /**
+     * @brief Logs the current status of the IWRAM allocator.
+     */
+    void log_alloc_iwram_status();
+
     /**
      * @brief Returns the number of bytes of IWRAM used by the stack.
      */
@@ -127,9 +199,16 @@ namespace bn::memory
 
     /**
      * @brief Returns the size in bytes of all static objects in IWRAM.
+     *
+     * It includes the IWRAM heap, but not the region reserved for IWRAM overlays.
      */
     [[nodiscard]] int used_static_iwram();
 
+    /**
+     * @brief Returns the size in bytes of the IWRAM region reserved for overlays (see bn::iwram_overlays).
+     */
+    [[nodiscard]] int used_overlays_iwram();
+
     /**
      * @brief Returns the size in bytes of all static objects in EWRAM.
      */
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_PARTICLE_SYSTEM_H
+#define BN_PARTICLE_SYSTEM_H
+
+/**
+ * @file
+ * bn::iparticle_system and bn::particle_system implementation header file.
+ *
+ * @ingroup sprite
+ */
+
+#include "bn_fixed_point.h"
+#include "bn_camera_ptr.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_shape_size.h"
+#include "bn_sprite_palette_ptr.h"
+#include "../hw/include/bn_hw_sprites_constants.h"
+
+namespace bn
+{
+
+class sprite_item;
+
+/**
+ * @brief Base class of bn::particle_system.
+ *
+ * Particles are stored as a structure of arrays and they are drawn as regular sprites
+ * written directly to a range of the hardware sprite handles reserved with bn::sprites::set_reserved_handles_count,
+ * so they don't use any sprite item of the sprites manager.
+ *
+ * All particles share the same tiles, color palette and shape and size.
+ *
+ * @ingroup sprite
+ */
+class iparticle_system
+{
+
+public:
+    using size_type = int; //!< Size type alias.
+
+    iparticle_system(const iparticle_system& other) = delete;
+
+    iparticle_system& operator=(const iparticle_system& other) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * It hides the hardware sprite handles used by the particles.
+     */
+    ~iparticle_system();
+
+    /**
+     * @brief Returns the current particles count.
+     */
+    [[nodiscard]] size_type size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the maximum possible particles count.
+     */
+    [[nodiscard]] size_type max_size() const
+    {
+        return _max_size;
+    }
+
+    /**
+     * @brief Returns the remaining particles capacity.
+     */
+    [[nodiscard]] size_type available() const
+    {
+        return _max_size - _size;
+    }
+
+    /**
+     * @brief Indicates if it doesn't contain any particle.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Indicates if it can't contain any more particles.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _size == _max_size;
+    }
+
+    /**
+     * @brief Returns the index of the first reserved hardware sprite handle used by the particles.
+     */
+    [[nodiscard]] int first_handle_index() const
+    {
+        return _first_handle_index;
+    }
+
+    /**
+     * @brief Returns the shape and size of the particle sprites.
+     */
+    [[nodiscard]] const sprite_shape_size& shape_size() const
+    {
+        return _shape_size;
+    }
+
+    /**
+     * @brief Returns the tiles used by the particle sprites.
+     */
+    [[nodiscard]] const sprite_tiles_ptr& tiles() const
+    {
+        return _tiles;
+    }
+
+    /**
+     * @brief Sets the tiles used by the particle sprites.
+     * @param tiles sprite_tiles_ptr to copy.
+     *
+     * It must be compatible with the current shape, size and color palette.
+     */
+    void set_tiles(const sprite_tiles_ptr& tiles);
+
+    /**
+     * @brief Sets the tiles used by the particle sprites.
+     * @param tiles sprite_tiles_ptr to move.
+     *
+     * It must be compatible with the current shape, size and color palette.
+     */
+    void set_tiles(sprite_tiles_ptr&& tiles);
+
+    /**
+     * @brief Returns the color palette used by the particle sprites.
+     */
+    [[nodiscard]] const sprite_palette_ptr& palette() const
+    {
+        return _palette;
+    }
+
+    /**
+     * @brief Sets the color palette used by the particle sprites.
+     * @param palette sprite_palette_ptr to copy.
+     *
+     * It must be compatible with the current tiles.
+     */
+    void set_palette(const sprite_palette_ptr& palette);
+
+    /**
+     * @brief Sets the color palette used by the particle sprites.
+     * @param palette sprite_palette_ptr to move.
+     *
+     * It must be compatible with the current tiles.
+     */
+    void set_palette(sprite_palette_ptr&& palette);
+
+    /**
+     * @brief Returns the priority of the particle sprites relative to backgrounds.
+     */
+    [[nodiscard]] int bg_priority() const
+    {
+        return _bg_priority;
+    }
+
+    /**
+     * @brief Sets the priority of the particle sprites relative to backgrounds.
+     *
+     * Sprites with higher priority are drawn first (and therefore can be covered by later sprites and backgrounds).
+     *
+     * @param bg_priority Priority in the range [0..3].
+     */
+    void set_bg_priority(int bg_priority);
+
+    /**
+     * @brief Returns the velocity increment applied to all particles each time update() is called.
+     */
+    [[nodiscard]] const fixed_point& gravity() const
+    {
+        return _gravity;
+    }
+
+    /**
+     * @brief Sets the velocity increment applied to all particles each time update() is called.
+     */
+    void set_gravity(const fixed_point& gravity)
+    {
+        _gravity = gravity;
+    }
+
+    /**
+     * @brief Indicates if the particles must be committed to the GBA or not.
+     */
+    [[nodiscard]] bool visible() const
+    {
+        return _visible;
+    }
+
+    /**
+     * @brief Sets if the particles must be committed to the GBA or not.
+     */
+    void set_visible(bool visible)
+    {
+        _visible = visible;
+    }
+
+    /**
+     * @brief Returns the camera_ptr attached to the particles (if any).
+     */
+    [[nodiscard]] const optional<camera_ptr>& camera() const
+    {
+        return _camera;
+    }
+
+    /**
+     * @brief Sets the camera_ptr attached to the particles.
+     * @param camera camera_ptr to copy.
+     */
+    void set_camera(const camera_ptr& camera)
+    {
+        _camera = camera;
+    }
+
+    /**
+     * @brief Sets the camera_ptr attached to the particles.
+     * @param camera camera_ptr to move.
+     */
+    void set_camera(camera_ptr&& camera)
+    {
+        _camera = move(camera);
+    }
+
+    /**
+     * @brief Removes the camera_ptr attached to the particles (if any).
+     */
+    void remove_camera()
+    {
+        _camera.reset();
+    }
+
+    /**
+     * @brief Adds a new particle.
+     * @param position Position of the center of the new particle.
+     * @param velocity Position increment applied to the new particle each time update() is called.
+     * @param frames Number of update() calls before the new particle is removed.
+     * @return `true` if the particle was added, `false` if there's no more capacity or frames is not positive.
+     */
+    bool emit(const fixed_point& position, const fixed_point& velocity, int frames);
+
+    /**
+     * @brief Removes all particles.
+     */
+    void clear()
+    {
+        _size = 0;
+    }
+
+    /**
+     * @brief Moves all particles, removes the expired ones and writes the visible ones
+     * to the reserved hardware sprite handles.
+     *
+     * It should be called once per frame.
+     */
+    void update();
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    iparticle_system(int* xs, int* ys, int* x_velocities, int* y_velocities, uint16_t* frames, int max_size,
+                     const sprite_shape_size& shape_size, sprite_tiles_ptr&& tiles, sprite_palette_ptr&& palette,
+                     int first_handle_index);
+
+    iparticle_system(int* xs, int* ys, int* x_velocities, int* y_velocities, uint16_t* frames, int max_size,
+                     const sprite_item& item, int first_handle_index);
+
+    /// @endcond
+
+private:
+    int* _xs;
+    int* _ys;
+    int* _x_velocities;
+    int* _y_velocities;
+    uint16_t* _frames;
+    sprite_shape_size _shape_size;
+    sprite_tiles_ptr _tiles;
+    sprite_palette_ptr _palette;
+    optional<camera_ptr> _camera;
+    fixed_point _gravity;
+    int _max_size;
+    int _size = 0;
+    int _first_handle_index;
+    int _last_written_handles_count = 0;
+    uint8_t _bg_priority = 3;
+    bool _visible = true;
+
+    void _hide_written_handles();
+
+    [[nodiscard]] BN_CODE_IWRAM int _update_impl(void* handles, int attr0, int attr1, int attr2, int camera_x,
+                                                 int camera_y);
+};
+
+
+/**
+ * @brief Pooled particles drawn directly with reserved hardware sprite handles.
+ *
+ * @tparam MaxSize Maximum number of particles.
+ *
+ * @ingroup sprite
+ */
+template<int MaxSize>
+class particle_system : public iparticle_system
+{
+    static_assert(MaxSize > 0 && MaxSize <= hw::sprites::count());
+
+public:
+    /**
+     * @brief Constructor.
+     * @param shape_size Shape and size of the particle sprites.
+     * @param tiles Tiles used by the particle sprites.
+     * @param palette Color palette used by the particle sprites.
+     * @param first_handle_index Index of the first reserved hardware sprite handle used by the particles.
+     *
+     * The range [first_handle_index, first_handle_index + MaxSize) must be reserved with
+     * bn::sprites::set_reserved_handles_count.
+     */
+    particle_system(const sprite_shape_size& shape_size, sprite_tiles_ptr tiles, sprite_palette_ptr palette,
+                    int first_handle_index) :
+        iparticle_system(_xs_array, _ys_array, _x_velocities_array, _y_velocities_array, _frames_array, MaxSize,
+                         shape_size, move(tiles), move(palette), first_handle_index)
+    {
+    }
+
+    /**
+     * @brief Constructor.
+     * @param item sprite_item used to create the tiles and the color palette of the particle sprites.
+     * @param first_handle_index Index of the first reserved hardware sprite handle used by the particles.
+     *
+     * The range [first_handle_index, first_handle_index + MaxSize) must be reserved with
+     * bn::sprites::set_reserved_handles_count.
+     */
+    particle_system(const sprite_item& item, int first_handle_index) :
+        iparticle_system(_xs_array, _ys_array, _x_velocities_array, _y_velocities_array, _frames_array, MaxSize,
+                         item, first_handle_index)
+    {
+    }
+
+private:
+    int _xs_array[MaxSize];
+    int _ys_array[MaxSize];
+    int _x_velocities_array[MaxSize];
+    int _y_velocities_array[MaxSize];
+    uint16_t _frames_array[MaxSize];
+};
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_REGULAR_BG_COLLISION_CELL_TYPE_H
+#define BN_REGULAR_BG_COLLISION_CELL_TYPE_H
+
+/**
+ * @file
+ * bn::regular_bg_collision_cell_type header file.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+
+/**
+ * @brief Specifies the available collision types of a regular background map cell.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ */
+enum class regular_bg_collision_cell_type : uint8_t
+{
+    EMPTY, //!< Cell without collision.
+    SOLID, //!< Fully solid cell.
+    SLOPE_UP, //!< Bottom-right half of the cell is solid (floor goes up from left to right).
+    SLOPE_DOWN //!< Bottom-left half of the cell is solid (floor goes down from left to right).
+};
+
+}
+
+#endif
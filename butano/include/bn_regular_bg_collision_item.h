@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_REGULAR_BG_COLLISION_ITEM_H
+#define BN_REGULAR_BG_COLLISION_ITEM_H
+
+/**
+ * @file
+ * bn::regular_bg_collision_result and bn::regular_bg_collision_item implementation header file.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ * @ingroup tool
+ */
+
+#include "bn_size.h"
+#include "bn_span.h"
+#include "bn_point.h"
+#include "bn_fixed_point.h"
+#include "bn_top_left_fixed_rect.h"
+#include "bn_regular_bg_collision_cell_type.h"
+
+namespace bn
+{
+
+/**
+ * @brief Result of moving a rectangle through a regular_bg_collision_item.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ */
+class regular_bg_collision_result
+{
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    constexpr regular_bg_collision_result() = default;
+
+    /**
+     * @brief Constructor.
+     * @param rect Moved rectangle.
+     * @param left_hit Indicates if the moved rectangle has hit a wall on its left side.
+     * @param right_hit Indicates if the moved rectangle has hit a wall on its right side.
+     * @param top_hit Indicates if the moved rectangle has hit a ceiling.
+     * @param bottom_hit Indicates if the moved rectangle has hit a floor.
+     */
+    constexpr regular_bg_collision_result(const top_left_fixed_rect& rect, bool left_hit, bool right_hit,
+                                          bool top_hit, bool bottom_hit) :
+        _rect(rect),
+        _left_hit(left_hit),
+        _right_hit(right_hit),
+        _top_hit(top_hit),
+        _bottom_hit(bottom_hit)
+    {
+    }
+
+    /**
+     * @brief Returns the moved rectangle.
+     */
+    [[nodiscard]] constexpr const top_left_fixed_rect& rect() const
+    {
+        return _rect;
+    }
+
+    /**
+     * @brief Indicates if the moved rectangle has hit a wall on its left side.
+     */
+    [[nodiscard]] constexpr bool left_hit() const
+    {
+        return _left_hit;
+    }
+
+    /**
+     * @brief Indicates if the moved rectangle has hit a wall on its right side.
+     */
+    [[nodiscard]] constexpr bool right_hit() const
+    {
+        return _right_hit;
+    }
+
+    /**
+     * @brief Indicates if the moved rectangle has hit a ceiling.
+     */
+    [[nodiscard]] constexpr bool top_hit() const
+    {
+        return _top_hit;
+    }
+
+    /**
+     * @brief Indicates if the moved rectangle has hit a floor.
+     */
+    [[nodiscard]] constexpr bool bottom_hit() const
+    {
+        return _bottom_hit;
+    }
+
+private:
+    top_left_fixed_rect _rect;
+    bool _left_hit = false;
+    bool _right_hit = false;
+    bool _top_hit = false;
+    bool _bottom_hit = false;
+};
+
+
+/**
+ * @brief Contains the collision layer of one or more regular background maps.
+ *
+ * The assets conversion tools generate an object of this type in the build folder for each *.bmp file
+ * with `regular_bg` type and a `collision_colors` field.
+ *
+ * Each map cell collision type is stored in two bits, so sixteen map cells are packed in each word.
+ *
+ * Map cells outside the map are considered solid.
+ *
+ * The collision data is not copied but referenced, so it should outlive the regular_bg_collision_item
+ * to avoid dangling references.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ * @ingroup tool
+ */
+class regular_bg_collision_item
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param words_ref Reference to the packed collision data of one or more maps.
+     *
+     * The collision data is not copied but referenced, so it should outlive the regular_bg_collision_item
+     * to avoid dangling references.
+     *
+     * @param dimensions Size in map cells of each referenced map.
+     * @param maps_count Number of maps contained in words_ref.
+     */
+    constexpr regular_bg_collision_item(const uint32_t& words_ref, const size& dimensions, int maps_count = 1) :
+        _words_ptr(&words_ref),
+        _dimensions(dimensions),
+        _maps_count(maps_count)
+    {
+        BN_ASSERT(dimensions.width() >= 32 && dimensions.width() <= 2048 && dimensions.width() % 32 == 0,
+                  "Invalid width: ", dimensions.width());
+        BN_ASSERT(dimensions.height() >= 32 && dimensions.height() <= 2048 && dimensions.height() % 32 == 0,
+                  "Invalid height: ", dimensions.height());
+        BN_ASSERT(maps_count > 0 && maps_count < 65536, "Invalid maps count: ", maps_count);
+    }
+
+    /**
+     * @brief Returns a pointer to the referenced collision data of the first map.
+     */
+    [[nodiscard]] constexpr const uint32_t* words_ptr() const
+    {
+        return _words_ptr;
+    }
+
+    /**
+     * @brief Returns a pointer to the referenced collision data of the map indicated by map_index.
+     */
+    [[nodiscard]] constexpr const uint32_t* words_ptr(int map_index) const
+    {
+        BN_ASSERT(map_index >= 0 && map_index < _maps_count, "Invalid map index: ", map_index, " - ", _maps_count);
+
+        return _words_ptr + (map_index * (_dimensions.width() / 16) * _dimensions.height());
+    }
+
+    /**
+     * @brief Returns the size in map cells of each referenced map.
+     */
+    [[nodiscard]] constexpr const size& dimensions() const
+    {
+        return _dimensions;
+    }
+
+    /**
+     * @brief Returns the number of referenced maps.
+     */
+    [[nodiscard]] constexpr int maps_count() const
+    {
+        return _maps_count;
+    }
+
+    /**
+     * @brief Returns the collision type of the map cell of the first map indicated by the given coordinates.
+     */
+    [[nodiscard]] constexpr regular_bg_collision_cell_type cell_type(int x, int y) const
+    {
+        return _cell_type(_words_ptr, x, y);
+    }
+
+    /**
+     * @brief Returns the collision type of the map cell of the map indicated by map_index
+     * and the given coordinates.
+     */
+    [[nodiscard]] constexpr regular_bg_collision_cell_type cell_type(int x, int y, int map_index) const
+    {
+        return _cell_type(words_ptr(map_index), x, y);
+    }
+
+    /**
+     * @brief Returns the collision type of the map cell of the first map indicated by the given position.
+     */
+    [[nodiscard]] constexpr regular_bg_collision_cell_type cell_type(const point& position) const
+    {
+        return _cell_type(_words_ptr, position.x(), position.y());
+    }
+
+    /**
+     * @brief Returns the collision type of the map cell of the map indicated by map_index
+     * and the given position.
+     */
+    [[nodiscard]] constexpr regular_bg_collision_cell_type cell_type(const point& position, int map_index) const
+    {
+        return _cell_type(words_ptr(map_index), position.x(), position.y());
+    }
+
+    /**
+     * @brief Moves a rectangle through the first map, stopping it when it hits a wall, a ceiling or a floor.
+     *
+     * The rectangle is moved horizontally first and vertically after that.
+     * Slopes only stop horizontal movement if they are not in the bottom row of map cells of the rectangle:
+     * walking over them lifts the rectangle instead.
+     *
+     * @param rect Rectangle to move, in pixels relative to the top-left corner of the map.
+     * @param delta Movement in pixels.
+     * @return Moved rectangle and the collision sides.
+     */
+    [[nodiscard]] regular_bg_collision_result sweep(const top_left_fixed_rect& rect, const fixed_point& delta) const
+    {
+        return sweep(rect, delta, 0);
+    }
+
+    /**
+     * @brief Moves a rectangle through the map indicated by map_index,
+     * stopping it when it hits a wall, a ceiling or a floor.
+     *
+     * The rectangle is moved horizontally first and vertically after that.
+     * Slopes only stop horizontal movement if they are not in the bottom row of map cells of the rectangle:
+     * walking over them lifts the rectangle instead.
+     *
+     * @param rect Rectangle to move, in pixels relative to the top-left corner of the map.
+     * @param delta Movement in pixels.
+     * @param map_index Index of the map to test.
+     * @return Moved rectangle and the collision sides.
+     */
+    [[nodiscard]] regular_bg_collision_result sweep(
+            const top_left_fixed_rect& rect, const fixed_point& delta, int map_index) const;
+
+    /**
+     * @brief Moves multiple rectangles through the first map,
+     * stopping them when they hit a wall, a ceiling or a floor.
+     * @param rects Rectangles to move, in pixels relative to the top-left corner of the map.
+     * @param deltas Movement in pixels of each rectangle.
+     * @param results Moved rectangles and their collision sides.
+     */
+    void sweep(const span<const top_left_fixed_rect>& rects, const span<const fixed_point>& deltas,
+               span<regular_bg_collision_result> results) const
+    {
+        sweep(rects, deltas, results, 0);
+    }
+
+    /**
+     * @brief Moves multiple rectangles through the map indicated by map_index,
+     * stopping them when they hit a wall, a ceiling or a floor.
+     * @param rects Rectangles to move, in pixels relative to the top-left corner of the map.
+     * @param deltas Movement in pixels of each rectangle.
+     * @param results Moved rectangles and their collision sides.
+     * @param map_index Index of the map to test.
+     */
+    void sweep(const span<const top_left_fixed_rect>& rects, const span<const fixed_point>& deltas,
+               span<regular_bg_collision_result> results, int map_index) const;
+
+    /**
+     * @brief Equal operator.
+     * @param a First regular_bg_collision_item to compare.
+     * @param b Second regular_bg_collision_item to compare.
+     * @return `true` if the first regular_bg_collision_item is equal to the second one, otherwise `false`.
+     */
+    [[nodiscard]] constexpr friend bool operator==(
+            const regular_bg_collision_item& a, const regular_bg_collision_item& b) = default;
+
+private:
+    const uint32_t* _words_ptr;
+    size _dimensions;
+    int _maps_count;
+
+    [[nodiscard]] constexpr regular_bg_collision_cell_type _cell_type(const uint32_t* words, int x, int y) const
+    {
+        int width = _dimensions.width();
+
+        if(unsigned(x) >= unsigned(width) || unsigned(y) >= unsigned(_dimensions.height()))
+        {
+            return regular_bg_collision_cell_type::SOLID;
+        }
+
+        uint32_t word = words[(y * (width / 16)) + (x / 16)];
+        return regular_bg_collision_cell_type((word >> ((x % 16) * 2)) & 3);
+    }
+
+    BN_CODE_IWRAM static void _sweep_impl(const uint32_t* words, int width, int height, int count,
+                                          const top_left_fixed_rect* rects, const fixed_point* deltas,
+                                          regular_bg_collision_result* results);
+};
+
+}
+
+#endif
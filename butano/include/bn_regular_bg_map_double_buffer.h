@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_REGULAR_BG_MAP_DOUBLE_BUFFER_H
+#define BN_REGULAR_BG_MAP_DOUBLE_BUFFER_H
+
+/**
+ * @file
+ * bn::regular_bg_map_double_buffer header file.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ */
+
+#include "bn_regular_bg_map_ptr.h"
+
+namespace bn
+{
+
+class regular_bg_ptr;
+
+/**
+ * @brief Pair of allocated regular background maps which allows to rewrite a map without tearing.
+ *
+ * The front map is displayed, while the back map can be modified at any time of the frame.
+ * When the back map is ready, flip displays it by changing the map used by a regular background,
+ * which takes effect in the next V-Blank.
+ *
+ * After a flip call, the new back map is still displayed until the next V-Blank,
+ * so it must not be modified until the next core::update call.
+ *
+ * Since map cells are not copied in V-Blank, map updates are not bounded by the V-Blank length.
+ *
+ * @ingroup regular_bg
+ * @ingroup bg_map
+ */
+class regular_bg_map_double_buffer
+{
+
+public:
+    /**
+     * @brief Allocates the front and back maps.
+     * @param dimensions Size in map cells of each map.
+     * @param tiles Referenced tiles of the maps.
+     * @param palette Referenced color palette of the maps.
+     * @return The requested regular_bg_map_double_buffer.
+     */
+    [[nodiscard]] static regular_bg_map_double_buffer allocate(
+            const size& dimensions, regular_bg_tiles_ptr tiles, bg_palette_ptr palette);
+
+    /**
+     * @brief Allocates the front and back maps.
+     * @param dimensions Size in map cells of each map.
+     * @param tiles Referenced tiles of the maps.
+     * @param palette Referenced color palette of the maps.
+     * @return The requested regular_bg_map_double_buffer if both maps can be allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<regular_bg_map_double_buffer> allocate_optional(
+            const size& dimensions, regular_bg_tiles_ptr tiles, bg_palette_ptr palette);
+
+    regular_bg_map_double_buffer(const regular_bg_map_double_buffer& other) = delete;
+
+    regular_bg_map_double_buffer& operator=(const regular_bg_map_double_buffer& other) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other regular_bg_map_double_buffer to move.
+     */
+    regular_bg_map_double_buffer(regular_bg_map_double_buffer&& other) noexcept = default;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other regular_bg_map_double_buffer to move.
+     * @return Reference to this.
+     */
+    regular_bg_map_double_buffer& operator=(regular_bg_map_double_buffer&& other) noexcept = default;
+
+    /**
+     * @brief Returns the map which should be displayed.
+     */
+    [[nodiscard]] const regular_bg_map_ptr& front_map() const
+    {
+        return _front_map;
+    }
+
+    /**
+     * @brief Returns the map which can be modified without tearing.
+     */
+    [[nodiscard]] const regular_bg_map_ptr& back_map() const
+    {
+        return _back_map;
+    }
+
+    /**
+     * @brief Returns the VRAM cells of the map which should be displayed.
+     */
+    [[nodiscard]] span<const regular_bg_map_cell> front_vram();
+
+    /**
+     * @brief Returns the VRAM cells of the map which can be modified without tearing.
+     *
+     * After a flip call, they are still displayed until the next V-Blank,
+     * so they should not be modified until the next core::update call.
+     */
+    [[nodiscard]] span<regular_bg_map_cell> back_vram();
+
+    /**
+     * @brief Copies the cells of the front map to the back map,
+     * so the back map can be updated incrementally after a flip.
+     *
+     * After a flip call, it must not be called until the next core::update call.
+     */
+    void copy_front_to_back();
+
+    /**
+     * @brief Displays the back map in the given regular background from the next V-Blank,
+     * and exchanges the front and back maps.
+     * @param bg Regular background which must be displaying the front map.
+     *
+     * The new back map is still displayed until the next V-Blank,
+     * so back_vram must not be written until the next core::update call. Otherwise, it tears.
+     */
+    void flip(regular_bg_ptr& bg);
+
+private:
+    regular_bg_map_ptr _front_map;
+    regular_bg_map_ptr _back_map;
+
+    regular_bg_map_double_buffer(regular_bg_map_ptr&& front_map, regular_bg_map_ptr&& back_map);
+};
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SCOPED_SCRATCH_H
+#define BN_SCOPED_SCRATCH_H
+
+/**
+ * @file
+ * bn::scoped_scratch header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+
+/**
+ * @brief Releases the memory allocated in the frame arenas since its creation when it goes out of scope.
+ *
+ * Scratches can be nested, but they must be destroyed in reverse order of creation
+ * and before the end of the current bn::core::update call.
+ *
+ * @ingroup memory
+ */
+class scoped_scratch
+{
+
+public:
+    /**
+     * @brief Default constructor.
+     *
+     * It stores the current usage of the EWRAM and IWRAM frame arenas.
+     */
+    scoped_scratch();
+
+    scoped_scratch(const scoped_scratch& other) = delete;
+
+    scoped_scratch& operator=(const scoped_scratch& other) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * It releases the memory allocated in the frame arenas since this scratch was created.
+     */
+    ~scoped_scratch();
+
+    /**
+     * @brief Returns the number of bytes allocated in the EWRAM frame arena since this scratch was created.
+     */
+    [[nodiscard]] int used_ewram() const;
+
+    /**
+     * @brief Returns the number of bytes allocated in the IWRAM frame arena since this scratch was created.
+     */
+    [[nodiscard]] int used_iwram() const;
+
+private:
+    int _ewram_mark;
+    int _iwram_mark;
+    int _depth;
+};
+
+}
+
+#endif
@@ -63,6 +63,35 @@ public:
      */
     [[nodiscard]] static optional<sprite_affine_mat_ptr> create_optional(const affine_mat_attributes& attributes);
 
+    /**
+     * @brief Returns a shared affine transformation matrix with the specified attributes.
+     *
+     * If there's already a shared matrix with the same attributes it is returned, otherwise a new one is created.
+     *
+     * A shared matrix stops being shared when it is modified with a sprite_affine_mat_ptr.
+     * However, sprite_ptr setters attach their sprite to another shared matrix instead of modifying it,
+     * even if sprite_affine_mats::auto_share_enabled returns `false`.
+     *
+     * @param attributes affine_mat_attributes of the output matrix.
+     * @return The requested sprite_affine_mat_ptr.
+     */
+    [[nodiscard]] static sprite_affine_mat_ptr create_shared(const affine_mat_attributes& attributes);
+
+    /**
+     * @brief Returns a shared affine transformation matrix with the specified attributes.
+     *
+     * If there's already a shared matrix with the same attributes it is returned, otherwise a new one is created.
+     *
+     * A shared matrix stops being shared when it is modified with a sprite_affine_mat_ptr.
+     * However, sprite_ptr setters attach their sprite to another shared matrix instead of modifying it,
+     * even if sprite_affine_mats::auto_share_enabled returns `false`.
+     *
+     * @param attributes affine_mat_attributes of the output matrix.
+     * @return The requested sprite_affine_mat_ptr if it could be found or allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_affine_mat_ptr> create_shared_optional(
+            const affine_mat_attributes& attributes);
+
     /**
      * @brief Copy constructor.
      * @param other sprite_affine_mat_ptr to copy.
@@ -222,6 +251,11 @@ public:
      */
     void set_attributes(const affine_mat_attributes& attributes);
 
+    /**
+     * @brief Indicates if this matrix can be returned by create_shared or not.
+     */
+    [[nodiscard]] bool shared() const;
+
     /**
      * @brief Indicates if this matrix is equal to the identity matrix or not.
      */
@@ -35,6 +35,36 @@ namespace bn::sprite_affine_mats
      * that can be managed with sprite_affine_mat_ptr objects.
      */
     [[nodiscard]] int available_count();
+
+    /**
+     * @brief Indicates if sprites share affine transformation matrices automatically or not.
+     *
+     * If it is enabled, when a sprite_ptr without an affine transformation matrix
+     * is rotated, scaled, sheared or flipped, it is attached to a shared matrix
+     * with the new attributes (see sprite_affine_mat_ptr::create_shared).
+     *
+     * This way, sprites with the same transformation use the same hardware matrix.
+     *
+     * A sprite_ptr attached to a shared matrix is always attached to another shared matrix
+     * with the new attributes when it is rotated, scaled, sheared or flipped, even if this is disabled,
+     * since its matrix can be used by other sprites.
+     */
+    [[nodiscard]] bool auto_share_enabled();
+
+    /**
+     * @brief Sets if sprites share affine transformation matrices automatically or not.
+     *
+     * If it is enabled, when a sprite_ptr without an affine transformation matrix
+     * is rotated, scaled, sheared or flipped, it is attached to a shared matrix
+     * with the new attributes (see sprite_affine_mat_ptr::create_shared).
+     *
+     * This way, sprites with the same transformation use the same hardware matrix.
+     *
+     * A sprite_ptr attached to a shared matrix is always attached to another shared matrix
+     * with the new attributes when it is rotated, scaled, sheared or flipped, even if this is disabled,
+     * since its matrix can be used by other sprites.
+     */
+    void set_auto_share_enabled(bool auto_share_enabled);
 }
 
 #endif
@@ -20,11 +20,14 @@
 #include "bn_sprite_ptr.h"
 #include "bn_sprite_tiles_ptr.h"
 #include "bn_sprite_tiles_item.h"
+#include "bn_sprite_tiles_delta_item.h"
 #include "bn_sprite_animate_actions_fwd.h"
 
 namespace bn
 {
 
+class isprite_tiles_cache;
+
 // animation
 
 /**
@@ -466,6 +469,897 @@ template<typename ...Args>
 }
 
 
+// delta animation
+
+/**
+ * @brief Base class of bn::sprite_delta_animate_action.
+ *
+ * Can be used as a reference type for all bn::sprite_delta_animate_action objects.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ * @ingroup action
+ */
+class isprite_delta_animate_action
+{
+
+public:
+    isprite_delta_animate_action(const isprite_delta_animate_action& other) = delete;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other isprite_delta_animate_action to copy.
+     * @return Reference to this.
+     */
+    isprite_delta_animate_action& operator=(const isprite_delta_animate_action& other);
+
+    /**
+     * @brief Move assignment operator.
+     * @param other isprite_delta_animate_action to move.
+     * @return Reference to this.
+     */
+    isprite_delta_animate_action& operator=(isprite_delta_animate_action&& other) noexcept;
+
+    /**
+     * @brief Changes the tile set of the given sprite_ptr when the given amount of update calls are done.
+     *
+     * If the new tile set is the next one of the current tile set in tiles_delta_item().tiles_item(),
+     * only the changed tiles are uploaded to VRAM.
+     */
+    void update();
+
+    /**
+     * @brief Indicates if the action must not be updated anymore.
+     */
+    [[nodiscard]] bool done() const
+    {
+        return _current_graphics_indexes_index == _graphics_indexes_ref->size();
+    }
+
+    /**
+     * @brief Resets the action to its initial state.
+     */
+    void reset()
+    {
+        _current_graphics_indexes_index = 0;
+        _current_wait_updates = 0;
+    }
+
+    /**
+     * @brief Returns the sprite_ptr to modify.
+     */
+    [[nodiscard]] const sprite_ptr& sprite() const
+    {
+        return *_sprite_ref;
+    }
+
+    /**
+     * @brief Returns the number of times the action must be updated before changing the tiles
+     * of the given sprite_ptr.
+     */
+    [[nodiscard]] int wait_updates() const
+    {
+        return _wait_updates;
+    }
+
+    /**
+     * @brief Sets the number of times the action must be updated before changing the tiles
+     * of the given sprite_ptr.
+     */
+    void set_wait_updates(int wait_updates);
+
+    /**
+     * @brief Returns the number of times the action must be updated before the next tiles change.
+     */
+    [[nodiscard]] int next_change_updates() const
+    {
+        return _current_wait_updates;
+    }
+
+    /**
+     * @brief Sets the number of times the action must be updated before the next tiles change.
+     */
+    void set_next_change_updates(int next_change_updates);
+
+    /**
+     * @brief Returns the sprite_tiles_delta_item which contains the sprite tile sets to use by the given sprite_ptr.
+     */
+    [[nodiscard]] const sprite_tiles_delta_item& tiles_delta_item() const
+    {
+        return *_tiles_delta_item_ref;
+    }
+
+    /**
+     * @brief Returns the indexes of the tile sets to reference in tiles_delta_item().tiles_item().
+     */
+    [[nodiscard]] const ivector<uint16_t>& graphics_indexes() const
+    {
+        return *_graphics_indexes_ref;
+    }
+
+    /**
+     * @brief Indicates if the action can be updated forever or not.
+     */
+    [[nodiscard]] bool update_forever() const
+    {
+        return _forever;
+    }
+
+    /**
+     * @brief Returns the current index of the given graphics_indexes
+     * (not the current index of the tile set to reference in tiles_delta_item().tiles_item()).
+     */
+    [[nodiscard]] int current_index() const
+    {
+        return _current_graphics_indexes_index;
+    }
+
+    /**
+     * @brief Sets the current index of the given graphics_indexes
+     * (not the current index of the tile set to reference in tiles_delta_item().tiles_item()).
+     */
+    void set_current_index(int current_index);
+
+    /**
+     * @brief Returns the current index of the tile set to reference in tiles_delta_item().tiles_item().
+     */
+    [[nodiscard]] int current_graphics_index() const
+    {
+        return graphics_indexes()[_current_graphics_indexes_index];
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    isprite_delta_animate_action() = default;
+
+    void _set_refs(sprite_ptr& sprite, sprite_tiles_delta_item& tiles_delta_item, ivector<uint16_t>& graphics_indexes);
+
+    void _assign(const isprite_delta_animate_action& other);
+
+    void _set_update_forever(bool forever)
+    {
+        _forever = forever;
+    }
+
+    void _assign_graphics_indexes(const span<const uint16_t>& graphics_indexes);
+
+    void _assign_graphics_indexes(const ivector<uint16_t>& graphics_indexes);
+
+    /// @endcond
+
+private:
+    sprite_ptr* _sprite_ref = nullptr;
+    sprite_tiles_delta_item* _tiles_delta_item_ref = nullptr;
+    ivector<uint16_t>* _graphics_indexes_ref = nullptr;
+    uint16_t _wait_updates = 0;
+    uint16_t _current_graphics_indexes_index = 0;
+    uint16_t _current_wait_updates = 0;
+    bool _forever = true;
+};
+
+template<int MaxSize>
+class sprite_delta_animate_action : public isprite_delta_animate_action
+{
+    static_assert(MaxSize > 1);
+
+public:
+    /**
+     * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets only once.
+     * @param sprite sprite_ptr to copy.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+     * @return The requested sprite_delta_animate_action.
+     */
+    [[nodiscard]] static sprite_delta_animate_action once(
+            const sprite_ptr& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_delta_animate_action(sprite, wait_updates, tiles_delta_item, false, graphics_indexes);
+    }
+
+    /**
+     * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets only once.
+     * @param sprite sprite_ptr to move.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+     * @return The requested sprite_delta_animate_action.
+     */
+    [[nodiscard]] static sprite_delta_animate_action once(
+            sprite_ptr&& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_delta_animate_action(move(sprite), wait_updates, tiles_delta_item, false, graphics_indexes);
+    }
+
+    /**
+     * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets forever.
+     * @param sprite sprite_ptr to copy.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+     * @return The requested sprite_delta_animate_action.
+     */
+    [[nodiscard]] static sprite_delta_animate_action forever(
+            const sprite_ptr& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_delta_animate_action(sprite, wait_updates, tiles_delta_item, true, graphics_indexes);
+    }
+
+    /**
+     * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets forever.
+     * @param sprite sprite_ptr to move.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+     * @return The requested sprite_delta_animate_action.
+     */
+    [[nodiscard]] static sprite_delta_animate_action forever(
+            sprite_ptr&& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_delta_animate_action(move(sprite), wait_updates, tiles_delta_item, true, graphics_indexes);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other sprite_delta_animate_action to copy.
+     */
+    sprite_delta_animate_action(const sprite_delta_animate_action& other) :
+        _sprite(other._sprite),
+        _tiles_delta_item(other._tiles_delta_item),
+        _graphics_indexes(other._graphics_indexes)
+    {
+        this->_set_refs(_sprite, _tiles_delta_item, _graphics_indexes);
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other sprite_delta_animate_action to move.
+     */
+    sprite_delta_animate_action(sprite_delta_animate_action&& other) noexcept :
+        _sprite(move(other._sprite)),
+        _tiles_delta_item(other._tiles_delta_item),
+        _graphics_indexes(other._graphics_indexes)
+    {
+        this->_set_refs(_sprite, _tiles_delta_item, _graphics_indexes);
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other isprite_delta_animate_action to copy.
+     */
+    sprite_delta_animate_action(const isprite_delta_animate_action& other) :
+        _sprite(other.sprite()),
+        _tiles_delta_item(other.tiles_delta_item()),
+        _graphics_indexes(other.graphics_indexes())
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= MaxSize,
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ", MaxSize);
+
+        this->_set_refs(_sprite, _tiles_delta_item, _graphics_indexes);
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other sprite_delta_animate_action to copy.
+     * @return Reference to this.
+     */
+    sprite_delta_animate_action& operator=(const sprite_delta_animate_action& other)
+    {
+        if(this != &other)
+        {
+            _sprite = other._sprite;
+            _tiles_delta_item = other._tiles_delta_item;
+            _graphics_indexes = other._graphics_indexes;
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other sprite_delta_animate_action to move.
+     * @return Reference to this.
+     */
+    sprite_delta_animate_action& operator=(sprite_delta_animate_action&& other) noexcept
+    {
+        if(this != &other)
+        {
+            _sprite = move(other._sprite);
+            _tiles_delta_item = other._tiles_delta_item;
+            _graphics_indexes = other._graphics_indexes;
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other isprite_delta_animate_action to copy.
+     * @return Reference to this.
+     */
+    sprite_delta_animate_action& operator=(const isprite_delta_animate_action& other)
+    {
+        static_cast<isprite_delta_animate_action&>(*this) = other;
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other ivector to move.
+     * @return Reference to this.
+     */
+    sprite_delta_animate_action& operator=(isprite_delta_animate_action&& other) noexcept
+    {
+        static_cast<isprite_delta_animate_action&>(*this) = move(other);
+        return *this;
+    }
+
+private:
+    sprite_ptr _sprite;
+    sprite_tiles_delta_item _tiles_delta_item;
+    vector<uint16_t, MaxSize> _graphics_indexes;
+
+    sprite_delta_animate_action(const sprite_ptr& sprite, int wait_updates,
+                                const sprite_tiles_delta_item& tiles_delta_item, bool forever,
+                                const span<const uint16_t>& graphics_indexes) :
+        _sprite(sprite),
+        _tiles_delta_item(tiles_delta_item)
+    {
+        this->_set_refs(_sprite, _tiles_delta_item, _graphics_indexes);
+        this->_set_update_forever(forever);
+        this->set_wait_updates(wait_updates);
+        this->_assign_graphics_indexes(graphics_indexes);
+    }
+
+    sprite_delta_animate_action(sprite_ptr&& sprite, int wait_updates,
+                                const sprite_tiles_delta_item& tiles_delta_item, bool forever,
+                                const span<const uint16_t>& graphics_indexes) :
+        _sprite(move(sprite)),
+        _tiles_delta_item(tiles_delta_item)
+    {
+        this->_set_refs(_sprite, _tiles_delta_item, _graphics_indexes);
+        this->_set_update_forever(forever);
+        this->set_wait_updates(wait_updates);
+        this->_assign_graphics_indexes(graphics_indexes);
+    }
+};
+
+
+/**
+ * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets only once.
+ * @param sprite sprite_ptr to copy.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+ * @return The requested sprite_delta_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_delta_animate_action_once(
+        const sprite_ptr& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+        Args ...graphics_indexes)
+{
+    return sprite_delta_animate_action<sizeof...(Args)>::once(
+                sprite, wait_updates, tiles_delta_item,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+/**
+ * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets only once.
+ * @param sprite sprite_ptr to move.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+ * @return The requested sprite_delta_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_delta_animate_action_once(
+        sprite_ptr&& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+        Args ...graphics_indexes)
+{
+    return sprite_delta_animate_action<sizeof...(Args)>::once(
+                move(sprite), wait_updates, tiles_delta_item,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+/**
+ * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets forever.
+ * @param sprite sprite_ptr to copy.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+ * @return The requested sprite_delta_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_delta_animate_action_forever(
+        const sprite_ptr& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+        Args ...graphics_indexes)
+{
+    return sprite_delta_animate_action<sizeof...(Args)>::forever(
+                sprite, wait_updates, tiles_delta_item,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+/**
+ * @brief Generates a sprite_delta_animate_action which loops over the given sprite tile sets forever.
+ * @param sprite sprite_ptr to move.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_delta_item It contains the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_delta_item.tiles_item().
+ * @return The requested sprite_delta_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_delta_animate_action_forever(
+        sprite_ptr&& sprite, int wait_updates, const sprite_tiles_delta_item& tiles_delta_item,
+        Args ...graphics_indexes)
+{
+    return sprite_delta_animate_action<sizeof...(Args)>::forever(
+                move(sprite), wait_updates, tiles_delta_item,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+// streamed animation
+
+/**
+ * @brief Base class of bn::sprite_streamed_animate_action.
+ *
+ * Can be used as a reference type for all bn::sprite_streamed_animate_action objects.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ * @ingroup action
+ */
+class isprite_streamed_animate_action
+{
+
+public:
+    isprite_streamed_animate_action(const isprite_streamed_animate_action& other) = delete;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other isprite_streamed_animate_action to copy.
+     * @return Reference to this.
+     */
+    isprite_streamed_animate_action& operator=(const isprite_streamed_animate_action& other);
+
+    /**
+     * @brief Move assignment operator.
+     * @param other isprite_streamed_animate_action to move.
+     * @return Reference to this.
+     */
+    isprite_streamed_animate_action& operator=(isprite_streamed_animate_action&& other) noexcept;
+
+    /**
+     * @brief Changes the tile set of the given sprite_ptr when the given amount of update calls are done.
+     *
+     * The new tile set is taken from tiles_cache(), and after that the next one of the animation is prefetched.
+     */
+    void update();
+
+    /**
+     * @brief Indicates if the action must not be updated anymore.
+     */
+    [[nodiscard]] bool done() const
+    {
+        return _current_graphics_indexes_index == _graphics_indexes_ref->size();
+    }
+
+    /**
+     * @brief Resets the action to its initial state.
+     */
+    void reset()
+    {
+        _current_graphics_indexes_index = 0;
+        _current_wait_updates = 0;
+    }
+
+    /**
+     * @brief Returns the sprite_ptr to modify.
+     */
+    [[nodiscard]] const sprite_ptr& sprite() const
+    {
+        return *_sprite_ref;
+    }
+
+    /**
+     * @brief Returns the number of times the action must be updated before changing the tiles
+     * of the given sprite_ptr.
+     */
+    [[nodiscard]] int wait_updates() const
+    {
+        return _wait_updates;
+    }
+
+    /**
+     * @brief Sets the number of times the action must be updated before changing the tiles
+     * of the given sprite_ptr.
+     */
+    void set_wait_updates(int wait_updates);
+
+    /**
+     * @brief Returns the number of times the action must be updated before the next tiles change.
+     */
+    [[nodiscard]] int next_change_updates() const
+    {
+        return _current_wait_updates;
+    }
+
+    /**
+     * @brief Sets the number of times the action must be updated before the next tiles change.
+     */
+    void set_next_change_updates(int next_change_updates);
+
+    /**
+     * @brief Returns the isprite_tiles_cache which streams the sprite tile sets to use by the given sprite_ptr.
+     */
+    [[nodiscard]] isprite_tiles_cache& tiles_cache() const
+    {
+        return *_tiles_cache_ref;
+    }
+
+    /**
+     * @brief Returns the indexes of the tile sets to reference in tiles_cache().tiles_item().
+     */
+    [[nodiscard]] const ivector<uint16_t>& graphics_indexes() const
+    {
+        return *_graphics_indexes_ref;
+    }
+
+    /**
+     * @brief Indicates if the action can be updated forever or not.
+     */
+    [[nodiscard]] bool update_forever() const
+    {
+        return _forever;
+    }
+
+    /**
+     * @brief Returns the current index of the given graphics_indexes
+     * (not the current index of the tile set to reference in tiles_cache().tiles_item()).
+     */
+    [[nodiscard]] int current_index() const
+    {
+        return _current_graphics_indexes_index;
+    }
+
+    /**
+     * @brief Sets the current index of the given graphics_indexes
+     * (not the current index of the tile set to reference in tiles_cache().tiles_item()).
+     */
+    void set_current_index(int current_index);
+
+    /**
+     * @brief Returns the current index of the tile set to reference in tiles_cache().tiles_item().
+     */
+    [[nodiscard]] int current_graphics_index() const
+    {
+        return graphics_indexes()[_current_graphics_indexes_index];
+    }
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    isprite_streamed_animate_action() = default;
+
+    void _set_refs(sprite_ptr& sprite, isprite_tiles_cache& tiles_cache, ivector<uint16_t>& graphics_indexes);
+
+    void _assign(const isprite_streamed_animate_action& other);
+
+    void _set_update_forever(bool forever)
+    {
+        _forever = forever;
+    }
+
+    void _assign_graphics_indexes(const span<const uint16_t>& graphics_indexes);
+
+    void _assign_graphics_indexes(const ivector<uint16_t>& graphics_indexes);
+
+    /// @endcond
+
+private:
+    sprite_ptr* _sprite_ref = nullptr;
+    isprite_tiles_cache* _tiles_cache_ref = nullptr;
+    ivector<uint16_t>* _graphics_indexes_ref = nullptr;
+    uint16_t _wait_updates = 0;
+    uint16_t _current_graphics_indexes_index = 0;
+    uint16_t _current_wait_updates = 0;
+    bool _forever = true;
+};
+
+template<int MaxSize>
+class sprite_streamed_animate_action : public isprite_streamed_animate_action
+{
+    static_assert(MaxSize > 1);
+
+public:
+    /**
+     * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets only once.
+     * @param sprite sprite_ptr to copy.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+     * @return The requested sprite_streamed_animate_action.
+     */
+    [[nodiscard]] static sprite_streamed_animate_action once(
+            const sprite_ptr& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_streamed_animate_action(sprite, wait_updates, tiles_cache, false, graphics_indexes);
+    }
+
+    /**
+     * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets only once.
+     * @param sprite sprite_ptr to move.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+     * @return The requested sprite_streamed_animate_action.
+     */
+    [[nodiscard]] static sprite_streamed_animate_action once(
+            sprite_ptr&& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_streamed_animate_action(move(sprite), wait_updates, tiles_cache, false, graphics_indexes);
+    }
+
+    /**
+     * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets forever.
+     * @param sprite sprite_ptr to copy.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+     * @return The requested sprite_streamed_animate_action.
+     */
+    [[nodiscard]] static sprite_streamed_animate_action forever(
+            const sprite_ptr& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_streamed_animate_action(sprite, wait_updates, tiles_cache, true, graphics_indexes);
+    }
+
+    /**
+     * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets forever.
+     * @param sprite sprite_ptr to move.
+     * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+     * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+     * @return The requested sprite_streamed_animate_action.
+     */
+    [[nodiscard]] static sprite_streamed_animate_action forever(
+            sprite_ptr&& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+            const span<const uint16_t>& graphics_indexes)
+    {
+        return sprite_streamed_animate_action(move(sprite), wait_updates, tiles_cache, true, graphics_indexes);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other sprite_streamed_animate_action to copy.
+     */
+    sprite_streamed_animate_action(const sprite_streamed_animate_action& other) :
+        _sprite(other._sprite),
+        _graphics_indexes(other._graphics_indexes)
+    {
+        this->_set_refs(_sprite, other.tiles_cache(), _graphics_indexes);
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other sprite_streamed_animate_action to move.
+     */
+    sprite_streamed_animate_action(sprite_streamed_animate_action&& other) noexcept :
+        _sprite(move(other._sprite)),
+        _graphics_indexes(other._graphics_indexes)
+    {
+        this->_set_refs(_sprite, other.tiles_cache(), _graphics_indexes);
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other isprite_streamed_animate_action to copy.
+     */
+    sprite_streamed_animate_action(const isprite_streamed_animate_action& other) :
+        _sprite(other.sprite()),
+        _graphics_indexes(other.graphics_indexes())
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= MaxSize,
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ", MaxSize);
+
+        this->_set_refs(_sprite, other.tiles_cache(), _graphics_indexes);
+        this->_assign(other);
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other sprite_streamed_animate_action to copy.
+     * @return Reference to this.
+     */
+    sprite_streamed_animate_action& operator=(const sprite_streamed_animate_action& other)
+    {
+        if(this != &other)
+        {
+            _sprite = other._sprite;
+            _graphics_indexes = other._graphics_indexes;
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other sprite_streamed_animate_action to move.
+     * @return Reference to this.
+     */
+    sprite_streamed_animate_action& operator=(sprite_streamed_animate_action&& other) noexcept
+    {
+        if(this != &other)
+        {
+            _sprite = move(other._sprite);
+            _graphics_indexes = other._graphics_indexes;
+            this->_assign(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other isprite_streamed_animate_action to copy.
+     * @return Reference to this.
+     */
+    sprite_streamed_animate_action& operator=(const isprite_streamed_animate_action& other)
+    {
+        static_cast<isprite_streamed_animate_action&>(*this) = other;
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other ivector to move.
+     * @return Reference to this.
+     */
+    sprite_streamed_animate_action& operator=(isprite_streamed_animate_action&& other) noexcept
+    {
+        static_cast<isprite_streamed_animate_action&>(*this) = move(other);
+        return *this;
+    }
+
+private:
+    sprite_ptr _sprite;
+    vector<uint16_t, MaxSize> _graphics_indexes;
+
+    sprite_streamed_animate_action(const sprite_ptr& sprite, int wait_updates,
+                                isprite_tiles_cache& tiles_cache, bool forever,
+                                const span<const uint16_t>& graphics_indexes) :
+        _sprite(sprite)
+    {
+        this->_set_refs(_sprite, tiles_cache, _graphics_indexes);
+        this->_set_update_forever(forever);
+        this->set_wait_updates(wait_updates);
+        this->_assign_graphics_indexes(graphics_indexes);
+    }
+
+    sprite_streamed_animate_action(sprite_ptr&& sprite, int wait_updates,
+                                isprite_tiles_cache& tiles_cache, bool forever,
+                                const span<const uint16_t>& graphics_indexes) :
+        _sprite(move(sprite))
+    {
+        this->_set_refs(_sprite, tiles_cache, _graphics_indexes);
+        this->_set_update_forever(forever);
+        this->set_wait_updates(wait_updates);
+        this->_assign_graphics_indexes(graphics_indexes);
+    }
+};
+
+
+/**
+ * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets only once.
+ * @param sprite sprite_ptr to copy.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+ * @return The requested sprite_streamed_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_streamed_animate_action_once(
+        const sprite_ptr& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+        Args ...graphics_indexes)
+{
+    return sprite_streamed_animate_action<sizeof...(Args)>::once(
+                sprite, wait_updates, tiles_cache,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+/**
+ * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets only once.
+ * @param sprite sprite_ptr to move.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+ * @return The requested sprite_streamed_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_streamed_animate_action_once(
+        sprite_ptr&& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+        Args ...graphics_indexes)
+{
+    return sprite_streamed_animate_action<sizeof...(Args)>::once(
+                move(sprite), wait_updates, tiles_cache,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+/**
+ * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets forever.
+ * @param sprite sprite_ptr to copy.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+ * @return The requested sprite_streamed_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_streamed_animate_action_forever(
+        const sprite_ptr& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+        Args ...graphics_indexes)
+{
+    return sprite_streamed_animate_action<sizeof...(Args)>::forever(
+                sprite, wait_updates, tiles_cache,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
+/**
+ * @brief Generates a sprite_streamed_animate_action which loops over the given sprite tile sets forever.
+ * @param sprite sprite_ptr to move.
+ * @param wait_updates Number of times the action must be updated before changing the tiles of the given sprite_ptr.
+ * @param tiles_cache It streams the sprite tile sets to use by the given sprite_ptr.
+ * @param graphics_indexes Indexes of the tile sets to reference in tiles_cache.tiles_item().
+ * @return The requested sprite_streamed_animate_action.
+ *
+ * @ingroup sprite
+ */
+template<typename ...Args>
+[[nodiscard]] auto create_sprite_streamed_animate_action_forever(
+        sprite_ptr&& sprite, int wait_updates, isprite_tiles_cache& tiles_cache,
+        Args ...graphics_indexes)
+{
+    return sprite_streamed_animate_action<sizeof...(Args)>::forever(
+                move(sprite), wait_updates, tiles_cache,
+                array<uint16_t, sizeof...(Args)>{{ uint16_t(graphics_indexes)... }});
+}
+
+
 // cached animation
 
 /**
@@ -39,6 +39,46 @@ namespace bn
     class sprite_animate_action;
 
 
+    // delta animation
+
+    class isprite_delta_animate_action;
+
+    /**
+     * @brief Changes the tile set of a sprite_ptr when the action is updated a given number of times.
+     *
+     * This action differs from sprite_animate_action in that when the next tile set of a sprite_tiles_delta_item
+     * is referenced, only the tiles which are different from the current ones are uploaded to VRAM.
+     *
+     * @tparam MaxSize Maximum number of indexes to sprite tile sets to store.
+     *
+     * @ingroup sprite
+     * @ingroup tile
+     * @ingroup action
+     */
+    template<int MaxSize>
+    class sprite_delta_animate_action;
+
+
+    // streamed animation
+
+    class isprite_streamed_animate_action;
+
+    /**
+     * @brief Changes the tile set of a sprite_ptr when the action is updated a given number of times.
+     *
+     * This action differs from sprite_animate_action in that tile sets are streamed through the VRAM slots
+     * of an isprite_tiles_cache, and the next tile set of the animation is prefetched after each change.
+     *
+     * @tparam MaxSize Maximum number of indexes to sprite tile sets to store.
+     *
+     * @ingroup sprite
+     * @ingroup tile
+     * @ingroup action
+     */
+    template<int MaxSize>
+    class sprite_streamed_animate_action;
+
+
     // cached animation
 
     class isprite_cached_animate_action;
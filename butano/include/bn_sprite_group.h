@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_GROUP_H
+#define BN_SPRITE_GROUP_H
+
+/**
+ * @file
+ * bn::isprite_group and bn::sprite_group implementation header file.
+ *
+ * @ingroup sprite
+ */
+
+#include "bn_vector.h"
+#include "bn_sprite_ptr.h"
+#include "bn_camera_ptr.h"
+#include "bn_intrusive_list.h"
+#include "bn_sprite_affine_mat_ptr.h"
+
+namespace bn
+{
+
+/**
+ * @brief Base class of bn::sprite_group.
+ *
+ * Can be used as a reference type for all bn::sprite_group objects.
+ *
+ * @ingroup sprite
+ */
+class isprite_group : public intrusive_list_node_type
+{
+
+public:
+    isprite_group(const isprite_group& other) = delete;
+
+    isprite_group& operator=(const isprite_group& other) = delete;
+
+    /**
+     * @brief Destructor.
+     */
+    ~isprite_group();
+
+    /**
+     * @brief Returns the number of sprites of the group.
+     */
+    [[nodiscard]] int size() const
+    {
+        return _children_ref->size();
+    }
+
+    /**
+     * @brief Returns the maximum possible number of sprites of the group.
+     */
+    [[nodiscard]] int max_size() const
+    {
+        return _children_ref->max_size();
+    }
+
+    /**
+     * @brief Indicates if the group doesn't contain any sprite.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _children_ref->empty();
+    }
+
+    /**
+     * @brief Indicates if the group can't contain any more sprites.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _children_ref->full();
+    }
+
+    /**
+     * @brief Returns the sprite indicated by index.
+     */
+    [[nodiscard]] const sprite_ptr& sprite(int index) const
+    {
+        return _child(index).sprite;
+    }
+
+    /**
+     * @brief Returns the position of the sprite indicated by index relative to the group position.
+     */
+    [[nodiscard]] const fixed_point& local_position(int index) const
+    {
+        return _child(index).local_position;
+    }
+
+    /**
+     * @brief Sets the position of the sprite indicated by index relative to the group position.
+     */
+    void set_local_position(int index, const fixed_point& local_position);
+
+    /**
+     * @brief Adds a sprite to the group.
+     *
+     * The visibility, the camera and the affine matrix of the group are applied to the given sprite.
+     *
+     * @param sprite sprite_ptr to copy.
+     * @param local_position Position of the sprite relative to the group position.
+     */
+    void push_back(const sprite_ptr& sprite, const fixed_point& local_position)
+    {
+        push_back(sprite_ptr(sprite), local_position);
+    }
+
+    /**
+     * @brief Adds a sprite to the group.
+     *
+     * The visibility, the camera and the affine matrix of the group are applied to the given sprite.
+     *
+     * @param sprite sprite_ptr to move.
+     * @param local_position Position of the sprite relative to the group position.
+     */
+    void push_back(sprite_ptr&& sprite, const fixed_point& local_position);
+
+    /**
+     * @brief Removes the sprite indicated by index from the group.
+     *
+     * The removed sprite keeps its last position, visibility, camera and affine matrix.
+     */
+    void erase(int index);
+
+    /**
+     * @brief Removes all sprites from the group.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the horizontal position of the group.
+     */
+    [[nodiscard]] fixed x() const
+    {
+        return _position.x();
+    }
+
+    /**
+     * @brief Sets the horizontal position of the group.
+     */
+    void set_x(fixed x);
+
+    /**
+     * @brief Returns the vertical position of the group.
+     */
+    [[nodiscard]] fixed y() const
+    {
+        return _position.y();
+    }
+
+    /**
+     * @brief Sets the vertical position of the group.
+     */
+    void set_y(fixed y);
+
+    /**
+     * @brief Returns the position of the group.
+     */
+    [[nodiscard]] const fixed_point& position() const
+    {
+        return _position;
+    }
+
+    /**
+     * @brief Sets the position of the group.
+     * @param x Horizontal position of the group.
+     * @param y Vertical position of the group.
+     */
+    void set_position(fixed x, fixed y)
+    {
+        set_position(fixed_point(x, y));
+    }
+
+    /**
+     * @brief Sets the position of the group.
+     */
+    void set_position(const fixed_point& position);
+
+    /**
+     * @brief Indicates if the sprites of the group must be committed to the GBA or not.
+     */
+    [[nodiscard]] bool visible() const
+    {
+        return _visible;
+    }
+
+    /**
+     * @brief Sets if the sprites of the group must be committed to the GBA or not.
+     */
+    void set_visible(bool visible);
+
+    /**
+     * @brief Returns the camera_ptr attached to the sprites of the group (if any).
+     */
+    [[nodiscard]] const optional<camera_ptr>& camera() const
+    {
+        return _camera;
+    }
+
+    /**
+     * @brief Sets the camera_ptr attached to the sprites of the group.
+     * @param camera camera_ptr to copy.
+     */
+    void set_camera(const camera_ptr& camera)
+    {
+        set_camera(camera_ptr(camera));
+    }
+
+    /**
+     * @brief Sets the camera_ptr attached to the sprites of the group.
+     * @param camera camera_ptr to move.
+     */
+    void set_camera(camera_ptr&& camera);
+
+    /**
+     * @brief Removes the camera_ptr attached to the sprites of the group (if any).
+     */
+    void remove_camera();
+
+    /**
+     * @brief Returns the sprite_affine_mat_ptr attached to the sprites of the group (if any).
+     *
+     * It must be modified with the methods of the group, otherwise the positions of the sprites
+     * are not updated.
+     */
+    [[nodiscard]] const optional<sprite_affine_mat_ptr>& affine_mat() const
+    {
+        return _affine_mat;
+    }
+
+    /**
+     * @brief Sets the sprite_affine_mat_ptr attached to the sprites of the group.
+     * @param affine_mat sprite_affine_mat_ptr to copy.
+     */
+    void set_affine_mat(const sprite_affine_mat_ptr& affine_mat)
+    {
+        set_affine_mat(sprite_affine_mat_ptr(affine_mat));
+    }
+
+    /**
+     * @brief Sets the sprite_affine_mat_ptr attached to the sprites of the group.
+     * @param affine_mat sprite_affine_mat_ptr to move.
+     */
+    void set_affine_mat(sprite_affine_mat_ptr&& affine_mat);
+
+    /**
+     * @brief Removes the sprite_affine_mat_ptr attached to the sprites of the group (if any).
+     */
+    void remove_affine_mat();
+
+    /**
+     * @brief Returns the rotation angle in degrees of the group.
+     */
+    [[nodiscard]] fixed rotation_angle() const;
+
+    /**
+     * @brief Sets the rotation angle in degrees of the group.
+     *
+     * If the group doesn't have an attached sprite_affine_mat_ptr, a new one is created.
+     *
+     * @param rotation_angle Rotation angle in degrees, in the range [0..360].
+     */
+    void set_rotation_angle(fixed rotation_angle);
+
+    /**
+     * @brief Returns the horizontal scale of the group.
+     */
+    [[nodiscard]] fixed horizontal_scale() const;
+
+    /**
+     * @brief Sets the horizontal scale of the group.
+     *
+     * If the group doesn't have an attached sprite_affine_mat_ptr, a new one is created.
+     */
+    void set_horizontal_scale(fixed horizontal_scale);
+
+    /**
+     * @brief Returns the vertical scale of the group.
+     */
+    [[nodiscard]] fixed vertical_scale() const;
+
+    /**
+     * @brief Sets the vertical scale of the group.
+     *
+     * If the group doesn't have an attached sprite_affine_mat_ptr, a new one is created.
+     */
+    void set_vertical_scale(fixed vertical_scale);
+
+    /**
+     * @brief Sets the scale of the group.
+     *
+     * If the group doesn't have an attached sprite_affine_mat_ptr, a new one is created.
+     */
+    void set_scale(fixed scale);
+
+    /**
+     * @brief Sets the scale of the group.
+     *
+     * If the group doesn't have an attached sprite_affine_mat_ptr, a new one is created.
+     *
+     * @param horizontal_scale Horizontal scale.
+     * @param vertical_scale Vertical scale.
+     */
+    void set_scale(fixed horizontal_scale, fixed vertical_scale);
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    class child_type
+    {
+
+    public:
+        sprite_ptr sprite;
+        fixed_point local_position;
+
+        child_type(sprite_ptr&& _sprite, const fixed_point& _local_position) :
+            sprite(move(_sprite)),
+            local_position(_local_position)
+        {
+        }
+    };
+
+    isprite_group(ivector<child_type>& children_ref, const fixed_point& position) :
+        _children_ref(&children_ref),
+        _position(position)
+    {
+    }
+
+    /// @endcond
+
+private:
+    friend class sprite_groups_updater;
+
+    ivector<child_type>* _children_ref;
+    fixed_point _position;
+    optional<camera_ptr> _camera;
+    optional<sprite_affine_mat_ptr> _affine_mat;
+    bool _visible = true;
+    bool _dirty = false;
+
+    [[nodiscard]] const child_type& _child(int index) const
+    {
+        BN_ASSERT(index >= 0 && index < _children_ref->size(),
+                  "Invalid index: ", index, " - ", _children_ref->size());
+
+        return (*_children_ref)[index];
+    }
+
+    [[nodiscard]] sprite_affine_mat_ptr& _create_affine_mat();
+
+    void _set_dirty();
+};
+
+
+/**
+ * @brief Moves, shows, hides and transforms a group of sprites as a whole.
+ *
+ * The position of each sprite is its local position transformed by the affine matrix of the group (if any)
+ * plus the position of the group.
+ *
+ * Changes to the group are propagated to its sprites in a single pass when bn::core::update is called,
+ * so moving a group several times per frame costs the same as moving it once.
+ *
+ * Since it is registered by address in the sprites manager, it can't be copied nor moved.
+ *
+ * @tparam MaxSize Maximum number of sprites of the group.
+ *
+ * @ingroup sprite
+ */
+template<int MaxSize>
+class sprite_group : public isprite_group
+{
+    static_assert(MaxSize > 0);
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    sprite_group() :
+        sprite_group(fixed_point())
+    {
+    }
+
+    /**
+     * @brief Constructor.
+     * @param position Position of the group.
+     */
+    explicit sprite_group(const fixed_point& position) :
+        isprite_group(_children, position)
+    {
+    }
+
+private:
+    vector<child_type, MaxSize> _children;
+};
+
+}
+
+#endif
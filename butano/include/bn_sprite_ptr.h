@@ -27,6 +27,7 @@ class sprite_tiles_ptr;
 class sprite_shape_size;
 class sprite_tiles_item;
 class sprite_palette_ptr;
+class sprite_tiles_delta_item;
 class sprite_palette_item;
 class sprite_affine_mat_ptr;
 class sprite_first_attributes;
@@ -360,6 +361,20 @@ public:
      */
     void set_tiles(const sprite_tiles_item& tiles_item, int graphics_index);
 
+    /**
+     * @brief Replaces the tiles used by this sprite with the given tile set of a sprite_tiles_delta_item.
+     *
+     * If this sprite is the only one which uses its current sprite_tiles_ptr and it references the tile set
+     * returned by tiles_delta_item.previous_graphics_index(graphics_index),
+     * only the changed tiles are uploaded to VRAM.
+     *
+     * Otherwise, it behaves like set_tiles(tiles_delta_item.tiles_item(), graphics_index).
+     *
+     * @param tiles_delta_item It contains the sprite tiles to use by this sprite and the tiles changed between them.
+     * @param graphics_index Index of the tile set to reference in tiles_delta_item.tiles_item().
+     */
+    void set_tiles(const sprite_tiles_delta_item& tiles_delta_item, int graphics_index);
+
     /**
      * @brief Replaces the tiles used by this sprite with a new tile set created with the given sprite_tiles_item,
      * changing also the shape and size of the sprite.
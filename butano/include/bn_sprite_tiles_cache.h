@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_TILES_CACHE_H
+#define BN_SPRITE_TILES_CACHE_H
+
+/**
+ * @file
+ * bn::isprite_tiles_cache and bn::sprite_tiles_cache implementation header file.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ */
+
+#include "bn_vector.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_tiles_item.h"
+
+namespace bn
+{
+
+/**
+ * @brief Base class of bn::sprite_tiles_cache.
+ *
+ * Can be used as a reference type for all bn::sprite_tiles_cache objects.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ */
+class isprite_tiles_cache
+{
+
+public:
+    isprite_tiles_cache(const isprite_tiles_cache& other) = delete;
+
+    isprite_tiles_cache& operator=(const isprite_tiles_cache& other) = delete;
+
+    /**
+     * @brief Returns the sprite_tiles_item which contains the sprite tile sets to stream.
+     */
+    [[nodiscard]] const sprite_tiles_item& tiles_item() const
+    {
+        return _tiles_item;
+    }
+
+    /**
+     * @brief Returns the number of VRAM slots reserved by this cache.
+     */
+    [[nodiscard]] int slots_count() const
+    {
+        return _slots_ref->size();
+    }
+
+    /**
+     * @brief Indicates if the tile set indicated by graphics_index is resident in VRAM or not.
+     */
+    [[nodiscard]] bool contains(int graphics_index) const
+    {
+        return _find_slot(graphics_index) >= 0;
+    }
+
+    /**
+     * @brief Returns the VRAM slot which contains the tile set indicated by graphics_index.
+     *
+     * If the tile set is not resident, it is uploaded to VRAM replacing the least recently used one.
+     *
+     * Neither the returned tile set nor the one returned by the previous call are replaced
+     * by the next uploads, so they can be displayed without tearing.
+     *
+     * @param graphics_index Index of the tile set to reference in tiles_item().
+     * @return sprite_tiles_ptr which contains the requested tile set.
+     */
+    [[nodiscard]] const sprite_tiles_ptr& tiles(int graphics_index);
+
+    /**
+     * @brief Uploads to VRAM the tile set indicated by graphics_index if it is not resident yet,
+     * so a following tiles call with the same graphics_index doesn't have to upload it.
+     * @param graphics_index Index of the tile set to reference in tiles_item().
+     */
+    void prefetch(int graphics_index);
+
+    /**
+     * @brief Returns the number of tiles and prefetch calls which didn't upload any tile set to VRAM.
+     */
+    [[nodiscard]] int hits() const
+    {
+        return _hits;
+    }
+
+    /**
+     * @brief Returns the number of tiles and prefetch calls which uploaded a tile set to VRAM.
+     */
+    [[nodiscard]] int misses() const
+    {
+        return _misses;
+    }
+
+    /**
+     * @brief Sets hits and misses counters to zero.
+     */
+    void reset_stats()
+    {
+        _hits = 0;
+        _misses = 0;
+    }
+
+    /**
+     * @brief Marks all VRAM slots as empty, without releasing them.
+     */
+    void clear();
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    class slot_type
+    {
+
+    public:
+        sprite_tiles_ptr tiles;
+        unsigned last_use = 0;
+        int graphics_index = -1;
+
+        explicit slot_type(sprite_tiles_ptr&& _tiles) :
+            tiles(move(_tiles))
+        {
+        }
+    };
+
+    explicit isprite_tiles_cache(const sprite_tiles_item& tiles_item);
+
+    void _set_slots_ref(ivector<slot_type>& slots_ref, int slots_count);
+
+    /// @endcond
+
+private:
+    ivector<slot_type>* _slots_ref = nullptr;
+    sprite_tiles_item _tiles_item;
+    unsigned _use_counter = 0;
+    int _current_slot_index = -1;
+    int _previous_slot_index = -1;
+    int _hits = 0;
+    int _misses = 0;
+
+    [[nodiscard]] int _find_slot(int graphics_index) const;
+
+    [[nodiscard]] int _load_slot(int graphics_index);
+};
+
+
+/**
+ * @brief Streams the tile sets of a sprite_tiles_item through a fixed number of reserved VRAM slots.
+ *
+ * The VRAM slots are allocated on construction, so changing the displayed tile set doesn't allocate VRAM,
+ * and the most recently used tile sets are kept resident in VRAM.
+ *
+ * It is useful for sprites with too many tile sets to keep all of them in VRAM at the same time.
+ *
+ * The given sprite_tiles_item must not be compressed.
+ *
+ * @tparam MaxSlots Maximum number of reserved VRAM slots.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ */
+template<int MaxSlots>
+class sprite_tiles_cache : public isprite_tiles_cache
+{
+    static_assert(MaxSlots > 1);
+
+public:
+    /**
+     * @brief Constructor.
+     * @param tiles_item sprite_tiles_item which contains the sprite tile sets to stream.
+     *
+     * It reserves as many VRAM slots as MaxSlots or the number of tile sets of the given sprite_tiles_item,
+     * whichever is smaller.
+     */
+    explicit sprite_tiles_cache(const sprite_tiles_item& tiles_item) :
+        sprite_tiles_cache(tiles_item, MaxSlots)
+    {
+    }
+
+    /**
+     * @brief Constructor.
+     * @param tiles_item sprite_tiles_item which contains the sprite tile sets to stream.
+     * @param slots_count Number of VRAM slots to reserve.
+     *
+     * If it is greater than the number of tile sets of the given sprite_tiles_item, it is reduced to it.
+     */
+    sprite_tiles_cache(const sprite_tiles_item& tiles_item, int slots_count) :
+        isprite_tiles_cache(tiles_item)
+    {
+        this->_set_slots_ref(_slots, slots_count);
+    }
+
+private:
+    vector<slot_type, MaxSlots> _slots;
+};
+
+}
+
+#endif
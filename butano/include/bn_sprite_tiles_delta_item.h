@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_TILES_DELTA_ITEM_H
+#define BN_SPRITE_TILES_DELTA_ITEM_H
+
+/**
+ * @file
+ * bn::sprite_tiles_delta_item header file.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ * @ingroup tool
+ */
+
+#include "bn_sprite_tiles_item.h"
+
+namespace bn
+{
+
+/**
+ * @brief Contains the tiles which change between consecutive tile sets of a sprite_tiles_item.
+ *
+ * It allows to upload to VRAM only the changed tiles when a sprite goes from one tile set to the next one.
+ *
+ * The assets conversion tools generate an object of this type in the build folder for each *.bmp file
+ * with `sprite` type and `tiles_delta` field enabled.
+ *
+ * The delta data is not copied but referenced, so it should outlive the sprite_tiles_delta_item
+ * to avoid dangling references.
+ *
+ * @ingroup sprite
+ * @ingroup tile
+ * @ingroup tool
+ */
+class sprite_tiles_delta_item
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param tiles_item Uncompressed sprite_tiles_item with the sprite tile sets.
+     * @param delta_ref Reference to the delta data.
+     *
+     * Its first graphics_count() + 1 elements are offsets to the changed tiles of each tile set
+     * (relative to the end of the offsets), followed by the indexes of the changed tiles of each tile set.
+     *
+     * The delta data is not copied but referenced, so it should outlive the sprite_tiles_delta_item
+     * to avoid dangling references.
+     */
+    constexpr sprite_tiles_delta_item(const sprite_tiles_item& tiles_item, const span<const uint16_t>& delta_ref) :
+        _tiles_item(tiles_item),
+        _delta_ref(delta_ref)
+    {
+        BN_ASSERT(tiles_item.compression() == compression_type::NONE,
+                  "Compressed tiles not supported: ", int(tiles_item.compression()));
+        BN_ASSERT(delta_ref.size() > tiles_item.graphics_count(),
+                  "Invalid delta ref size: ", delta_ref.size(), " - ", tiles_item.graphics_count());
+        BN_ASSERT(delta_ref[tiles_item.graphics_count()] == delta_ref.size() - tiles_item.graphics_count() - 1,
+                  "Invalid delta ref: ", delta_ref[tiles_item.graphics_count()], " - ",
+                  delta_ref.size() - tiles_item.graphics_count() - 1);
+    }
+
+    /**
+     * @brief Returns the sprite_tiles_item with the sprite tile sets.
+     */
+    [[nodiscard]] constexpr const sprite_tiles_item& tiles_item() const
+    {
+        return _tiles_item;
+    }
+
+    /**
+     * @brief Returns the referenced delta data.
+     */
+    [[nodiscard]] constexpr const span<const uint16_t>& delta_ref() const
+    {
+        return _delta_ref;
+    }
+
+    /**
+     * @brief Returns the index of the tile set from which the changed tiles of the given tile set are computed.
+     * @param graphics_index Index of a tile set in tiles_item().
+     * @return graphics_index - 1, or the index of the last tile set if graphics_index is 0.
+     */
+    [[nodiscard]] constexpr int previous_graphics_index(int graphics_index) const
+    {
+        int graphics_count = _tiles_item.graphics_count();
+        BN_ASSERT(graphics_index >= 0 && graphics_index < graphics_count,
+                  "Invalid graphics index: ", graphics_index, " - ", graphics_count);
+
+        return graphics_index ? graphics_index - 1 : graphics_count - 1;
+    }
+
+    /**
+     * @brief Returns the indexes of the tiles of the given tile set
+     * which are different in the tile set returned by previous_graphics_index.
+     *
+     * Indexes are sorted in ascending order.
+     *
+     * @param graphics_index Index of a tile set in tiles_item().
+     */
+    [[nodiscard]] constexpr span<const uint16_t> changed_tiles(int graphics_index) const
+    {
+        int graphics_count = _tiles_item.graphics_count();
+        BN_ASSERT(graphics_index >= 0 && graphics_index < graphics_count,
+                  "Invalid graphics index: ", graphics_index, " - ", graphics_count);
+
+        const uint16_t* delta_data = _delta_ref.data();
+        int begin = delta_data[graphics_index];
+        int end = delta_data[graphics_index + 1];
+        return span<const uint16_t>(delta_data + graphics_count + 1 + begin, end - begin);
+    }
+
+    /**
+     * @brief Equal operator.
+     * @param a First sprite_tiles_delta_item to compare.
+     * @param b Second sprite_tiles_delta_item to compare.
+     * @return `true` if the first sprite_tiles_delta_item is equal to the second one, otherwise `false`.
+     */
+    [[nodiscard]] constexpr friend bool operator==(const sprite_tiles_delta_item& a,
+                                                   const sprite_tiles_delta_item& b)
+    {
+        return a._tiles_item == b._tiles_item && a._delta_ref.data() == b._delta_ref.data() &&
+                a._delta_ref.size() == b._delta_ref.size();
+    }
+
+private:
+    sprite_tiles_item _tiles_item;
+    span<const uint16_t> _delta_ref;
+};
+
+}
+
+#endif
@@ -112,6 +112,13 @@ namespace bn::sprites
      * Normally you should not need to call this function, but it can be useful after messing with HDMA for example.
      */
     void reload();
+
+    /**
+     * @brief Returns the number of bytes copied to OAM in the last commit.
+     *
+     * Only the blocks of hardware sprite handles modified since the previous commit are copied.
+     */
+    [[nodiscard]] int committed_bytes();
 }
 
 #endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TELEMETRY_H
+#define BN_TELEMETRY_H
+
+/**
+ * @file
+ * bn::telemetry header file.
+ *
+ * @ingroup profiler
+ */
+
+#include "bn_config_doxygen.h"
+#include "bn_telemetry_counter.h"
+#include "bn_config_telemetry.h"
+
+#if BN_CFG_TELEMETRY_ENABLED || BN_DOXYGEN
+    /**
+     * @brief Engine-wide per-frame counters.
+     *
+     * When @ref BN_CFG_TELEMETRY_ENABLED is `true`, each bn::core::update call samples all counters
+     * specified by bn::telemetry_counter and stores them in a ring buffer of @ref BN_CFG_TELEMETRY_MAX_SAMPLES frames.
+     *
+     * @ingroup profiler
+     */
+    namespace bn::telemetry
+    {
+        /**
+         * @brief Returns the number of counters sampled in each frame.
+         */
+        [[nodiscard]] constexpr int counters_count()
+        {
+            return int(telemetry_counter::ALLOC_EWRAM_BYTES) + 1;
+        }
+
+        /**
+         * @brief Returns the name of the given counter.
+         */
+        [[nodiscard]] const char* counter_name(telemetry_counter counter);
+
+        /**
+         * @brief Returns the value of the given counter sampled in the last bn::core::update call.
+         */
+        [[nodiscard]] int value(telemetry_counter counter);
+
+        /**
+         * @brief Returns the number of stored samples.
+         */
+        [[nodiscard]] int samples_count();
+
+        /**
+         * @brief Returns the number of the frame in which the sample indicated by index was stored.
+         * @param sample_index Index of the sample, where 0 is the oldest stored one.
+         */
+        [[nodiscard]] int sample_frame(int sample_index);
+
+        /**
+         * @brief Returns the value of the given counter stored by the sample indicated by index.
+         * @param sample_index Index of the sample, where 0 is the oldest stored one.
+         * @param counter Counter to retrieve.
+         */
+        [[nodiscard]] int sample(int sample_index, telemetry_counter counter);
+
+        /**
+         * @brief Indicates if counters are sampled in each bn::core::update call or not.
+         */
+        [[nodiscard]] bool paused();
+
+        /**
+         * @brief Sets if counters are sampled in each bn::core::update call or not.
+         */
+        void set_paused(bool paused);
+
+        /**
+         * @brief Removes all stored samples.
+         */
+        void clear();
+
+        /**
+         * @brief Logs all stored samples in CSV format (one line per sample, plus a header line).
+         */
+        void log_csv();
+    }
+#endif
+
+#endif
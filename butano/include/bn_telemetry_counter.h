@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TELEMETRY_COUNTER_H
+#define BN_TELEMETRY_COUNTER_H
+
+/**
+ * @file
+ * bn::telemetry_counter header file.
+ *
+ * @ingroup profiler
+ */
+
+#include "bn_common.h"
+
+namespace bn
+{
+
+/**
+ * @brief Specifies the values sampled by bn::telemetry in each bn::core::update call.
+ *
+ * @ingroup profiler
+ */
+enum class telemetry_counter : uint8_t
+{
+    CPU_TICKS, //!< CPU usage timer ticks (see bn::core::last_cpu_ticks).
+    VBLANK_TICKS, //!< V-Blank usage timer ticks (see bn::core::last_vblank_ticks).
+    MISSED_FRAMES, //!< Missed screen refreshes (see bn::core::last_missed_frames).
+    SPRITES, //!< Created sprites.
+    VISIBLE_SPRITES, //!< Sprites shown on screen.
+    OAM_BYTES, //!< Sprite attributes and affine matrices bytes committed to OAM.
+    PALETTE_BYTES, //!< Palette bytes committed.
+    SPRITE_TILES_BYTES, //!< Uncompressed sprite tiles bytes committed.
+    BIG_MAPS_BYTES, //!< Big background maps bytes committed.
+    BG_BLOCKS_BYTES, //!< Uncompressed background tiles and maps bytes committed.
+    COMPRESSED_BYTES, //!< Compressed sprite tiles, background tiles and maps bytes committed.
+    HBLANK_EFFECTS, //!< Created H-Blank effects.
+    SOUNDS, //!< Sound effects being played or pending to be played.
+    ALLOC_OPERATIONS, //!< Heap allocations, reallocations and deallocations.
+    ALLOC_EWRAM_BYTES //!< Bytes allocated in the EWRAM heap (see bn::memory::used_alloc_ewram).
+};
+
+}
+
+#endif
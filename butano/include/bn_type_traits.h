@@ -78,6 +78,15 @@ namespace bn
     using std::remove_cv;
     using std::remove_cv_t;
 
+    using std::is_integral;
+    using std::is_integral_v;
+
+    using std::is_pointer;
+    using std::is_pointer_v;
+
+    using std::underlying_type;
+    using std::underlying_type_t;
+
     using std::is_constant_evaluated;
 }
 
@@ -106,22 +106,40 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"compression"`: optional field which specifies the compression of the tiles and the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
+ * * `"tiles_delta"`: optional field which indicates if a bn::sprite_tiles_delta_item must be generated
+ * with the tiles which change between consecutive sprite images (false by default).
+ * It requires more than one sprite image and uncompressed tiles.
+ * * `"palette_group"`: optional field which specifies the name of a palette group shared with other sprites.
+ * The colors used by all sprites with the same palette group are packed in as few 16 color palettes as possible,
+ * and the tiles of each sprite are remapped to its packed palette.
+ * All of them must have `"bpp_4"` BPP mode and the same palette compression.
+ * * `"registry_group"`: optional field which specifies the name of an items registry group
+ * (see @ref import_items_registry).
  *
  * If the conversion process has finished successfully,
  * a bn::sprite_item should have been generated in the `build` folder.
@@ -137,6 +155,18 @@
  * bn::sprite_ptr sprite = bn::sprite_items::image.create_sprite(0, 0);
  * @endcode
  *
+ * If `"tiles_delta"` is enabled, a bn::sprite_tiles_delta_item named `image_tiles_delta` is also generated.
+ * It can be used with bn::sprite_delta_animate_action to upload only the changed tiles of each animation frame:
+ *
+ * @code{.cpp}
+ * bn::sprite_delta_animate_action<4> action = bn::create_sprite_delta_animate_action_forever(
+ *         sprite, 4, bn::sprite_items::image_tiles_delta, 0, 1, 2, 3);
+ * @endcode
+ *
+ * If `"palette_group"` is specified, the packed palettes are generated in a header file named
+ * `bn_sprite_palette_items_<group>.h`, with bn::sprite_palette_item objects named `<group>_0`, `<group>_1`, etc.
+ * Sprites which share a packed palette share the same palette in VRAM too.
+ *
  *
  * @subsection import_sprite_tiles Sprite tiles
  *
@@ -172,8 +202,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  *
  * If the conversion process has finished successfully,
  * a bn::sprite_tiles_item should have been generated in the `build` folder.
@@ -211,8 +244,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  *
  * If the conversion process has finished successfully,
  * a bn::sprite_palette_item should have been generated in the `build` folder.
@@ -277,29 +313,50 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"map_compression"`: optional field which specifies the compression of the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"compression"`: optional field which specifies the compression of the tiles, the colors and the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
+ * * `"collision_colors"`: optional field which specifies the palette indexes of the solid pixels of the image.
+ * If it is present, a bn::regular_bg_collision_item is generated too.
+ * Each map cell is classified as empty, solid or slope depending on which of its pixels are solid.
+ * * `"tiles_group"`: optional field which specifies the name of a tiles group shared with other regular backgrounds.
+ * Repeated and flipped tiles of all regular backgrounds with the same tiles group are stored only once
+ * in a bn::regular_bg_tiles_item named after the group.
+ * All of them must have the same BPP mode and tiles compression.
+ * * `"registry_group"`: optional field which specifies the name of an items registry group
+ * (see @ref import_items_registry).
  *
  * If the conversion process has finished successfully,
  * a bn::regular_bg_item should have been generated in the `build` folder.
@@ -315,6 +372,16 @@
  * bn::regular_bg_ptr regular_bg = bn::regular_bg_items::image.create_bg(0, 0);
  * @endcode
  *
+ * If `"collision_colors"` is specified, the collision layer is available with the `_collision` suffix:
+ *
+ * @code{.cpp}
+ * bn::regular_bg_collision_result result = bn::regular_bg_items::image_collision.sweep(rect, delta);
+ * @endcode
+ *
+ * If `"tiles_group"` is specified, the shared tiles are generated in a header file named
+ * `bn_regular_bg_tiles_items_<group>.h`, so regular backgrounds of the same group shown at the same time
+ * share the same tiles in VRAM too.
+ *
  *
  * @subsection import_regular_bg_tiles Regular background tiles
  *
@@ -340,8 +407,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"generate_palette"`: optional field which specifies if a background palette must be generated (`false` by default).
  * * `"palette_colors_count"`: optional field which specifies the background palette size [1..256].
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
@@ -349,8 +419,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  *
  * If the conversion process has finished successfully,
  * a bn::regular_bg_tiles_item should have been generated in the `build` folder.
@@ -400,29 +473,41 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"map_compression"`: optional field which specifies the compression of the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"compression"`: optional field which specifies the compression of the tiles, the colors and the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  *
  * If the conversion process has finished successfully,
  * a bn::affine_bg_item should have been generated in the `build` folder.
@@ -458,8 +543,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  * * `"generate_palette"`: optional field which specifies if a background palette must be generated (`false` by default).
  * * `"palette_colors_count"`: optional field which specifies the background palette size [1..256].
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
@@ -467,8 +555,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  *
  * If the conversion process has finished successfully,
  * a bn::affine_bg_tiles_item should have been generated in the `build` folder.
@@ -507,8 +598,11 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
+ *   * `"fast_lz"`: LZ compressed data with word granularity. It is faster to decompress than the other compressions.
  *   * `"auto"`: uses the option which gives the smallest data size.
  *   * `"auto_no_huffman"`: uses the option which gives the smallest data size, excluding "huffman".
+ *   * `"auto_fast"`: uses the fastest to decompress option which gives a data size
+ *     not much bigger than the smallest one.
  *
  * If the conversion process has finished successfully,
  * a bn::bg_palette_item should have been generated in the `build` folder.
@@ -525,6 +619,48 @@
  * @endcode
  *
  *
+ * @subsection import_items_registry Items registries
+ *
+ * Besides the header file of each item, registries of all sprite items and all regular background items
+ * are generated in header files named `bn_sprite_registry.h` and `bn_regular_bg_registry.h`.
+ *
+ * Each registry contains an `id` enum with the names of its items, a `constexpr` array of pointers to them
+ * and a bn::items_registry_entry array sorted by name hash, so items can be retrieved by ID in constant time
+ * and by name with a binary search:
+ *
+ * @code{.cpp}
+ * #include "bn_sprite_registry.h"
+ *
+ * const bn::sprite_item& item = bn::sprite_registry::item(bn::sprite_registry::id::image);
+ *
+ * if(const bn::sprite_item* found_item = bn::sprite_registry::find("image"))
+ * {
+ *     bn::sprite_ptr sprite = found_item->create_sprite(0, 0);
+ * }
+ * @endcode
+ *
+ * Items with a `"registry_group"` field are also added to the registry of their group,
+ * generated in a header file named `bn_sprite_registry_<group>.h` or `bn_regular_bg_registry_<group>.h`.
+ * Since a registry references all of its items, including the registry of a group instead of the global one
+ * allows the linker to discard the items which are not in that group.
+ *
+ * Registries are written only when their contents change, so they don't trigger unnecessary rebuilds.
+ *
+ *
+ * @subsection import_image_cache Images cache
+ *
+ * Generated image files are stored in a cache folder shared by all projects,
+ * indexed by the contents of the `*.bmp` and `*.json` files instead of by their modification time.
+ * This way a fresh checkout of a project doesn't need to convert again the images already converted by another one.
+ *
+ * The compression types chosen by `"auto"` compression fields are cached too,
+ * so they are not tested again after updating Butano.
+ *
+ * The cache folder is `~/.cache/butano/assets` by default,
+ * but it can be changed with the `BN_ASSETS_CACHE` environment variable.
+ * If `BN_ASSETS_CACHE` is empty, the cache is disabled.
+ *
+ *
  * @section import_audio Audio
  *
  * By default audio files played with Direct Sound channels go into the `audio` folder of your project,
@@ -380,6 +380,10 @@
  *
  * Keep in mind that IWRAM is small, so you shouldn't place too much code in it.
  *
+ * If each scene of your game has its own hot loops, you can place them in different IWRAM overlays
+ * with the `BN_CODE_IWRAM_OVERLAY` macro instead, and load the overlay required by each scene
+ * with bn::iwram_overlays::load.
+ *
  *
  * @section faq_images Images
  *
@@ -12,6 +12,71 @@
  * @tableofcontents
  *
  *
+ * @section changelog_19_5_0 19.5.0
+ *
+ * * bn::particle_system added.
+ * * bn::collision_grid added.
+ * * Regular BGs collision layers can be generated with the `collision_colors` field.
+ * * Generated image files are cached by content in a folder shared by all projects.
+ * * Images are compressed by the graphics tool instead of by grit, so all compression types are tested
+ *   with just one grit call.
+ * * Regular BGs tiles can be shared between multiple images with the `tiles_group` field.
+ * * `"fast_lz"` compression type added: LZ compressed data with word granularity, faster to decompress than
+ *   the other compression types.
+ * * `"auto_fast"` compression option added: it uses the fastest to decompress compression type
+ *   which gives a data size not much bigger than the smallest one.
+ * * bn::sprite_delta_animate_action added: it uploads to VRAM only the tiles which change between
+ *   consecutive animation frames, generated by the graphics tool with the `tiles_delta` field.
+ * * Colors of 4BPP sprites can be packed in shared palettes with the `palette_group` field.
+ * * Registries of all sprite and regular BG items are generated by the graphics tool,
+ *   with an ID enum and a name lookup. Items can be added to registry groups with the `registry_group` field.
+ * * Parallax cameras added: they follow a parent camera with bn::camera_ptr::create_parallax.
+ * * Only the sprites, BGs and windows attached to a moved camera are updated.
+ * * Default max number of cameras increased to 16 (`BN_CFG_CAMERA_MAX_ITEMS`).
+ * * Max number of cameras limited to 32 (`BN_CFG_CAMERA_MAX_ITEMS` values greater than 32 are not allowed anymore).
+ * * bn::sprite_tiles_cache added: it streams the tile sets of a sprite through a fixed number of VRAM slots,
+ *   keeping the most recently used ones resident.
+ * * bn::sprite_streamed_animate_action added: it animates a sprite with a bn::sprite_tiles_cache,
+ *   prefetching the next tile set of the animation.
+ * * bn::sprite_group added: it moves, shows, hides, rotates and scales multiple sprites as a whole,
+ *   updating their positions in a single pass per frame.
+ * * Sprite affine matrices with the same attributes can be shared with bn::sprite_affine_mat_ptr::create_shared.
+ * * Sprites can share affine matrices automatically with bn::sprite_affine_mats::set_auto_share_enabled.
+ * * Only the modified blocks of hardware sprite handles are copied to OAM.
+ * * bn::sprites::committed_bytes added.
+ * * Uncompressed tiles, big maps and compressed data commits can be deferred to the next V-Blank
+ *   (with the registers and palettes which reference them)
+ *   if they don't fit in the commit budget with bn::core::set_commit_budget_enabled.
+ * * Estimated and elapsed ticks of each bn::commit_phase can be retrieved with
+ *   bn::core::last_commit_estimated_ticks and bn::core::last_commit_ticks.
+ * * bn::core::vblank_overruns added.
+ * * bn::regular_bg_map_double_buffer and bn::affine_bg_map_double_buffer added: they allow to rewrite
+ *   big amounts of map cells without tearing, since they are not copied in V-Blank.
+ * * bn::tlsf_allocator added: its allocations and deallocations take constant time.
+ * * The EWRAM heap allocator can be selected with @ref BN_CFG_MEMORY_EWRAM_ALLOCATOR.
+ * * bn::frame_arena added: EWRAM and IWRAM linear allocators for temporary data,
+ *   released at the end of each bn::core::update call. They are disabled by default: their sizes are specified
+ *   by @ref BN_CFG_FRAME_ARENA_EWRAM_SIZE and @ref BN_CFG_FRAME_ARENA_IWRAM_SIZE.
+ * * bn::scoped_scratch added: it releases the frame arenas memory allocated since its creation.
+ * * IWRAM heap added: its size is specified by @ref BN_CFG_MEMORY_IWRAM_HEAP_SIZE,
+ *   and it can be managed with bn::memory::iwram_alloc and such.
+ * * bn::iwram_overlays added: they allow to copy groups of functions from ROM to IWRAM on demand.
+ * * bn::memory::used_overlays_iwram added.
+ * * `BN_BINARY_LOG` added: it stores format strings and arguments in a ring buffer without formatting them,
+ *   so it can be called inside hot loops. Stored records are decoded by `butano_binary_log_tool.py`.
+ * * bn::telemetry added: if @ref BN_CFG_TELEMETRY_ENABLED is `true`, engine-wide counters are sampled
+ *   in each bn::core::update call and they can be logged in CSV format.
+ * * Committed bytes of each bn::commit_phase can be retrieved with bn::core::last_commit_bytes.
+ * * bn::format_to added: it writes integers and fixed point values to a span of characters
+ *   without allocating memory, with optional width, fill character and number of decimals.
+ * * bn::ostringstream integers formatting optimized.
+ * * `memcmp` fixed: it returned wrong results when the first different bytes were found in a word,
+ *   or when the compared pointers were not word aligned.
+ * * `memcmp` optimized: it compares two words per iteration and it is placed in IWRAM.
+ * * bn::memcmp added.
+ * * Word and half word copies can be performed with DMA with @ref BN_CFG_MEMORY_DMA_COPY_MIN_BYTES.
+ *
+ *
  * @section changelog_19_4_1 19.4.1
  *
  * Files in audio folders with unknown extensions are ignored.
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_affine_bg_map_double_buffer.h"
+
+#include "bn_memory.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_affine_bg_ptr.h"
+#include "bn_affine_bg_tiles_ptr.h"
+
+namespace bn
+{
+
+affine_bg_map_double_buffer affine_bg_map_double_buffer::allocate(
+        const size& dimensions, affine_bg_tiles_ptr tiles, bg_palette_ptr palette)
+{
+    affine_bg_map_ptr front_map = affine_bg_map_ptr::allocate(dimensions, tiles, palette);
+    affine_bg_map_ptr back_map = affine_bg_map_ptr::allocate(dimensions, move(tiles), move(palette));
+    return affine_bg_map_double_buffer(move(front_map), move(back_map));
+}
+
+optional<affine_bg_map_double_buffer> affine_bg_map_double_buffer::allocate_optional(
+        const size& dimensions, affine_bg_tiles_ptr tiles, bg_palette_ptr palette)
+{
+    optional<affine_bg_map_double_buffer> result;
+
+    if(optional<affine_bg_map_ptr> front_map = affine_bg_map_ptr::allocate_optional(dimensions, tiles, palette))
+    {
+        if(optional<affine_bg_map_ptr> back_map =
+                affine_bg_map_ptr::allocate_optional(dimensions, move(tiles), move(palette)))
+        {
+            result = affine_bg_map_double_buffer(move(*front_map), move(*back_map));
+        }
+    }
+
+    return result;
+}
+
+span<const affine_bg_map_cell> affine_bg_map_double_buffer::front_vram()
+{
+    return *_front_map.vram();
+}
+
+span<affine_bg_map_cell> affine_bg_map_double_buffer::back_vram()
+{
+    return *_back_map.vram();
+}
+
+void affine_bg_map_double_buffer::copy_front_to_back()
+{
+    span<const affine_bg_map_cell> front_cells = front_vram();
+    span<affine_bg_map_cell> back_cells = back_vram();
+    memory::copy(front_cells[0], front_cells.size(), back_cells[0]);
+}
+
+void affine_bg_map_double_buffer::flip(affine_bg_ptr& bg)
+{
+    BN_ASSERT(bg.map() == _front_map, "Affine BG doesn't display the front map");
+
+    bg.set_map(_back_map);
+    _front_map.swap(_back_map);
+}
+
+affine_bg_map_double_buffer::affine_bg_map_double_buffer(
+        affine_bg_map_ptr&& front_map, affine_bg_map_ptr&& back_map) :
+    _front_map(move(front_map)),
+    _back_map(move(back_map))
+{
+}
+
+}
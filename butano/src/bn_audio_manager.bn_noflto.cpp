@@ -971,6 +971,11 @@ sound_data_type* sound_data(uint16_t handle)
     return nullptr;
 }
 
+int sounds_count()
+{
+    return data.sound_map.size();
+}
+
 uint16_t play_sound(int priority, bn::sound_item item)
 {
     int commands = data.commands_count;
@@ -114,6 +114,8 @@ namespace bn::audio_manager
 
     [[nodiscard]] sound_data_type* sound_data(uint16_t handle);
 
+    [[nodiscard]] int sounds_count();
+
     [[nodiscard]] uint16_t play_sound(int priority, sound_item item);
 
     [[nodiscard]] uint16_t play_sound(int priority, sound_item item, fixed volume, fixed speed, fixed panning);
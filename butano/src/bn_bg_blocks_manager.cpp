@@ -20,10 +20,12 @@
 #include "bn_regular_bg_map_item.cpp.h"
 #include "bn_regular_bg_tiles_ptr.cpp.h"
 #include "bn_regular_bg_tiles_item.cpp.h"
+#include "bn_regular_bg_map_double_buffer.cpp.h"
 #include "bn_affine_bg_map_ptr.cpp.h"
 #include "bn_affine_bg_map_item.cpp.h"
 #include "bn_affine_bg_tiles_ptr.cpp.h"
 #include "bn_affine_bg_tiles_item.cpp.h"
+#include "bn_affine_bg_map_double_buffer.cpp.h"
 
 #if BN_CFG_BG_BLOCKS_LOG_ENABLED
     #include "bn_log.h"
@@ -110,6 +112,10 @@ namespace
             hw::decompress::huff(source_ptr, destination_ptr);
             break;
 
+        case compression_type::FAST_LZ:
+            hw::decompress::fast_lz(source_ptr, destination_ptr);
+            break;
+
         default:
             BN_ERROR("Unknown compression type: ", int(compression));
             break;
@@ -197,7 +203,7 @@ namespace
 
     private:
         uint8_t _status: 2 = uint8_t(status_type::FREE);
-        uint8_t _compression: 2 = uint8_t(compression_type::NONE);
+        uint8_t _compression: 3 = uint8_t(compression_type::NONE);
         uint8_t _big_map_canvas_size: 2 = uint8_t(affine_bg_big_map_canvas_size::NORMAL);
 
     public:
@@ -992,6 +998,40 @@ namespace
         }
     }
 
+    [[nodiscard]] int _commit_item_bytes(const item_type& item)
+    {
+        if(! item.data)
+        {
+            return 0;
+        }
+
+        if(item.is_tiles)
+        {
+            return item.width * 2;
+        }
+
+        // Big maps are committed from bgs_manager:
+        if(item.is_big)
+        {
+            return 0;
+        }
+
+        int cells = item.width * item.height;
+        return item.is_affine ? cells : cells * 2;
+    }
+
+    [[nodiscard]] int _commit_items_bytes(const uint8_t* items_array, int items_count)
+    {
+        int result = 0;
+
+        for(int index = 0; index < items_count; ++index)
+        {
+            result += _commit_item_bytes(data.items.item(items_array[index]));
+        }
+
+        return result;
+    }
+
     void _fix_blocks_count(const item_type& item, int new_item_blocks_count)
     {
         switch(item.status())
@@ -2858,6 +2898,28 @@ void set_affine_map_position(int id, int x, int y)
     }
 }
 
+int big_map_commit_bytes(int id, int cols_count, int rows_count, bool full_commit)
+{
+    const item_type& item = data.items.item(id);
+
+    if(! item.data)
+    {
+        return 0;
+    }
+
+    if(item.is_affine)
+    {
+        affine_bg_big_map_canvas_info canvas_info(item.big_map_canvas_size());
+        return full_commit ? canvas_info.cells() : (cols_count + rows_count) * canvas_info.size();
+    }
+
+    constexpr int regular_canvas_size = 32;
+    constexpr int regular_canvas_cell_bytes = 2;
+
+    return full_commit ? regular_canvas_size * regular_canvas_size * regular_canvas_cell_bytes :
+                         (cols_count + rows_count) * regular_canvas_size * regular_canvas_cell_bytes;
+}
+
 void update()
 {
     if(data.to_remove_blocks_count || data.check_commit)
@@ -2943,6 +3005,16 @@ void update()
     data.delay_commit = false;
 }
 
+int uncompressed_commit_bytes()
+{
+    return _commit_items_bytes(data.to_commit_uncompressed_items_array, data.to_commit_uncompressed_items_count);
+}
+
+int compressed_commit_bytes()
+{
+    return _commit_items_bytes(data.to_commit_compressed_items_array, data.to_commit_compressed_items_count);
+}
+
 void commit_uncompressed(bool use_dma)
 {
     if(int commit_items_count = data.to_commit_uncompressed_items_count)
@@ -210,8 +210,14 @@ namespace bn::bg_blocks_manager
 
     void set_affine_map_position(int id, int x, int y);
 
+    [[nodiscard]] int big_map_commit_bytes(int id, int cols_count, int rows_count, bool full_commit);
+
     void update();
 
+    [[nodiscard]] int uncompressed_commit_bytes();
+
+    [[nodiscard]] int compressed_commit_bytes();
+
     void commit_uncompressed(bool use_dma);
 
     void commit_compressed();
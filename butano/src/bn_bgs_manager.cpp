@@ -1439,11 +1439,13 @@ void remove_camera(id_type id)
     }
 }
 
-void update_cameras()
+void update_cameras(unsigned cameras_mask)
 {
     for(item_type* item : data.items_vector)
     {
-        if(item->camera)
+        const camera_ptr* camera = item->camera.get();
+
+        if(camera && (cameras_mask & (1U << camera->id())))
         {
             if(item->regular_map)
             {
@@ -1695,6 +1697,26 @@ void commit(bool use_dma)
     }
 }
 
+int big_maps_commit_bytes()
+{
+    int result = 0;
+
+    for(const item_type* item : data.items_vector)
+    {
+        if(item->commit_big_map)
+        {
+            const regular_bg_map_ptr* item_regular_map = item->regular_map.get();
+            int map_handle = item_regular_map ? item_regular_map->handle() : item->affine_map->handle();
+            int cols_count = bn::abs(item->new_big_map_x - item->old_big_map_x);
+            int rows_count = bn::abs(item->new_big_map_y - item->old_big_map_y);
+            result += bg_blocks_manager::big_map_commit_bytes(
+                        map_handle, cols_count, rows_count, item->full_commit_big_map);
+        }
+    }
+
+    return result;
+}
+
 void commit_big_maps()
 {
     for(item_type* item : data.items_vector)
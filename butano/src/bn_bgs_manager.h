@@ -193,7 +193,7 @@ namespace bgs_manager
 
     void remove_camera(id_type id);
 
-    void update_cameras();
+    void update_cameras(unsigned cameras_mask);
 
     void update_regular_map_tiles_cbb(int map_id, int tiles_cbb);
 
@@ -221,6 +221,8 @@ namespace bgs_manager
 
     void commit(bool use_dma);
 
+    [[nodiscard]] int big_maps_commit_bytes();
+
     void commit_big_maps();
 
     void stop();
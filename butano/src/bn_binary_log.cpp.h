@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_binary_log.h"
+
+#if BN_CFG_LOG_ENABLED
+    #include "bn_log.h"
+    #include "bn_string.h"
+
+    namespace _bn::binary_log
+    {
+        namespace
+        {
+            constexpr int buffer_words = BN_CFG_LOG_BINARY_BUFFER_SIZE / 4;
+            constexpr int buffer_mask = buffer_words - 1;
+
+            class static_data
+            {
+
+            public:
+                unsigned buffer[buffer_words];
+                unsigned read_index;
+                unsigned write_index;
+                int dropped_records;
+            };
+
+            BN_DATA_EWRAM_BSS static_data data;
+
+            [[nodiscard]] int _used_words()
+            {
+                return int(data.write_index - data.read_index);
+            }
+        }
+
+        void init()
+        {
+            data.read_index = 0;
+            data.write_index = 0;
+            data.dropped_records = 0;
+        }
+
+        void write_record(const unsigned* words, int words_count)
+        {
+            if(_used_words() + words_count > buffer_words) [[unlikely]]
+            {
+                ++data.dropped_records;
+                return;
+            }
+
+            unsigned write_index = data.write_index;
+
+            for(int index = 0; index < words_count; ++index)
+            {
+                data.buffer[write_index & buffer_mask] = words[index];
+                ++write_index;
+            }
+
+            data.write_index = write_index;
+        }
+    }
+
+    namespace bn::binary_log
+    {
+        namespace
+        {
+            constexpr int line_max_words = (BN_CFG_LOG_MAX_SIZE - 5) / 8;
+
+            static_assert(line_max_words > 0);
+
+            void _append_hex(unsigned value, istring& string)
+            {
+                constexpr const char* digits = "0123456789ABCDEF";
+
+                for(int shift = 28; shift >= 0; shift -= 4)
+                {
+                    string.push_back(digits[(value >> shift) & 0xF]);
+                }
+            }
+        }
+
+        void flush()
+        {
+            while(_bn::binary_log::_used_words())
+            {
+                flush(BN_CFG_LOG_BINARY_FLUSH_MAX_RECORDS);
+            }
+        }
+
+        void flush(int max_records)
+        {
+            BN_ASSERT(max_records >= 0, "Invalid max records: ", max_records);
+
+            using namespace _bn::binary_log;
+
+            if(int dropped = data.dropped_records)
+            {
+                data.dropped_records = 0;
+                BN_LOG("Binary log records dropped: ", dropped);
+            }
+
+            string<BN_CFG_LOG_MAX_SIZE> line;
+
+            while(max_records && _used_words())
+            {
+                unsigned read_index = data.read_index;
+                auto types = reinterpret_cast<const uint8_t*>(data.buffer[(read_index + 1) & buffer_mask]);
+                int args_count = types[0];
+                int record_words = 2;
+
+                for(int index = 1; index <= args_count; ++index)
+                {
+                    uint8_t type = types[index];
+                    record_words += type == uint8_t(arg_type::INT64) || type == uint8_t(arg_type::UNSIGNED64) ? 2 : 1;
+                }
+
+                line.clear();
+                line.append("#BL ");
+
+                // Records that don't fit in one line are continued in lines starting with "#BL+ ":
+                for(int index = 0, line_words = 0; index < record_words; ++index, ++line_words)
+                {
+                    if(line_words == line_max_words)
+                    {
+                        bn::log(line);
+                        line.clear();
+                        line.append("#BL+ ");
+                        line_words = 0;
+                    }
+
+                    _append_hex(data.buffer[read_index & buffer_mask], line);
+                    ++read_index;
+                }
+
+                data.read_index = read_index;
+                bn::log(line);
+                --max_records;
+            }
+        }
+
+        int used_bytes()
+        {
+            return _bn::binary_log::_used_words() * 4;
+        }
+
+        int dropped_records()
+        {
+            return _bn::binary_log::data.dropped_records;
+        }
+    }
+#endif
@@ -67,6 +67,25 @@ optional<camera_ptr> camera_ptr::create_optional(const fixed_point& position)
     return result;
 }
 
+camera_ptr camera_ptr::create_parallax(const camera_ptr& parent, const fixed_point& parallax_factor)
+{
+    int id = cameras_manager::create_parallax(parent._id, parallax_factor);
+    return camera_ptr(id);
+}
+
+optional<camera_ptr> camera_ptr::create_parallax_optional(const camera_ptr& parent, const fixed_point& parallax_factor)
+{
+    int id = cameras_manager::create_parallax_optional(parent._id, parallax_factor);
+    optional<camera_ptr> result;
+
+    if(id >= 0)
+    {
+        result = camera_ptr(id);
+    }
+
+    return result;
+}
+
 camera_ptr::camera_ptr(const camera_ptr& other) :
     camera_ptr(other._id)
 {
@@ -132,4 +151,33 @@ void camera_ptr::set_position(const fixed_point& position)
     cameras_manager::set_position(_id, position);
 }
 
+bool camera_ptr::parallax() const
+{
+    return cameras_manager::parent_id(_id) >= 0;
+}
+
+optional<camera_ptr> camera_ptr::parent() const
+{
+    int parent_id = cameras_manager::parent_id(_id);
+    optional<camera_ptr> result;
+
+    if(parent_id >= 0)
+    {
+        cameras_manager::increase_usages(parent_id);
+        result = camera_ptr(parent_id);
+    }
+
+    return result;
+}
+
+const fixed_point& camera_ptr::parallax_factor() const
+{
+    return cameras_manager::parallax_factor(_id);
+}
+
+void camera_ptr::set_parallax_factor(const fixed_point& parallax_factor)
+{
+    cameras_manager::set_parallax_factor(_id, parallax_factor);
+}
+
 }
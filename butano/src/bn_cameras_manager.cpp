@@ -5,7 +5,6 @@
 
 #include "bn_cameras_manager.h"
 
-#include "bn_limits.h"
 #include "bn_config_cameras.h"
 #include "bn_bgs_manager.h"
 #include "bn_sprites_manager.h"
@@ -21,7 +20,7 @@ namespace
 {
     constexpr int max_items = BN_CFG_CAMERA_MAX_ITEMS;
 
-    static_assert(max_items > 0 && max_items <= numeric_limits<uint8_t>::max());
+    static_assert(max_items > 0 && max_items <= 32);
 
 
     class item_type
@@ -29,7 +28,10 @@ namespace
 
     public:
         fixed_point position;
+        fixed_point parallax_factor;
         unsigned usages = 0;
+        int8_t parent_id = -1;
+        uint8_t children_count = 0;
     };
 
 
@@ -40,10 +42,74 @@ namespace
         item_type items[max_items];
         alignas(int) uint8_t free_item_indexes_array[max_items];
         uint16_t free_item_indexes_size = max_items;
-        bool update = false;
+        unsigned updated_items_mask = 0;
     };
 
     BN_DATA_EWRAM_BSS static_data data;
+
+
+    [[nodiscard]] fixed_point _parallax_position(const item_type& item)
+    {
+        const fixed_point& parent_position = data.items[item.parent_id].position;
+        const fixed_point& parallax_factor = item.parallax_factor;
+        return fixed_point(parent_position.x() * parallax_factor.x(), parent_position.y() * parallax_factor.y());
+    }
+
+    void _update_position(int id, const fixed_point& position)
+    {
+        item_type& item = data.items[id];
+
+        if(item.position != position)
+        {
+            item.position = position;
+            data.updated_items_mask |= 1U << id;
+
+            if(int children_count = item.children_count)
+            {
+                for(int index = 0; index < max_items; ++index)
+                {
+                    item_type& child = data.items[index];
+
+                    if(child.parent_id == id)
+                    {
+                        _update_position(index, _parallax_position(child));
+                        --children_count;
+
+                        if(! children_count)
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] int _create(const fixed_point& position, int parent_id, const fixed_point& parallax_factor)
+    {
+        --data.free_item_indexes_size;
+
+        int item_index = data.free_item_indexes_array[data.free_item_indexes_size];
+        item_type& new_item = data.items[item_index];
+        new_item.parallax_factor = parallax_factor;
+        new_item.usages = 1;
+        new_item.parent_id = int8_t(parent_id);
+        new_item.children_count = 0;
+
+        if(parent_id >= 0)
+        {
+            item_type& parent = data.items[parent_id];
+            ++parent.usages;
+            ++parent.children_count;
+            new_item.position = _parallax_position(new_item);
+        }
+        else
+        {
+            new_item.position = position;
+        }
+
+        return item_index;
+    }
 }
 
 void init()
@@ -70,13 +136,7 @@ int create(const fixed_point& position)
 {
     BN_BASIC_ASSERT(data.free_item_indexes_size, "No more cameras available");
 
-    --data.free_item_indexes_size;
-
-    int item_index = data.free_item_indexes_array[data.free_item_indexes_size];
-    item_type& new_item = data.items[item_index];
-    new_item.position = position;
-    new_item.usages = 1;
-    return item_index;
+    return _create(position, -1, fixed_point(1, 1));
 }
 
 int create_optional(const fixed_point& position)
@@ -86,13 +146,27 @@ int create_optional(const fixed_point& position)
         return -1;
     }
 
-    --data.free_item_indexes_size;
+    return _create(position, -1, fixed_point(1, 1));
+}
 
-    int item_index = data.free_item_indexes_array[data.free_item_indexes_size];
-    item_type& new_item = data.items[item_index];
-    new_item.position = position;
-    new_item.usages = 1;
-    return item_index;
+int create_parallax(int parent_id, const fixed_point& parallax_factor)
+{
+    BN_BASIC_ASSERT(data.free_item_indexes_size, "No more cameras available");
+    BN_ASSERT(data.items[parent_id].parent_id < 0, "Parent camera is a parallax camera");
+
+    return _create(fixed_point(), parent_id, parallax_factor);
+}
+
+int create_parallax_optional(int parent_id, const fixed_point& parallax_factor)
+{
+    BN_ASSERT(data.items[parent_id].parent_id < 0, "Parent camera is a parallax camera");
+
+    if(! data.free_item_indexes_size)
+    {
+        return -1;
+    }
+
+    return _create(fixed_point(), parent_id, parallax_factor);
 }
 
 void increase_usages(int id)
@@ -110,6 +184,13 @@ void decrease_usages(int id)
     {
         data.free_item_indexes_array[data.free_item_indexes_size] = uint8_t(id);
         ++data.free_item_indexes_size;
+
+        if(int parent_id = item.parent_id; parent_id >= 0)
+        {
+            item.parent_id = -1;
+            --data.items[parent_id].children_count;
+            decrease_usages(parent_id);
+        }
     }
 }
 
@@ -121,46 +202,60 @@ const fixed_point& position(int id)
 
 void set_x(int id, fixed x)
 {
-    item_type& item = data.items[id];
+    const item_type& item = data.items[id];
+    BN_ASSERT(item.parent_id < 0, "Parallax cameras position can't be set");
 
-    if(item.position.x() != x)
-    {
-        item.position.set_x(x);
-        data.update = true;
-    }
+    _update_position(id, fixed_point(x, item.position.y()));
 }
 
 void set_y(int id, fixed y)
 {
-    item_type& item = data.items[id];
+    const item_type& item = data.items[id];
+    BN_ASSERT(item.parent_id < 0, "Parallax cameras position can't be set");
 
-    if(item.position.y() != y)
-    {
-        item.position.set_y(y);
-        data.update = true;
-    }
+    _update_position(id, fixed_point(item.position.x(), y));
 }
 
 void set_position(int id, const fixed_point& position)
+{
+    BN_ASSERT(data.items[id].parent_id < 0, "Parallax cameras position can't be set");
+
+    _update_position(id, position);
+}
+
+int parent_id(int id)
+{
+    const item_type& item = data.items[id];
+    return item.parent_id;
+}
+
+const fixed_point& parallax_factor(int id)
+{
+    const item_type& item = data.items[id];
+    return item.parallax_factor;
+}
+
+void set_parallax_factor(int id, const fixed_point& parallax_factor)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(item.parent_id >= 0, "Camera is not a parallax camera");
 
-    if(item.position != position)
+    if(item.parallax_factor != parallax_factor)
     {
-        item.position = position;
-        data.update = true;
+        item.parallax_factor = parallax_factor;
+        _update_position(id, _parallax_position(item));
     }
 }
 
 void update()
 {
-    if(data.update)
+    if(unsigned updated_items_mask = data.updated_items_mask)
     {
-        data.update = false;
+        data.updated_items_mask = 0;
 
-        display_manager::update_cameras();
-        sprites_manager::update_cameras();
-        bgs_manager::update_cameras();
+        display_manager::update_cameras(updated_items_mask);
+        sprites_manager::update_cameras(updated_items_mask);
+        bgs_manager::update_cameras(updated_items_mask);
     }
 }
 
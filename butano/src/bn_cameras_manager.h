@@ -21,6 +21,10 @@ namespace bn::cameras_manager
 
     [[nodiscard]] int create_optional(const fixed_point& position);
 
+    [[nodiscard]] int create_parallax(int parent_id, const fixed_point& parallax_factor);
+
+    [[nodiscard]] int create_parallax_optional(int parent_id, const fixed_point& parallax_factor);
+
     void increase_usages(int id);
 
     void decrease_usages(int id);
@@ -33,6 +37,12 @@ namespace bn::cameras_manager
 
     void set_position(int id, const fixed_point& position);
 
+    [[nodiscard]] int parent_id(int id);
+
+    [[nodiscard]] const fixed_point& parallax_factor(int id);
+
+    void set_parallax_factor(int id, const fixed_point& parallax_factor);
+
     void update();
 }
 
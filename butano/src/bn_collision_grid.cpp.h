@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_collision_grid.h"
+
+namespace bn
+{
+
+top_left_fixed_rect icollision_grid::rect(int id) const
+{
+    BN_ASSERT(contains(id), "Invalid id: ", id);
+
+    const item_type& item = _items[id];
+    return top_left_fixed_rect(fixed::from_data(item.left), fixed::from_data(item.top),
+                               fixed::from_data(item.right - item.left), fixed::from_data(item.bottom - item.top));
+}
+
+void icollision_grid::erase(int id)
+{
+    BN_ASSERT(contains(id), "Invalid id: ", id);
+
+    _unlink(id);
+
+    item_type& item = _items[id];
+    item.bucket = -1;
+    item.next = int16_t(_free_id);
+    _free_id = id;
+    --_size;
+}
+
+void icollision_grid::clear()
+{
+    item_type* items = _items;
+    int max_size = _max_size;
+
+    for(int index = 0; index < max_size; ++index)
+    {
+        item_type& item = items[index];
+        item.bucket = -1;
+        item.next = int16_t(index + 1);
+    }
+
+    int16_t* buckets = _buckets;
+
+    for(int index = 0, limit = _buckets_count; index < limit; ++index)
+    {
+        buckets[index] = -1;
+    }
+
+    _size = 0;
+    _free_id = 0;
+    _max_half_width = 0;
+    _max_half_height = 0;
+}
+
+icollision_grid::icollision_grid(item_type* items, int16_t* buckets, int max_size, int buckets_count,
+                                 int cell_size_shift) :
+    _items(items),
+    _buckets(buckets),
+    _max_size(max_size),
+    _buckets_count(buckets_count),
+    _cell_size_shift(cell_size_shift)
+{
+    clear();
+}
+
+int icollision_grid::_insert(int left, int top, int right, int bottom)
+{
+    BN_ASSERT(! full(), "Collision grid is full");
+    BN_ASSERT(left <= right && top <= bottom, "Invalid rect: ", left, " - ", top, " - ", right, " - ", bottom);
+
+    int id = _free_id;
+    item_type& item = _items[id];
+    _free_id = item.next;
+    item.left = left;
+    item.top = top;
+    item.right = right;
+    item.bottom = bottom;
+    _update_max_half_size(left, top, right, bottom);
+    _link(id);
+    ++_size;
+    return id;
+}
+
+void icollision_grid::_update(int id, int left, int top, int right, int bottom)
+{
+    BN_ASSERT(contains(id), "Invalid id: ", id);
+    BN_ASSERT(left <= right && top <= bottom, "Invalid rect: ", left, " - ", top, " - ", right, " - ", bottom);
+
+    item_type& item = _items[id];
+    item.left = left;
+    item.top = top;
+    item.right = right;
+    item.bottom = bottom;
+    _update_max_half_size(left, top, right, bottom);
+
+    int cell_size_shift = fixed::precision() + _cell_size_shift;
+    int cell_x = ((left >> 1) + (right >> 1)) >> cell_size_shift;
+    int cell_y = ((top >> 1) + (bottom >> 1)) >> cell_size_shift;
+
+    if(cell_x != item.cell_x || cell_y != item.cell_y)
+    {
+        _unlink(id);
+        _link(id);
+    }
+}
+
+void icollision_grid::_update_max_half_size(int left, int top, int right, int bottom)
+{
+    int precision = fixed::precision();
+    int rounding = (fixed::scale() * 2) - 1;
+    int half_width = (right - left + rounding) >> (precision + 1);
+    int half_height = (bottom - top + rounding) >> (precision + 1);
+
+    if(half_width > _max_half_width)
+    {
+        _max_half_width = half_width;
+    }
+
+    if(half_height > _max_half_height)
+    {
+        _max_half_height = half_height;
+    }
+}
+
+void icollision_grid::_link(int id)
+{
+    item_type* items = _items;
+    item_type& item = items[id];
+    int cell_size_shift = fixed::precision() + _cell_size_shift;
+    int cell_x = ((item.left >> 1) + (item.right >> 1)) >> cell_size_shift;
+    int cell_y = ((item.top >> 1) + (item.bottom >> 1)) >> cell_size_shift;
+    int bucket = _bucket(cell_x, cell_y);
+    int next = _buckets[bucket];
+    item.cell_x = cell_x;
+    item.cell_y = cell_y;
+    item.previous = -1;
+    item.next = int16_t(next);
+    item.bucket = int16_t(bucket);
+
+    if(next >= 0)
+    {
+        items[next].previous = int16_t(id);
+    }
+
+    _buckets[bucket] = int16_t(id);
+}
+
+void icollision_grid::_unlink(int id)
+{
+    item_type* items = _items;
+    item_type& item = items[id];
+    int previous = item.previous;
+    int next = item.next;
+
+    if(previous >= 0)
+    {
+        items[previous].next = int16_t(next);
+    }
+    else
+    {
+        _buckets[item.bucket] = int16_t(next);
+    }
+
+    if(next >= 0)
+    {
+        items[next].previous = int16_t(previous);
+    }
+}
+
+}
@@ -12,6 +12,8 @@
 #include "bn_memory.h"
 #include "bn_timers.h"
 #include "bn_profiler.h"
+#include "bn_binary_log.h"
+#include "bn_commit_phase.h"
 #include "bn_system_font.h"
 #include "bn_bgs_manager.h"
 #include "bn_hdma_manager.h"
@@ -19,6 +21,7 @@
 #include "bn_gpio_manager.h"
 #include "bn_audio_manager.h"
 #include "bn_config_assert.h"
+#include "bn_config_telemetry.h"
 #include "bn_keypad_manager.h"
 #include "bn_memory_manager.h"
 #include "bn_display_manager.h"
@@ -26,6 +29,8 @@
 #include "bn_cameras_manager.h"
 #include "bn_palettes_manager.h"
 #include "bn_bg_blocks_manager.h"
+#include "bn_frame_arena_manager.h"
+#include "bn_telemetry_manager.h"
 #include "bn_sprite_tiles_manager.h"
 #include "bn_hblank_effects_manager.h"
 #include "../hw/include/bn_hw_irq.h"
@@ -34,8 +39,11 @@
 #include "../hw/include/bn_hw_sram.h"
 #include "../hw/include/bn_hw_audio.h"
 #include "../hw/include/bn_hw_timer.h"
+#include "../hw/include/bn_hw_memory.h"
+#include "../hw/include/bn_hw_sprites.h"
 #include "../hw/include/bn_hw_game_pak.h"
 #include "../hw/include/bn_hw_hblank_effects.h"
+#include "../hw/include/bn_hw_sprites_constants.h"
 
 #if BN_CFG_ASSERT_ENABLED
     #include "bn_assert_callback_type.h"
@@ -121,6 +129,25 @@ namespace
         int missed_frames = 0;
     };
 
+    // Approximate CPU cycles needed to copy or to decompress a word to VRAM.
+    // http://problemkaputt.de/gbatek.htm#gbadmatransfers
+    constexpr int dma_copy_cycles_per_word = 6;
+    constexpr int cpu_copy_cycles_per_word = 10;
+    constexpr int big_map_copy_cycles_per_word = 16;
+    constexpr int decompress_cycles_per_word = 48;
+
+    constexpr int commit_phases_count = int(commit_phase::COMPRESSED) + 1;
+
+    class commit_phase_data
+    {
+
+    public:
+        int estimated_ticks = 0;
+        int ticks = 0;
+        int bytes = 0;
+        bool deferred = false;
+    };
+
     class static_data
     {
 
@@ -131,11 +158,15 @@ namespace
         #endif
         timer cpu_usage_timer;
         ticks last_ticks;
+        commit_phase_data commit_phases[commit_phases_count];
         bn::system_font system_font;
         string_view assert_tag = BN_CFG_ASSERT_TAG;
         int skip_frames = 0;
         int last_update_frames = 1;
         int missed_frames = 0;
+        int commit_budget_ticks = timers::ticks_per_vblank();
+        int vblank_overruns = 0;
+        bool commit_budget_enabled = false;
         bool dma_enabled = hw::audio::dma_channel_free(3);
         bool slow_game_pak = false;
         volatile bool waiting_for_vblank = false;
@@ -143,6 +174,53 @@ namespace
 
     BN_DATA_EWRAM_BSS static_data data;
 
+    [[nodiscard]] constexpr int _commit_ticks(int bytes, int cycles_per_word)
+    {
+        return ((bytes / 4) * cycles_per_word) / timers::cpu_clocks_per_tick();
+    }
+
+    [[nodiscard]] bool _last_commit_deferred()
+    {
+        for(const commit_phase_data& phase_data : data.commit_phases)
+        {
+            if(phase_data.deferred)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool _defer_commit_group(int uploads_ticks, int group_ticks, int& available_ticks)
+    {
+        if(uploads_ticks && group_ticks > available_ticks)
+        {
+            return true;
+        }
+
+        available_ticks -= group_ticks;
+        return false;
+    }
+
+    void _set_commit_phase_deferred(commit_phase phase, int deferred_bytes, int estimated_ticks)
+    {
+        commit_phase_data& phase_data = data.commit_phases[int(phase)];
+        phase_data.estimated_ticks = estimated_ticks;
+        phase_data.ticks = 0;
+        phase_data.bytes = 0;
+        phase_data.deferred = deferred_bytes > 0;
+    }
+
+    void _set_commit_phase_ticks(commit_phase phase, int bytes, int estimated_ticks, int start_ticks)
+    {
+        commit_phase_data& phase_data = data.commit_phases[int(phase)];
+        phase_data.estimated_ticks = estimated_ticks;
+        phase_data.ticks = data.cpu_usage_timer.elapsed_ticks() - start_ticks;
+        phase_data.bytes = bytes;
+        phase_data.deferred = false;
+    }
+
     void enable()
     {
         hblank_effects_manager::enable();
@@ -229,6 +307,10 @@ namespace
         BN_BARRIER;
         result.cpu_usage_ticks = data.cpu_usage_timer.elapsed_ticks();
 
+        #if BN_CFG_LOG_ENABLED
+            binary_log::flush(BN_CFG_LOG_BINARY_FLUSH_MAX_RECORDS);
+        #endif
+
         BN_BARRIER;
         data.waiting_for_vblank = true;
 
@@ -251,24 +333,119 @@ namespace
         audio_manager::execute_commands();
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
+        int copy_cycles_per_word = use_dma ? dma_copy_cycles_per_word : cpu_copy_cycles_per_word;
+        int sprite_palettes_bytes = palettes_manager::sprites_commit_bytes();
+        int bg_palettes_bytes = palettes_manager::bgs_commit_bytes();
+        int sprite_tiles_bytes = sprite_tiles_manager::uncompressed_commit_bytes();
+        int compressed_sprite_tiles_bytes = sprite_tiles_manager::compressed_commit_bytes();
+        int big_maps_bytes = bgs_manager::big_maps_commit_bytes();
+        int bg_blocks_bytes = bg_blocks_manager::uncompressed_commit_bytes();
+        int compressed_bg_blocks_bytes = bg_blocks_manager::compressed_commit_bytes();
+        int sprites_bytes = hw::sprites::count() * int(sizeof(hw::sprites::handle_type));
+        int sprites_estimated_ticks = _commit_ticks(sprites_bytes, copy_cycles_per_word);
+        bool sprites_deferred = false;
+        bool bgs_deferred = false;
+
+        // Uploads are deferred with the registers and palettes which reference them,
+        // so deferred graphics are displayed one frame late, but never mixed with the ones of the previous frame.
+        // A commit is never deferred if the last one was, so the deferred graphics can't starve:
+        if(data.commit_budget_enabled && ! _last_commit_deferred())
+        {
+            int available_ticks = data.commit_budget_ticks - data.cpu_usage_timer.elapsed_ticks();
+            int sprite_uploads_ticks = _commit_ticks(sprite_tiles_bytes, copy_cycles_per_word) +
+                    _commit_ticks(compressed_sprite_tiles_bytes, decompress_cycles_per_word);
+            int sprites_ticks = sprite_uploads_ticks + sprites_estimated_ticks +
+                    _commit_ticks(sprite_palettes_bytes, copy_cycles_per_word);
+            sprites_deferred = _defer_commit_group(sprite_uploads_ticks, sprites_ticks, available_ticks);
+
+            int bg_uploads_ticks = _commit_ticks(big_maps_bytes, big_map_copy_cycles_per_word) +
+                    _commit_ticks(bg_blocks_bytes, copy_cycles_per_word) +
+                    _commit_ticks(compressed_bg_blocks_bytes, decompress_cycles_per_word);
+            int bgs_ticks = bg_uploads_ticks + _commit_ticks(bg_palettes_bytes, copy_cycles_per_word);
+            bgs_deferred = _defer_commit_group(bg_uploads_ticks, bgs_ticks, available_ticks);
+        }
+
         BN_PROFILER_ENGINE_DETAILED_START("eng_display_commit");
-        display_manager::commit();
+        if(! sprites_deferred && ! bgs_deferred)
+        {
+            display_manager::commit();
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_sprites_commit");
-        sprites_manager::commit(use_dma);
+        int phase_start_ticks = data.cpu_usage_timer.elapsed_ticks();
+
+        if(sprites_deferred)
+        {
+            _set_commit_phase_deferred(commit_phase::SPRITES, sprites_bytes, sprites_estimated_ticks);
+        }
+        else
+        {
+            sprites_manager::commit(use_dma);
+
+            int commit_bytes = sprites_manager::committed_bytes();
+            _set_commit_phase_ticks(commit_phase::SPRITES, commit_bytes,
+                                    _commit_ticks(commit_bytes, copy_cycles_per_word), phase_start_ticks);
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bgs_commit");
-        bgs_manager::commit(use_dma);
+        if(! bgs_deferred)
+        {
+            bgs_manager::commit(use_dma);
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_palettes_commit");
-        palettes_manager::commit(use_dma);
+        int commit_bytes = 0;
+        int deferred_bytes = 0;
+        int estimated_ticks = _commit_ticks(sprite_palettes_bytes + bg_palettes_bytes, copy_cycles_per_word);
+        phase_start_ticks = data.cpu_usage_timer.elapsed_ticks();
+
+        if(sprites_deferred)
+        {
+            deferred_bytes += sprite_palettes_bytes;
+        }
+        else
+        {
+            palettes_manager::commit_sprites(use_dma);
+            commit_bytes += sprite_palettes_bytes;
+        }
+
+        if(bgs_deferred)
+        {
+            deferred_bytes += bg_palettes_bytes;
+        }
+        else
+        {
+            palettes_manager::commit_bgs(use_dma);
+            commit_bytes += bg_palettes_bytes;
+        }
+
+        if(deferred_bytes)
+        {
+            _set_commit_phase_deferred(commit_phase::PALETTES, deferred_bytes, estimated_ticks);
+        }
+        else
+        {
+            _set_commit_phase_ticks(commit_phase::PALETTES, commit_bytes, estimated_ticks, phase_start_ticks);
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_unc_commit");
-        sprite_tiles_manager::commit_uncompressed(use_dma);
+        estimated_ticks = _commit_ticks(sprite_tiles_bytes, copy_cycles_per_word);
+
+        if(sprites_deferred)
+        {
+            _set_commit_phase_deferred(commit_phase::SPRITE_TILES, sprite_tiles_bytes, estimated_ticks);
+        }
+        else
+        {
+            phase_start_ticks = data.cpu_usage_timer.elapsed_ticks();
+            sprite_tiles_manager::commit_uncompressed(use_dma);
+            _set_commit_phase_ticks(commit_phase::SPRITE_TILES, sprite_tiles_bytes, estimated_ticks,
+                                    phase_start_ticks);
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_hdma_update");
@@ -284,22 +461,76 @@ namespace
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_big_maps_commit");
-        bgs_manager::commit_big_maps();
+        estimated_ticks = _commit_ticks(big_maps_bytes, big_map_copy_cycles_per_word);
+
+        if(bgs_deferred)
+        {
+            _set_commit_phase_deferred(commit_phase::BIG_MAPS, big_maps_bytes, estimated_ticks);
+        }
+        else
+        {
+            phase_start_ticks = data.cpu_usage_timer.elapsed_ticks();
+            bgs_manager::commit_big_maps();
+            _set_commit_phase_ticks(commit_phase::BIG_MAPS, big_maps_bytes, estimated_ticks, phase_start_ticks);
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         use_dma = use_dma && ! hdma_running && ! hblank_effects_running;
+        copy_cycles_per_word = use_dma ? dma_copy_cycles_per_word : cpu_copy_cycles_per_word;
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bg_blocks_unc_commit");
-        bg_blocks_manager::commit_uncompressed(use_dma);
-        BN_PROFILER_ENGINE_DETAILED_STOP();
+        estimated_ticks = _commit_ticks(bg_blocks_bytes, copy_cycles_per_word);
 
-        BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_cmp_commit");
-        sprite_tiles_manager::commit_compressed();
+        if(bgs_deferred)
+        {
+            _set_commit_phase_deferred(commit_phase::BG_BLOCKS, bg_blocks_bytes, estimated_ticks);
+        }
+        else
+        {
+            phase_start_ticks = data.cpu_usage_timer.elapsed_ticks();
+            bg_blocks_manager::commit_uncompressed(use_dma);
+            _set_commit_phase_ticks(commit_phase::BG_BLOCKS, bg_blocks_bytes, estimated_ticks, phase_start_ticks);
+        }
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
-        BN_PROFILER_ENGINE_DETAILED_START("eng_bg_blocks_cmp_commit");
-        bg_blocks_manager::commit_compressed();
-        BN_PROFILER_ENGINE_DETAILED_STOP();
+        commit_bytes = 0;
+        deferred_bytes = 0;
+        estimated_ticks = _commit_ticks(compressed_sprite_tiles_bytes + compressed_bg_blocks_bytes,
+                                        decompress_cycles_per_word);
+        phase_start_ticks = data.cpu_usage_timer.elapsed_ticks();
+
+        if(sprites_deferred)
+        {
+            deferred_bytes += compressed_sprite_tiles_bytes;
+        }
+        else
+        {
+            BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_cmp_commit");
+            sprite_tiles_manager::commit_compressed();
+            commit_bytes += compressed_sprite_tiles_bytes;
+            BN_PROFILER_ENGINE_DETAILED_STOP();
+        }
+
+        if(bgs_deferred)
+        {
+            deferred_bytes += compressed_bg_blocks_bytes;
+        }
+        else
+        {
+            BN_PROFILER_ENGINE_DETAILED_START("eng_bg_blocks_cmp_commit");
+            bg_blocks_manager::commit_compressed();
+            commit_bytes += compressed_bg_blocks_bytes;
+            BN_PROFILER_ENGINE_DETAILED_STOP();
+        }
+
+        if(deferred_bytes)
+        {
+            _set_commit_phase_deferred(commit_phase::COMPRESSED, deferred_bytes, estimated_ticks);
+        }
+        else
+        {
+            _set_commit_phase_ticks(commit_phase::COMPRESSED, commit_bytes, estimated_ticks, phase_start_ticks);
+        }
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_vblank_callback");
         if(vblank_callback_type vblank_callback = data.vblank_callback)
@@ -310,6 +541,11 @@ namespace
 
         result.vblank_usage_ticks = data.cpu_usage_timer.elapsed_ticks();
 
+        if(result.vblank_usage_ticks > timers::ticks_per_vblank())
+        {
+            ++data.vblank_overruns;
+        }
+
         BN_PROFILER_ENGINE_DETAILED_START("eng_audio_commit");
         audio_manager::delayed_commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
@@ -372,6 +608,19 @@ void init(const optional<color>& transparent_color, const string_view& keypad_co
     // Init heap:
     memory_manager::init();
 
+    // Init frame arenas:
+    frame_arena_manager::init();
+
+    #if BN_CFG_LOG_ENABLED
+        // Init binary log:
+        _bn::binary_log::init();
+    #endif
+
+    #if BN_CFG_TELEMETRY_ENABLED
+        // Init telemetry:
+        telemetry_manager::init();
+    #endif
+
     // Init H-Blank effects system:
     hblank_effects_manager::init();
 
@@ -468,6 +717,12 @@ void update()
     BN_PROFILER_ENGINE_DETAILED_START("eng_keypad");
     keypad_manager::update();
     BN_PROFILER_ENGINE_DETAILED_STOP();
+
+    frame_arena_manager::update();
+
+    #if BN_CFG_TELEMETRY_ENABLED
+        telemetry_manager::update();
+    #endif
 }
 
 void sleep(keypad::key_type wake_up_key)
@@ -569,6 +824,71 @@ int last_missed_frames()
     return data.last_ticks.missed_frames;
 }
 
+bool commit_budget_enabled()
+{
+    return data.commit_budget_enabled;
+}
+
+void set_commit_budget_enabled(bool enabled)
+{
+    data.commit_budget_enabled = enabled;
+}
+
+int commit_budget_ticks()
+{
+    return data.commit_budget_ticks;
+}
+
+void set_commit_budget_ticks(int commit_budget_ticks)
+{
+    BN_ASSERT(commit_budget_ticks > 0, "Invalid commit budget ticks: ", commit_budget_ticks);
+
+    data.commit_budget_ticks = commit_budget_ticks;
+}
+
+bool last_commit_deferred()
+{
+    return _last_commit_deferred();
+}
+
+bool last_commit_deferred(commit_phase phase)
+{
+    BN_ASSERT(int(phase) < commit_phases_count, "Invalid commit phase: ", int(phase));
+
+    return data.commit_phases[int(phase)].deferred;
+}
+
+int last_commit_estimated_ticks(commit_phase phase)
+{
+    BN_ASSERT(int(phase) < commit_phases_count, "Invalid commit phase: ", int(phase));
+
+    return data.commit_phases[int(phase)].estimated_ticks;
+}
+
+int last_commit_ticks(commit_phase phase)
+{
+    BN_ASSERT(int(phase) < commit_phases_count, "Invalid commit phase: ", int(phase));
+
+    return data.commit_phases[int(phase)].ticks;
+}
+
+int last_commit_bytes(commit_phase phase)
+{
+    BN_ASSERT(int(phase) < commit_phases_count, "Invalid commit phase: ", int(phase));
+
+    return data.commit_phases[int(phase)].bytes;
+}
+
+int vblank_overruns()
+{
+    return data.vblank_overruns;
+}
+
+void reset_vblank_overruns()
+{
+    data.vblank_overruns = 0;
+}
+
 vblank_callback_type vblank_callback()
 {
     return data.vblank_callback;
@@ -669,6 +989,7 @@ void set_dma_enabled(bool dma_enabled)
     BN_BASIC_ASSERT(hw::audio::dma_channel_free(3) || ! dma_enabled, "Not supported by the audio backend");
 
     core::data.dma_enabled = dma_enabled;
+    hw::memory::set_dma_copy_enabled(dma_enabled);
 }
 
 }
@@ -700,6 +1021,10 @@ void set_dma_enabled(bool dma_enabled)
                     assert_callback();
                 }
 
+                #if BN_CFG_LOG_ENABLED
+                    bn::binary_log::flush();
+                #endif
+
                 bn::core::stop(false);
                 bn::hw::show::error(bn::core::system_font(), condition, file_name, function, line, message,
                                     bn::core::assert_tag());
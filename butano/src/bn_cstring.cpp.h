@@ -36,4 +36,13 @@ void memclear(void* destination, int bytes)
     hw::memory::set_bytes(0, bytes, destination);
 }
 
+int memcmp(const void* lhs, const void* rhs, int bytes)
+{
+    BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+    BN_BASIC_ASSERT(lhs, "Lhs is null");
+    BN_BASIC_ASSERT(rhs, "Rhs is null");
+
+    return hw::memory::compare_bytes(lhs, rhs, bytes);
+}
+
 }
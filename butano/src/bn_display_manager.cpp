@@ -914,11 +914,13 @@ void fill_green_swap_hblank_effect_states(const bool* states_ptr, uint16_t* dest
     }
 }
 
-void update_cameras()
+void update_cameras(unsigned cameras_mask)
 {
     for(int index = 0, limit = hw::display::rect_windows_count(); index < limit; ++index)
     {
-        if(data.rect_windows_camera[index])
+        const camera_ptr* camera = data.rect_windows_camera[index].get();
+
+        if(camera && (cameras_mask & (1U << camera->id())))
         {
             int boundaries_index = index * 2;
             _update_rect_windows_hw_boundaries(boundaries_index);
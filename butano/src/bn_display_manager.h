@@ -181,7 +181,7 @@ namespace bn::display_manager
 
     void fill_green_swap_hblank_effect_states(const bool* states_ptr, uint16_t* dest_ptr);
 
-    void update_cameras();
+    void update_cameras(unsigned cameras_mask);
 
     void update();
 
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_format_to.h"
+
+namespace _bn::format_to
+{
+
+namespace
+{
+    constexpr int max_digits = 20;
+
+    constexpr const char digit_pairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+    constexpr const unsigned decimal_scales[] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+    };
+
+    // Digits are written backwards, two at a time, to halve the number of divisions:
+    [[nodiscard]] char* _write_digits(unsigned value, char* output_end)
+    {
+        while(value >= 100)
+        {
+            unsigned pair_index = (value % 100) * 2;
+            value /= 100;
+            output_end -= 2;
+            output_end[0] = digit_pairs[pair_index];
+            output_end[1] = digit_pairs[pair_index + 1];
+        }
+
+        if(value >= 10)
+        {
+            unsigned pair_index = value * 2;
+            output_end -= 2;
+            output_end[0] = digit_pairs[pair_index];
+            output_end[1] = digit_pairs[pair_index + 1];
+        }
+        else
+        {
+            --output_end;
+            *output_end = char('0' + value);
+        }
+
+        return output_end;
+    }
+
+    [[nodiscard]] char* _write_digits(unsigned value, int digits, char* output_end)
+    {
+        char* output = _write_digits(value, output_end);
+        char* output_begin = output_end - digits;
+
+        while(output > output_begin)
+        {
+            --output;
+            *output = '0';
+        }
+
+        return output;
+    }
+
+    [[nodiscard]] char* _write_digits(uint64_t value, char* output_end)
+    {
+        // 64-bit divisions are slow, so they are done once per nine digits:
+        while(value > 0xFFFFFFFF)
+        {
+            auto low_value = unsigned(value % 1000000000);
+            value /= 1000000000;
+            output_end = _write_digits(low_value, 9, output_end);
+        }
+
+        return _write_digits(unsigned(value), output_end);
+    }
+
+    [[nodiscard]] int _write(bn::span<char> output, const char* digits, int digits_size, bool negative, int width,
+                             char fill)
+    {
+        BN_ASSERT(width >= 0, "Invalid width: ", width);
+
+        int sign_size = negative;
+        int size = bn::max(digits_size + sign_size, width);
+        BN_ASSERT(size <= output.size(), "Output is too small: ", size, " - ", output.size());
+
+        char* output_data = output.data();
+        int padding = size - digits_size - sign_size;
+
+        if(fill == '0')
+        {
+            if(negative)
+            {
+                *output_data = '-';
+                ++output_data;
+            }
+
+            for(int index = 0; index < padding; ++index)
+            {
+                output_data[index] = fill;
+            }
+
+            output_data += padding;
+        }
+        else
+        {
+            for(int index = 0; index < padding; ++index)
+            {
+                output_data[index] = fill;
+            }
+
+            output_data += padding;
+
+            if(negative)
+            {
+                *output_data = '-';
+                ++output_data;
+            }
+        }
+
+        for(int index = 0; index < digits_size; ++index)
+        {
+            output_data[index] = digits[index];
+        }
+
+        return size;
+    }
+}
+
+int integer(bn::span<char> output, unsigned value, bool negative, int width, char fill)
+{
+    char buffer[max_digits];
+    char* buffer_end = buffer + max_digits;
+    char* digits = _write_digits(value, buffer_end);
+    return _write(output, digits, buffer_end - digits, negative, width, fill);
+}
+
+int integer(bn::span<char> output, uint64_t value, bool negative, int width, char fill)
+{
+    char buffer[max_digits];
+    char* buffer_end = buffer + max_digits;
+    char* digits = _write_digits(value, buffer_end);
+    return _write(output, digits, buffer_end - digits, negative, width, fill);
+}
+
+int fixed(bn::span<char> output, int data, int precision, int decimals, int width, char fill)
+{
+    BN_ASSERT(decimals >= 0 && decimals <= 9, "Invalid decimals: ", decimals);
+
+    bool negative = data < 0;
+    unsigned abs_data = negative ? 0U - unsigned(data) : unsigned(data);
+    unsigned integer_value = abs_data >> precision;
+    unsigned fraction_value = abs_data & ((1U << precision) - 1);
+    char buffer[max_digits];
+    char* buffer_end = buffer + max_digits;
+    char* digits = buffer_end;
+
+    if(decimals)
+    {
+        auto fraction_digits = unsigned((uint64_t(fraction_value) * decimal_scales[decimals]) >> precision);
+        digits = _write_digits(fraction_digits, decimals, digits);
+        --digits;
+        *digits = '.';
+
+        if(! integer_value && ! fraction_digits)
+        {
+            negative = false;
+        }
+    }
+    else if(! integer_value)
+    {
+        negative = false;
+    }
+
+    digits = _write_digits(integer_value, digits);
+    return _write(output, digits, buffer_end - digits, negative, width, fill);
+}
+
+}
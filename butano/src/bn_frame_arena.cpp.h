@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_frame_arena.h"
+
+#include "bn_frame_arena_manager.h"
+
+namespace bn::frame_arena
+{
+
+void* ewram_alloc(int bytes)
+{
+    return frame_arena_manager::ewram_alloc(bytes);
+}
+
+int used_ewram()
+{
+    return frame_arena_manager::used_ewram();
+}
+
+int available_ewram()
+{
+    return frame_arena_manager::available_ewram();
+}
+
+int frame_peak_ewram()
+{
+    return frame_arena_manager::frame_peak_ewram();
+}
+
+int last_frame_peak_ewram()
+{
+    return frame_arena_manager::last_frame_peak_ewram();
+}
+
+int peak_ewram()
+{
+    return frame_arena_manager::peak_ewram();
+}
+
+void* iwram_alloc(int bytes)
+{
+    return frame_arena_manager::iwram_alloc(bytes);
+}
+
+int used_iwram()
+{
+    return frame_arena_manager::used_iwram();
+}
+
+int available_iwram()
+{
+    return frame_arena_manager::available_iwram();
+}
+
+int frame_peak_iwram()
+{
+    return frame_arena_manager::frame_peak_iwram();
+}
+
+int last_frame_peak_iwram()
+{
+    return frame_arena_manager::last_frame_peak_iwram();
+}
+
+int peak_iwram()
+{
+    return frame_arena_manager::peak_iwram();
+}
+
+void reset_peaks()
+{
+    frame_arena_manager::reset_peaks();
+}
+
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_frame_arena_manager.h"
+
+#include "bn_assert.h"
+#include "bn_algorithm.h"
+#include "bn_config_frame_arena.h"
+
+#include "bn_frame_arena.cpp.h"
+#include "bn_scoped_scratch.cpp.h"
+
+namespace bn::frame_arena_manager
+{
+
+namespace
+{
+    class arena
+    {
+
+    public:
+        int used = 0;
+        int frame_peak = 0;
+        int last_frame_peak = 0;
+        int peak = 0;
+
+        [[nodiscard]] void* alloc(int bytes, int capacity, int* buffer)
+        {
+            BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+            int aligned_bytes = (bytes + 3) & ~3;
+            int new_used = used + aligned_bytes;
+            BN_ASSERT(new_used <= capacity, "Frame arena overflow: ", bytes, " - ", capacity - used,
+                      "\nPeak usage: ", bn::max(peak, new_used), " - ", capacity);
+
+            void* result = buffer + (used / 4);
+            _set_used(new_used);
+            return result;
+        }
+
+        void release(int mark)
+        {
+            BN_ASSERT(mark <= used, "Invalid mark: ", mark, " - ", used);
+
+            used = mark;
+        }
+
+        void reset()
+        {
+            last_frame_peak = frame_peak;
+            used = 0;
+            frame_peak = 0;
+        }
+
+    private:
+        void _set_used(int new_used)
+        {
+            used = new_used;
+            frame_peak = bn::max(frame_peak, new_used);
+            peak = bn::max(peak, new_used);
+        }
+    };
+
+
+    class static_data
+    {
+
+    public:
+        arena ewram_arena;
+        arena iwram_arena;
+        int scratch_depth = 0;
+    };
+
+    BN_DATA_EWRAM_BSS static_data data;
+
+    #if BN_CFG_FRAME_ARENA_EWRAM_SIZE
+        BN_DATA_EWRAM_BSS int ewram_buffer[BN_CFG_FRAME_ARENA_EWRAM_SIZE / 4];
+    #endif
+
+    #if BN_CFG_FRAME_ARENA_IWRAM_SIZE
+        int iwram_buffer[BN_CFG_FRAME_ARENA_IWRAM_SIZE / 4];
+    #endif
+}
+
+void init()
+{
+    ::new(static_cast<void*>(&data)) static_data();
+}
+
+void* ewram_alloc([[maybe_unused]] int bytes)
+{
+    #if BN_CFG_FRAME_ARENA_EWRAM_SIZE
+        return data.ewram_arena.alloc(bytes, BN_CFG_FRAME_ARENA_EWRAM_SIZE, ewram_buffer);
+    #else
+        BN_ERROR("EWRAM frame arena is disabled.\nSet BN_CFG_FRAME_ARENA_EWRAM_SIZE to enable it");
+
+        return nullptr;
+    #endif
+}
+
+void* iwram_alloc([[maybe_unused]] int bytes)
+{
+    #if BN_CFG_FRAME_ARENA_IWRAM_SIZE
+        return data.iwram_arena.alloc(bytes, BN_CFG_FRAME_ARENA_IWRAM_SIZE, iwram_buffer);
+    #else
+        BN_ERROR("IWRAM frame arena is disabled.\nSet BN_CFG_FRAME_ARENA_IWRAM_SIZE to enable it");
+
+        return nullptr;
+    #endif
+}
+
+int used_ewram()
+{
+    return data.ewram_arena.used;
+}
+
+int used_iwram()
+{
+    return data.iwram_arena.used;
+}
+
+int available_ewram()
+{
+    return BN_CFG_FRAME_ARENA_EWRAM_SIZE - data.ewram_arena.used;
+}
+
+int available_iwram()
+{
+    return BN_CFG_FRAME_ARENA_IWRAM_SIZE - data.iwram_arena.used;
+}
+
+int frame_peak_ewram()
+{
+    return data.ewram_arena.frame_peak;
+}
+
+int frame_peak_iwram()
+{
+    return data.iwram_arena.frame_peak;
+}
+
+int last_frame_peak_ewram()
+{
+    return data.ewram_arena.last_frame_peak;
+}
+
+int last_frame_peak_iwram()
+{
+    return data.iwram_arena.last_frame_peak;
+}
+
+int peak_ewram()
+{
+    return data.ewram_arena.peak;
+}
+
+int peak_iwram()
+{
+    return data.iwram_arena.peak;
+}
+
+void reset_peaks()
+{
+    data.ewram_arena.peak = data.ewram_arena.used;
+    data.iwram_arena.peak = data.iwram_arena.used;
+}
+
+int push_scratch()
+{
+    return ++data.scratch_depth;
+}
+
+void pop_scratch(int depth, int ewram_mark, int iwram_mark)
+{
+    BN_BASIC_ASSERT(depth == data.scratch_depth, "Scratches must be destroyed in reverse order of creation");
+
+    data.ewram_arena.release(ewram_mark);
+    data.iwram_arena.release(iwram_mark);
+    --data.scratch_depth;
+}
+
+void update()
+{
+    BN_BASIC_ASSERT(! data.scratch_depth, "Scratches must be destroyed before the end of the frame");
+
+    data.ewram_arena.reset();
+    data.iwram_arena.reset();
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FRAME_ARENA_MANAGER_H
+#define BN_FRAME_ARENA_MANAGER_H
+
+#include "bn_common.h"
+
+namespace bn::frame_arena_manager
+{
+    void init();
+
+    [[nodiscard]] void* ewram_alloc(int bytes);
+
+    [[nodiscard]] void* iwram_alloc(int bytes);
+
+    [[nodiscard]] int used_ewram();
+
+    [[nodiscard]] int used_iwram();
+
+    [[nodiscard]] int available_ewram();
+
+    [[nodiscard]] int available_iwram();
+
+    [[nodiscard]] int frame_peak_ewram();
+
+    [[nodiscard]] int frame_peak_iwram();
+
+    [[nodiscard]] int last_frame_peak_ewram();
+
+    [[nodiscard]] int last_frame_peak_iwram();
+
+    [[nodiscard]] int peak_ewram();
+
+    [[nodiscard]] int peak_iwram();
+
+    void reset_peaks();
+
+    [[nodiscard]] int push_scratch();
+
+    void pop_scratch(int depth, int ewram_mark, int iwram_mark);
+
+    void update();
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_items_registry.h"
+
+#include "bn_algorithm.h"
+
+namespace bn
+{
+
+int items_registry_find(const span<const items_registry_entry>& entries, const string_view& name)
+{
+    unsigned name_hash = hash<string_view>()(name);
+    auto it = lower_bound(entries.begin(), entries.end(), name_hash,
+                          [](const items_registry_entry& entry, unsigned value)
+    {
+        return entry.name_hash() < value;
+    });
+
+    // Different names can have the same hash:
+    while(it != entries.end() && it->name_hash() == name_hash)
+    {
+        if(it->name() == name)
+        {
+            return it->index();
+        }
+
+        ++it;
+    }
+
+    return -1;
+}
+
+}
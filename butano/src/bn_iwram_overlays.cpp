@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_iwram_overlays.h"
+
+#include "bn_assert.h"
+#include "../hw/include/bn_hw_memory.h"
+#include "../hw/include/bn_hw_iwram_overlays.h"
+
+namespace bn::iwram_overlays
+{
+
+static_assert(count() == hw::iwram_overlays::count);
+
+namespace
+{
+    int loaded_index = -1;
+}
+
+int size(int index)
+{
+    BN_ASSERT(index >= 0 && index < count(), "Invalid index: ", index);
+
+    return hw::iwram_overlays::size(index);
+}
+
+int region_size()
+{
+    return hw::iwram_overlays::region_size();
+}
+
+optional<int> loaded()
+{
+    optional<int> result;
+
+    if(loaded_index >= 0)
+    {
+        result = loaded_index;
+    }
+
+    return result;
+}
+
+void load(int index)
+{
+    BN_ASSERT(index >= 0 && index < count(), "Invalid index: ", index);
+
+    if(index != loaded_index)
+    {
+        int bytes = hw::iwram_overlays::size(index);
+        BN_ASSERT(bytes <= hw::iwram_overlays::region_size(),
+                  "Overlay doesn't fit in region: ", bytes, " - ", hw::iwram_overlays::region_size());
+
+        if(bytes)
+        {
+            hw::memory::copy_bytes(hw::iwram_overlays::load_start(index), bytes,
+                                   hw::iwram_overlays::region_start());
+        }
+
+        loaded_index = index;
+    }
+}
+
+void unload()
+{
+    loaded_index = -1;
+}
+
+}
@@ -9,6 +9,7 @@
 #include "bn_memory_manager.h"
 #include "../hw/include/bn_hw_memory.h"
 #include "../hw/include/bn_hw_decompress.h"
+#include "../hw/include/bn_hw_iwram_overlays.h"
 
 void* operator new(unsigned bytes)
 {
@@ -148,6 +149,43 @@ void log_alloc_ewram_status()
     #endif
 }
 
+void* iwram_alloc(int bytes)
+{
+    return memory_manager::iwram_alloc(bytes);
+}
+
+void* iwram_calloc(int num, int bytes)
+{
+    return memory_manager::iwram_calloc(num, bytes);
+}
+
+void* iwram_realloc(void* ptr, int new_bytes)
+{
+    return memory_manager::iwram_realloc(ptr, new_bytes);
+}
+
+void iwram_free(void* ptr)
+{
+    memory_manager::iwram_free(ptr);
+}
+
+int used_alloc_iwram()
+{
+    return memory_manager::used_alloc_iwram();
+}
+
+int available_alloc_iwram()
+{
+    return memory_manager::available_alloc_iwram();
+}
+
+void log_alloc_iwram_status()
+{
+    #if BN_CFG_LOG_ENABLED
+        memory_manager::log_alloc_iwram_status();
+    #endif
+}
+
 int used_stack_iwram()
 {
     return hw::memory::used_stack_iwram(hw::memory::stack_address());
@@ -158,6 +196,11 @@ int used_static_iwram()
     return hw::memory::used_static_iwram();
 }
 
+int used_overlays_iwram()
+{
+    return hw::iwram_overlays::region_size();
+}
+
 int used_static_ewram()
 {
     return hw::memory::used_static_ewram();
@@ -230,6 +273,13 @@ void decompress(compression_type compression, const void* source_ptr, int bytes,
         hw::decompress::huff(source_ptr, destination_ptr);
         break;
 
+    case compression_type::FAST_LZ:
+        BN_ASSERT(aligned<4>(source_ptr), "Source is not aligned");
+        BN_ASSERT(aligned<4>(destination_ptr), "Destination is not aligned");
+
+        hw::decompress::fast_lz(source_ptr, destination_ptr);
+        break;
+
     default:
         BN_ERROR("Unknown compression type: ", int(compression));
         break;
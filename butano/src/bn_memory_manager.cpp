@@ -5,9 +5,15 @@
 
 #include "bn_memory_manager.h"
 
-#include "bn_best_fit_allocator.h"
+#include "bn_config_memory.h"
 #include "../hw/include/bn_hw_memory.h"
 
+#if BN_CFG_MEMORY_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_BEST_FIT
+    #include "bn_best_fit_allocator.h"
+#else
+    #include "bn_tlsf_allocator.h"
+#endif
+
 #include "bn_memory.cpp.h"
 #include "bn_cstdlib.cpp.h"
 #include "bn_cstring.cpp.h"
@@ -17,14 +23,37 @@ namespace bn::memory_manager
 
 namespace
 {
+    #if BN_CFG_MEMORY_EWRAM_ALLOCATOR == BN_EWRAM_ALLOCATOR_BEST_FIT
+        using allocator_type = best_fit_allocator;
+    #else
+        using allocator_type = tlsf_allocator;
+    #endif
+
+    constexpr int iwram_heap_words = BN_CFG_MEMORY_IWRAM_HEAP_SIZE / int(sizeof(int));
+
     class static_data
     {
 
     public:
-        best_fit_allocator allocator;
+        allocator_type allocator;
+        allocator_type iwram_allocator;
+        #if BN_CFG_TELEMETRY_ENABLED
+            int alloc_operations = 0;
+        #endif
     };
 
     BN_DATA_EWRAM_BSS static_data data;
+
+    #if BN_CFG_MEMORY_IWRAM_HEAP_SIZE
+        int iwram_heap[iwram_heap_words];
+    #endif
+
+    void _add_alloc_operation()
+    {
+        #if BN_CFG_TELEMETRY_ENABLED
+            ++data.alloc_operations;
+        #endif
+    }
 }
 
 void init()
@@ -34,25 +63,33 @@ void init()
     char* start = hw::memory::ewram_heap_start();
     char* end = hw::memory::ewram_heap_end();
     data.allocator.reset(static_cast<void*>(start), end - start);
+
+    #if BN_CFG_MEMORY_IWRAM_HEAP_SIZE
+        data.iwram_allocator.reset(static_cast<void*>(iwram_heap), BN_CFG_MEMORY_IWRAM_HEAP_SIZE);
+    #endif
 }
 
 void* ewram_alloc(int bytes)
 {
+    _add_alloc_operation();
     return data.allocator.alloc(bytes);
 }
 
 void* ewram_calloc(int num, int bytes)
 {
+    _add_alloc_operation();
     return data.allocator.calloc(num, bytes);
 }
 
 void* ewram_realloc(void* ptr, int new_bytes)
 {
+    _add_alloc_operation();
     return data.allocator.realloc(ptr, new_bytes);
 }
 
 void ewram_free(void* ptr)
 {
+    _add_alloc_operation();
     return data.allocator.free(ptr);
 }
 
@@ -66,11 +103,57 @@ int available_alloc_ewram()
     return data.allocator.available_bytes();
 }
 
+void* iwram_alloc(int bytes)
+{
+    _add_alloc_operation();
+    return data.iwram_allocator.alloc(bytes);
+}
+
+void* iwram_calloc(int num, int bytes)
+{
+    _add_alloc_operation();
+    return data.iwram_allocator.calloc(num, bytes);
+}
+
+void* iwram_realloc(void* ptr, int new_bytes)
+{
+    _add_alloc_operation();
+    return data.iwram_allocator.realloc(ptr, new_bytes);
+}
+
+void iwram_free(void* ptr)
+{
+    _add_alloc_operation();
+    return data.iwram_allocator.free(ptr);
+}
+
+int used_alloc_iwram()
+{
+    return data.iwram_allocator.used_bytes();
+}
+
+int available_alloc_iwram()
+{
+    return data.iwram_allocator.available_bytes();
+}
+
+#if BN_CFG_TELEMETRY_ENABLED
+    int alloc_operations()
+    {
+        return data.alloc_operations;
+    }
+#endif
+
 #if BN_CFG_LOG_ENABLED
     void log_alloc_ewram_status()
     {
         data.allocator.log_status();
     }
+
+    void log_alloc_iwram_status()
+    {
+        data.iwram_allocator.log_status();
+    }
 #endif
 
 }
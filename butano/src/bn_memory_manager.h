@@ -7,6 +7,7 @@
 #define BN_MEMORY_MANAGER_H
 
 #include "bn_config_log.h"
+#include "bn_config_telemetry.h"
 
 namespace bn::memory_manager
 {
@@ -24,8 +25,26 @@ namespace bn::memory_manager
 
     [[nodiscard]] int available_alloc_ewram();
 
+    [[nodiscard]] void* iwram_alloc(int bytes);
+
+    [[nodiscard]] void* iwram_calloc(int num, int bytes);
+
+    [[nodiscard]] void* iwram_realloc(void* ptr, int new_bytes);
+
+    void iwram_free(void* ptr);
+
+    [[nodiscard]] int used_alloc_iwram();
+
+    [[nodiscard]] int available_alloc_iwram();
+
+    #if BN_CFG_TELEMETRY_ENABLED
+        [[nodiscard]] int alloc_operations();
+    #endif
+
     #if BN_CFG_LOG_ENABLED
         void log_alloc_ewram_status();
+
+        void log_alloc_iwram_status();
     #endif
 }
 
@@ -247,6 +247,11 @@ int palettes_bank::create_bpp_8(const span<const color>& colors, compression_typ
                 dest_colors_span = span<const color>(dest_colors_array, colors_count);
                 break;
 
+            case compression_type::FAST_LZ:
+                hw::decompress::fast_lz(colors.data(), dest_colors_array);
+                dest_colors_span = span<const color>(dest_colors_array, colors_count);
+                break;
+
             default:
                 BN_ERROR("Unknown compression type: ", int(compression));
                 break;
@@ -692,8 +697,9 @@ void palettes_bank::update()
         }
     }
 
-    _first_index_to_commit = first_index;
-    _last_index_to_commit = last_index;
+    // Colors whose commit was deferred in the last V-Blank are kept:
+    _first_index_to_commit = min(_first_index_to_commit, first_index);
+    _last_index_to_commit = max(_last_index_to_commit, last_index);
 }
 
 palettes_bank::commit_data palettes_bank::retrieve_commit_data() const
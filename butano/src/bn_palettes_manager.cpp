@@ -52,7 +52,17 @@ void update()
     data.bg_palettes_bank.update();
 }
 
-void commit(bool use_dma)
+int sprites_commit_bytes()
+{
+    return data.sprite_palettes_bank.retrieve_commit_data().count * int(sizeof(color));
+}
+
+int bgs_commit_bytes()
+{
+    return data.bg_palettes_bank.retrieve_commit_data().count * int(sizeof(color));
+}
+
+void commit_sprites(bool use_dma)
 {
     palettes_bank::commit_data sprite_commit_data = data.sprite_palettes_bank.retrieve_commit_data();
 
@@ -61,7 +71,10 @@ void commit(bool use_dma)
         hw::palettes::commit_sprites(sprite_colors_ptr, sprite_commit_data.offset, sprite_commit_data.count, use_dma);
         data.sprite_palettes_bank.reset_commit_data();
     }
+}
 
+void commit_bgs(bool use_dma)
+{
     palettes_bank::commit_data bg_commit_data = data.bg_palettes_bank.retrieve_commit_data();
 
     if(const color* bg_colors_ptr = bg_commit_data.colors_ptr)
@@ -24,7 +24,13 @@ namespace palettes_manager
 
     void update();
 
-    void commit(bool use_dma);
+    [[nodiscard]] int sprites_commit_bytes();
+
+    [[nodiscard]] int bgs_commit_bytes();
+
+    void commit_sprites(bool use_dma);
+
+    void commit_bgs(bool use_dma);
 
     void stop();
 }
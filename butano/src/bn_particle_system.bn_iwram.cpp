@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_particle_system.h"
+
+#include "bn_display.h"
+#include "../hw/include/bn_hw_sprites.h"
+
+namespace bn
+{
+
+int iparticle_system::_update_impl(void* handles, int attr0, int attr1, int attr2, int camera_x, int camera_y)
+{
+    auto hw_handles = static_cast<hw::sprites::handle_type*>(handles);
+    int* xs = _xs;
+    int* ys = _ys;
+    int* x_velocities = _x_velocities;
+    int* y_velocities = _y_velocities;
+    uint16_t* frames = _frames;
+    int gravity_x = _gravity.x().data();
+    int gravity_y = _gravity.y().data();
+    int width = _shape_size.width();
+    int height = _shape_size.height();
+    int size = _size;
+    int written_handles_count = 0;
+    int index = 0;
+
+    while(index < size)
+    {
+        int particle_frames = frames[index] - 1;
+
+        if(! particle_frames)
+        {
+            // Remove the expired particle moving the last one to its place:
+            --size;
+            xs[index] = xs[size];
+            ys[index] = ys[size];
+            x_velocities[index] = x_velocities[size];
+            y_velocities[index] = y_velocities[size];
+            frames[index] = frames[size];
+            continue;
+        }
+
+        frames[index] = uint16_t(particle_frames);
+
+        int x_velocity = x_velocities[index] + gravity_x;
+        int y_velocity = y_velocities[index] + gravity_y;
+        int x = xs[index] + x_velocity;
+        int y = ys[index] + y_velocity;
+        x_velocities[index] = x_velocity;
+        y_velocities[index] = y_velocity;
+        xs[index] = x;
+        ys[index] = y;
+
+        int hw_x = (x >> fixed::precision()) + camera_x;
+        int hw_y = (y >> fixed::precision()) + camera_y;
+
+        if(hw_x < display::width() && hw_x + width > 0 && hw_y < display::height() && hw_y + height > 0)
+        {
+            hw::sprites::handle_type& handle = hw_handles[written_handles_count];
+            handle.attr0 = uint16_t(attr0 | (hw_y & 255));
+            handle.attr1 = uint16_t(attr1 | (hw_x & 511));
+            handle.attr2 = uint16_t(attr2);
+            ++written_handles_count;
+        }
+
+        ++index;
+    }
+
+    _size = size;
+    return written_handles_count;
+}
+
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_particle_system.h"
+
+#include "bn_limits.h"
+#include "bn_display.h"
+#include "bn_sprite_item.h"
+#include "bn_display_manager.h"
+#include "bn_sprites_manager.h"
+#include "../hw/include/bn_hw_sprites.h"
+
+namespace bn
+{
+
+iparticle_system::iparticle_system(
+        int* xs, int* ys, int* x_velocities, int* y_velocities, uint16_t* frames, int max_size,
+        const sprite_shape_size& shape_size, sprite_tiles_ptr&& tiles, sprite_palette_ptr&& palette,
+        int first_handle_index) :
+    _xs(xs),
+    _ys(ys),
+    _x_velocities(x_velocities),
+    _y_velocities(y_velocities),
+    _frames(frames),
+    _shape_size(shape_size),
+    _tiles(move(tiles)),
+    _palette(move(palette)),
+    _max_size(max_size),
+    _first_handle_index(first_handle_index)
+{
+    BN_ASSERT(first_handle_index >= 0 && first_handle_index + max_size <= hw::sprites::count(),
+              "Invalid first handle index: ", first_handle_index, " - ", max_size);
+    BN_ASSERT(_tiles.tiles_count() == shape_size.tiles_count(_palette.bpp()),
+              "Invalid tiles, palette or shape size: ", _tiles.tiles_count(), " - ",
+              shape_size.tiles_count(_palette.bpp()));
+}
+
+iparticle_system::iparticle_system(
+        int* xs, int* ys, int* x_velocities, int* y_velocities, uint16_t* frames, int max_size,
+        const sprite_item& item, int first_handle_index) :
+    iparticle_system(xs, ys, x_velocities, y_velocities, frames, max_size, item.shape_size(),
+                     item.tiles_item().create_tiles(), item.palette_item().create_palette(), first_handle_index)
+{
+}
+
+iparticle_system::~iparticle_system()
+{
+    if(_last_written_handles_count)
+    {
+        _hide_written_handles();
+    }
+}
+
+void iparticle_system::set_tiles(const sprite_tiles_ptr& tiles)
+{
+    BN_ASSERT(tiles.tiles_count() == _shape_size.tiles_count(_palette.bpp()),
+              "Invalid tiles count: ", tiles.tiles_count(), " - ", _shape_size.tiles_count(_palette.bpp()));
+
+    _tiles = tiles;
+}
+
+void iparticle_system::set_tiles(sprite_tiles_ptr&& tiles)
+{
+    BN_ASSERT(tiles.tiles_count() == _shape_size.tiles_count(_palette.bpp()),
+              "Invalid tiles count: ", tiles.tiles_count(), " - ", _shape_size.tiles_count(_palette.bpp()));
+
+    _tiles = move(tiles);
+}
+
+void iparticle_system::set_palette(const sprite_palette_ptr& palette)
+{
+    BN_BASIC_ASSERT(_palette.bpp() == palette.bpp(),
+                    "Different palette BPP mode: ", int(_palette.bpp()), " - ", int(palette.bpp()));
+
+    _palette = palette;
+}
+
+void iparticle_system::set_palette(sprite_palette_ptr&& palette)
+{
+    BN_BASIC_ASSERT(_palette.bpp() == palette.bpp(),
+                    "Different palette BPP mode: ", int(_palette.bpp()), " - ", int(palette.bpp()));
+
+    _palette = move(palette);
+}
+
+void iparticle_system::set_bg_priority(int bg_priority)
+{
+    BN_ASSERT(bg_priority >= 0 && bg_priority <= 3, "Invalid BG priority: ", bg_priority);
+
+    _bg_priority = uint8_t(bg_priority);
+}
+
+bool iparticle_system::emit(const fixed_point& position, const fixed_point& velocity, int frames)
+{
+    int size = _size;
+
+    if(size == _max_size || frames <= 0) [[unlikely]]
+    {
+        return false;
+    }
+
+    BN_ASSERT(frames <= numeric_limits<uint16_t>::max(), "Invalid frames: ", frames);
+
+    _xs[size] = position.x().data();
+    _ys[size] = position.y().data();
+    _x_velocities[size] = velocity.x().data();
+    _y_velocities[size] = velocity.y().data();
+    _frames[size] = uint16_t(frames);
+    _size = size + 1;
+    return true;
+}
+
+void iparticle_system::update()
+{
+    int first_handle_index = _first_handle_index;
+    BN_ASSERT(first_handle_index + _max_size <= sprites_manager::reserved_handles_count(),
+              "Not enough reserved handles: ", first_handle_index, " - ", _max_size, " - ",
+              sprites_manager::reserved_handles_count());
+
+    auto handles = static_cast<hw::sprites::handle_type*>(sprites_manager::reserved_handles()) + first_handle_index;
+    int last_written_handles_count = _last_written_handles_count;
+    int written_handles_count;
+
+    if(_visible)
+    {
+        sprite_shape_size shape_size = _shape_size;
+        bpp_mode bpp = _palette.bpp();
+        pair<int, int> dimensions(shape_size.width(), shape_size.height());
+        int camera_x = (display::width() / 2) - (dimensions.first / 2);
+        int camera_y = (display::height() / 2) - (dimensions.second / 2);
+
+        if(const camera_ptr* camera = _camera.get())
+        {
+            const fixed_point& camera_position = camera->position();
+            camera_x -= camera_position.x().right_shift_integer();
+            camera_y -= camera_position.y().right_shift_integer();
+        }
+
+        int attr0 = hw::sprites::first_attributes(0, shape_size.shape(), bpp, 0, false, false, false,
+                                                  display_manager::blending_fade_enabled());
+        int attr1 = hw::sprites::second_attributes(0, shape_size.size(), false, false);
+        int attr2 = hw::sprites::third_attributes(_tiles.id(), _palette.id(), _bg_priority);
+        written_handles_count = _update_impl(handles, attr0, attr1, attr2, camera_x, camera_y);
+    }
+    else
+    {
+        written_handles_count = 0;
+    }
+
+    for(int index = written_handles_count; index < last_written_handles_count; ++index)
+    {
+        hw::sprites::hide_and_destroy(handles[index]);
+    }
+
+    _last_written_handles_count = written_handles_count;
+    sprites_manager::reload_reserved_handles(first_handle_index,
+                                             max(written_handles_count, last_written_handles_count));
+}
+
+void iparticle_system::_hide_written_handles()
+{
+    int first_handle_index = _first_handle_index;
+    int last_written_handles_count = _last_written_handles_count;
+    _last_written_handles_count = 0;
+
+    if(first_handle_index + last_written_handles_count <= sprites_manager::reserved_handles_count())
+    {
+        auto handles = static_cast<hw::sprites::handle_type*>(sprites_manager::reserved_handles()) +
+                first_handle_index;
+
+        for(int index = 0; index < last_written_handles_count; ++index)
+        {
+            hw::sprites::hide_and_destroy(handles[index]);
+        }
+
+        sprites_manager::reload_reserved_handles(first_handle_index, last_written_handles_count);
+    }
+}
+
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_regular_bg_collision_item.h"
+
+#include "bn_limits.h"
+
+namespace bn
+{
+
+namespace
+{
+    constexpr int cell_shift = fixed::precision() + 3;
+    constexpr int cell_size = 1 << cell_shift;
+    constexpr int empty_cell = int(regular_bg_collision_cell_type::EMPTY);
+    constexpr int solid_cell = int(regular_bg_collision_cell_type::SOLID);
+    constexpr int slope_up_cell = int(regular_bg_collision_cell_type::SLOPE_UP);
+
+    class collision_map
+    {
+
+    public:
+        const uint32_t* words;
+        int words_per_row;
+        int width;
+        int height;
+
+        [[nodiscard]] int cell(int x, int y) const
+        {
+            if(unsigned(x) >= unsigned(width) || unsigned(y) >= unsigned(height)) [[unlikely]]
+            {
+                return solid_cell;
+            }
+
+            return int(words[(y * words_per_row) + (x >> 4)] >> ((x & 15) * 2)) & 3;
+        }
+
+        [[nodiscard]] bool column_blocked(int column, int first_row, int last_row) const
+        {
+            for(int row = first_row; row <= last_row; ++row)
+            {
+                int cell_type = cell(column, row);
+
+                if(cell_type == solid_cell || (cell_type != empty_cell && row != last_row))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] bool row_blocked(int row, int first_column, int last_column) const
+        {
+            for(int column = first_column; column <= last_column; ++column)
+            {
+                if(cell(column, row) != empty_cell)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] int floor(int row, int first_column, int last_column, int left, int right, int bottom,
+                                int target_bottom) const
+        {
+            int row_top = row << cell_shift;
+            int result = numeric_limits<int>::max();
+
+            for(int column = first_column; column <= last_column; ++column)
+            {
+                int cell_type = cell(column, row);
+
+                if(cell_type == solid_cell)
+                {
+                    if(row_top >= bottom && row_top < result)
+                    {
+                        result = row_top;
+                    }
+                }
+                else if(cell_type != empty_cell)
+                {
+                    // The highest point of the slope below the rectangle supports it:
+                    int column_left = column << cell_shift;
+                    int surface;
+
+                    if(cell_type == slope_up_cell)
+                    {
+                        surface = row_top + cell_size - (min(right, column_left + cell_size) - column_left);
+                    }
+                    else
+                    {
+                        surface = row_top + (max(left, column_left) - column_left);
+                    }
+
+                    if(surface <= target_bottom && surface < result)
+                    {
+                        result = surface;
+                    }
+                }
+            }
+
+            return result;
+        }
+    };
+
+    [[nodiscard]] regular_bg_collision_result _sweep(
+            const collision_map& map, const top_left_fixed_rect& rect, const fixed_point& delta)
+    {
+        int left = rect.x().data();
+        int top = rect.y().data();
+        int width = rect.width().data();
+        int height = rect.height().data();
+        int dx = delta.x().data();
+        int dy = delta.y().data();
+        bool left_hit = false;
+        bool right_hit = false;
+        bool top_hit = false;
+        bool bottom_hit = false;
+
+        if(dx)
+        {
+            int first_row = top >> cell_shift;
+            int last_row = (top + height - 1) >> cell_shift;
+
+            if(dx > 0)
+            {
+                int right = left + width;
+                int last_column = (right + dx - 1) >> cell_shift;
+
+                for(int column = ((right - 1) >> cell_shift) + 1; column <= last_column; ++column)
+                {
+                    if(map.column_blocked(column, first_row, last_row))
+                    {
+                        dx = (column << cell_shift) - right;
+                        right_hit = true;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                int last_column = (left + dx) >> cell_shift;
+
+                for(int column = (left >> cell_shift) - 1; column >= last_column; --column)
+                {
+                    if(map.column_blocked(column, first_row, last_row))
+                    {
+                        dx = ((column + 1) << cell_shift) - left;
+                        left_hit = true;
+                        break;
+                    }
+                }
+            }
+
+            left += dx;
+        }
+
+        int right = left + width;
+        int first_column = left >> cell_shift;
+        int last_column = (right - 1) >> cell_shift;
+
+        if(dy < 0)
+        {
+            int last_row = (top + dy) >> cell_shift;
+
+            for(int row = (top >> cell_shift) - 1; row >= last_row; --row)
+            {
+                if(map.row_blocked(row, first_column, last_column))
+                {
+                    dy = ((row + 1) << cell_shift) - top;
+                    top_hit = true;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            int bottom = top + height;
+            int target_bottom = bottom + dy;
+            int last_row = (target_bottom - 1) >> cell_shift;
+
+            for(int row = (bottom - 1) >> cell_shift; row <= last_row; ++row)
+            {
+                int floor = map.floor(row, first_column, last_column, left, right, bottom, target_bottom);
+
+                if(floor != numeric_limits<int>::max())
+                {
+                    dy = floor - bottom;
+                    bottom_hit = true;
+                    break;
+                }
+            }
+        }
+
+        top += dy;
+
+        top_left_fixed_rect result_rect(fixed::from_data(left), fixed::from_data(top), rect.width(), rect.height());
+        return regular_bg_collision_result(result_rect, left_hit, right_hit, top_hit, bottom_hit);
+    }
+}
+
+void regular_bg_collision_item::_sweep_impl(
+        const uint32_t* words, int width, int height, int count, const top_left_fixed_rect* rects,
+        const fixed_point* deltas, regular_bg_collision_result* results)
+{
+    collision_map map = { words, width / 16, width, height };
+
+    for(int index = 0; index < count; ++index)
+    {
+        results[index] = _sweep(map, rects[index], deltas[index]);
+    }
+}
+
+}
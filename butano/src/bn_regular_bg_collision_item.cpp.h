@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_regular_bg_collision_item.h"
+
+namespace bn
+{
+
+regular_bg_collision_result regular_bg_collision_item::sweep(
+        const top_left_fixed_rect& rect, const fixed_point& delta, int map_index) const
+{
+    regular_bg_collision_result result;
+    _sweep_impl(words_ptr(map_index), _dimensions.width(), _dimensions.height(), 1, &rect, &delta, &result);
+    return result;
+}
+
+void regular_bg_collision_item::sweep(
+        const span<const top_left_fixed_rect>& rects, const span<const fixed_point>& deltas,
+        span<regular_bg_collision_result> results, int map_index) const
+{
+    int count = rects.size();
+    BN_ASSERT(deltas.size() == count, "Invalid deltas count: ", deltas.size(), " - ", count);
+    BN_ASSERT(results.size() == count, "Invalid results count: ", results.size(), " - ", count);
+
+    _sweep_impl(words_ptr(map_index), _dimensions.width(), _dimensions.height(), count, rects.data(),
+                deltas.data(), results.data());
+}
+
+}
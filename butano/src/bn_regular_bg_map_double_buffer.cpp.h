@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_regular_bg_map_double_buffer.h"
+
+#include "bn_memory.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_regular_bg_ptr.h"
+#include "bn_regular_bg_tiles_ptr.h"
+
+namespace bn
+{
+
+regular_bg_map_double_buffer regular_bg_map_double_buffer::allocate(
+        const size& dimensions, regular_bg_tiles_ptr tiles, bg_palette_ptr palette)
+{
+    regular_bg_map_ptr front_map = regular_bg_map_ptr::allocate(dimensions, tiles, palette);
+    regular_bg_map_ptr back_map = regular_bg_map_ptr::allocate(dimensions, move(tiles), move(palette));
+    return regular_bg_map_double_buffer(move(front_map), move(back_map));
+}
+
+optional<regular_bg_map_double_buffer> regular_bg_map_double_buffer::allocate_optional(
+        const size& dimensions, regular_bg_tiles_ptr tiles, bg_palette_ptr palette)
+{
+    optional<regular_bg_map_double_buffer> result;
+
+    if(optional<regular_bg_map_ptr> front_map = regular_bg_map_ptr::allocate_optional(dimensions, tiles, palette))
+    {
+        if(optional<regular_bg_map_ptr> back_map =
+                regular_bg_map_ptr::allocate_optional(dimensions, move(tiles), move(palette)))
+        {
+            result = regular_bg_map_double_buffer(move(*front_map), move(*back_map));
+        }
+    }
+
+    return result;
+}
+
+span<const regular_bg_map_cell> regular_bg_map_double_buffer::front_vram()
+{
+    return *_front_map.vram();
+}
+
+span<regular_bg_map_cell> regular_bg_map_double_buffer::back_vram()
+{
+    return *_back_map.vram();
+}
+
+void regular_bg_map_double_buffer::copy_front_to_back()
+{
+    span<const regular_bg_map_cell> front_cells = front_vram();
+    span<regular_bg_map_cell> back_cells = back_vram();
+    memory::copy(front_cells[0], front_cells.size(), back_cells[0]);
+}
+
+void regular_bg_map_double_buffer::flip(regular_bg_ptr& bg)
+{
+    BN_ASSERT(bg.map() == _front_map, "Regular BG doesn't display the front map");
+
+    bg.set_map(_back_map);
+    _front_map.swap(_back_map);
+}
+
+regular_bg_map_double_buffer::regular_bg_map_double_buffer(
+        regular_bg_map_ptr&& front_map, regular_bg_map_ptr&& back_map) :
+    _front_map(move(front_map)),
+    _back_map(move(back_map))
+{
+}
+
+}
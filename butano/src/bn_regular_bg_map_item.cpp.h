@@ -48,6 +48,12 @@ regular_bg_map_item regular_bg_map_item::decompress(span<regular_bg_map_cell> de
         result._compression = compression_type::NONE;
         break;
 
+    case compression_type::FAST_LZ:
+        hw::decompress::fast_lz(_cells_ptr, decompressed_cells_ptr);
+        result._cells_ptr = decompressed_cells_ptr;
+        result._compression = compression_type::NONE;
+        break;
+
     default:
         BN_ERROR("Unknown compression type: ", int(_compression));
         break;
@@ -45,6 +45,12 @@ regular_bg_tiles_item regular_bg_tiles_item::decompress(span<tile> decompressed_
         result._compression = compression_type::NONE;
         break;
 
+    case compression_type::FAST_LZ:
+        hw::decompress::fast_lz(_tiles_ref.data(), dest_tiles_ptr);
+        result._tiles_ref = span<const tile>(dest_tiles_ptr, source_tiles_count);
+        result._compression = compression_type::NONE;
+        break;
+
     default:
         BN_ERROR("Unknown compression type: ", int(_compression));
         break;
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_scoped_scratch.h"
+
+#include "bn_frame_arena_manager.h"
+
+namespace bn
+{
+
+scoped_scratch::scoped_scratch() :
+    _ewram_mark(frame_arena_manager::used_ewram()),
+    _iwram_mark(frame_arena_manager::used_iwram()),
+    _depth(frame_arena_manager::push_scratch())
+{
+}
+
+scoped_scratch::~scoped_scratch()
+{
+    frame_arena_manager::pop_scratch(_depth, _ewram_mark, _iwram_mark);
+}
+
+int scoped_scratch::used_ewram() const
+{
+    return frame_arena_manager::used_ewram() - _ewram_mark;
+}
+
+int scoped_scratch::used_iwram() const
+{
+    return frame_arena_manager::used_iwram() - _iwram_mark;
+}
+
+}
@@ -20,4 +20,14 @@ int available_count()
     return sprite_affine_mats_manager::available_count();
 }
 
+bool auto_share_enabled()
+{
+    return sprite_affine_mats_manager::auto_share_enabled();
+}
+
+void set_auto_share_enabled(bool auto_share_enabled)
+{
+    sprite_affine_mats_manager::set_auto_share_enabled(auto_share_enabled);
+}
+
 }
@@ -65,7 +65,10 @@ namespace
         affine_mat_attributes attributes;
         intrusive_list<sprite_affine_mat_attach_node_type> attached_nodes;
         unsigned usages;
+        unsigned shared_hash;
+        int8_t next_shared_index;
         bool flipped_identity;
+        bool shared;
         bool update;
         bool remove_if_not_needed;
 
@@ -75,6 +78,7 @@ namespace
             usages = 1;
             flipped_identity = true;
             remove_if_not_needed = false;
+            shared = false;
         }
 
         void init(const affine_mat_attributes& new_attributes)
@@ -83,6 +87,7 @@ namespace
             usages = 1;
             flipped_identity = attributes.flipped_identity();
             remove_if_not_needed = false;
+            shared = false;
         }
 
         [[nodiscard]] bool sprite_double_size(int divisor, const sprite_shape_size& shape_size) const
@@ -164,6 +169,7 @@ namespace
     public:
         item_type items[max_items];
         vector<int8_t, max_items> free_item_indexes;
+        int8_t shared_buckets[max_items];
         hw::sprite_affine_mats::handle* handles_ptr = nullptr;
         int first_index_to_update = max_items;
         int last_index_to_update = 0;
@@ -171,6 +177,7 @@ namespace
         int last_index_to_remove_if_not_needed = 0;
         int first_index_to_commit = max_items;
         int last_index_to_commit = 0;
+        bool auto_share_enabled = false;
     };
 
     BN_DATA_EWRAM_BSS static_data data;
@@ -203,6 +210,68 @@ namespace
         }
     }
 
+    [[nodiscard]] unsigned _shared_hash(const affine_mat_attributes& attributes)
+    {
+        unsigned result = unsigned(attributes.pa_register_value());
+        result = (result * 31) + unsigned(attributes.pb_register_value());
+        result = (result * 31) + unsigned(attributes.pc_register_value());
+        result = (result * 31) + unsigned(attributes.pd_register_value());
+        return result;
+    }
+
+    [[nodiscard]] int8_t& _shared_bucket(unsigned hash)
+    {
+        hash ^= (hash >> 16) ^ (hash >> 8);
+        return data.shared_buckets[hash % max_items];
+    }
+
+    [[nodiscard]] int _find_shared(unsigned hash, const affine_mat_attributes& attributes)
+    {
+        int index = _shared_bucket(hash);
+
+        while(index >= 0)
+        {
+            const item_type& item = data.items[index];
+
+            if(item.shared_hash == hash && item.attributes == attributes)
+            {
+                return index;
+            }
+
+            index = item.next_shared_index;
+        }
+
+        return -1;
+    }
+
+    void _add_shared(int index, unsigned hash)
+    {
+        item_type& item = data.items[index];
+        int8_t& bucket = _shared_bucket(hash);
+        item.shared_hash = hash;
+        item.next_shared_index = bucket;
+        item.shared = true;
+        bucket = int8_t(index);
+    }
+
+    void _remove_shared(int index)
+    {
+        item_type& item = data.items[index];
+
+        if(item.shared)
+        {
+            int8_t* index_ptr = &_shared_bucket(item.shared_hash);
+
+            while(*index_ptr != index)
+            {
+                index_ptr = &data.items[*index_ptr].next_shared_index;
+            }
+
+            *index_ptr = item.next_shared_index;
+            item.shared = false;
+        }
+    }
+
     void _update_indexes_to_commit(int index)
     {
         data.first_index_to_commit = min(data.first_index_to_commit, index);
@@ -405,6 +474,7 @@ void init(void* handles)
     for(int index = max_items - 1; index >= 0; --index)
     {
         data.free_item_indexes.push_back(int8_t(index));
+        data.shared_buckets[index] = -1;
     }
 }
 
@@ -460,6 +530,72 @@ int create_optional(const affine_mat_attributes& attributes)
     return item_index;
 }
 
+int create_shared(const affine_mat_attributes& attributes)
+{
+    int id = create_shared_optional(attributes);
+    BN_BASIC_ASSERT(id >= 0, "No more sprite affine mats available");
+
+    return id;
+}
+
+int create_shared_optional(const affine_mat_attributes& attributes)
+{
+    unsigned hash = _shared_hash(attributes);
+    int item_index = _find_shared(hash, attributes);
+
+    if(item_index >= 0)
+    {
+        increase_usages(item_index);
+    }
+    else
+    {
+        item_index = create_optional(attributes);
+
+        if(item_index >= 0)
+        {
+            _add_shared(item_index, hash);
+        }
+    }
+
+    return item_index;
+}
+
+bool update_unique_shared(int id, const affine_mat_attributes& attributes)
+{
+    const item_type& item = data.items[id];
+
+    if(! item.shared || item.usages > 1)
+    {
+        return false;
+    }
+
+    unsigned hash = _shared_hash(attributes);
+
+    if(_find_shared(hash, attributes) >= 0)
+    {
+        return false;
+    }
+
+    set_attributes(id, attributes);
+    _add_shared(id, hash);
+    return true;
+}
+
+bool shared(int id)
+{
+    return data.items[id].shared;
+}
+
+bool auto_share_enabled()
+{
+    return data.auto_share_enabled;
+}
+
+void set_auto_share_enabled(bool auto_share_enabled)
+{
+    data.auto_share_enabled = auto_share_enabled;
+}
+
 void increase_usages(int id)
 {
     item_type& item = data.items[id];
@@ -475,6 +611,7 @@ void decrease_usages(int id)
     {
         item.update = false;
         item.remove_if_not_needed = false;
+        _remove_shared(id);
         data.free_item_indexes.push_back(int8_t(id));
     }
 }
@@ -498,6 +635,8 @@ fixed rotation_angle(int id)
 
 void set_rotation_angle(int id, fixed rotation_angle)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(rotation_angle != item.attributes.rotation_angle())
@@ -522,6 +661,8 @@ fixed horizontal_scale(int id)
 
 void set_horizontal_scale(int id, fixed horizontal_scale)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(horizontal_scale != item.attributes.horizontal_scale())
@@ -545,6 +686,8 @@ fixed vertical_scale(int id)
 
 void set_vertical_scale(int id, fixed vertical_scale)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(vertical_scale != item.attributes.vertical_scale())
@@ -563,6 +706,8 @@ void set_vertical_scale(int id, fixed vertical_scale)
 
 void set_scale(int id, fixed scale)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(scale != item.attributes.horizontal_scale() || scale != item.attributes.vertical_scale())
@@ -582,6 +727,8 @@ void set_scale(int id, fixed scale)
 
 void set_scale(int id, fixed horizontal_scale, fixed vertical_scale)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(horizontal_scale != item.attributes.horizontal_scale() || vertical_scale != item.attributes.vertical_scale())
@@ -606,6 +753,8 @@ fixed horizontal_shear(int id)
 
 void set_horizontal_shear(int id, fixed horizontal_shear)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(horizontal_shear != item.attributes.horizontal_shear())
@@ -628,6 +777,8 @@ fixed vertical_shear(int id)
 
 void set_vertical_shear(int id, fixed vertical_shear)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(vertical_shear != item.attributes.vertical_shear())
@@ -645,6 +796,8 @@ void set_vertical_shear(int id, fixed vertical_shear)
 
 void set_shear(int id, fixed shear)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(shear != item.attributes.horizontal_shear() || shear != item.attributes.vertical_shear())
@@ -663,6 +816,8 @@ void set_shear(int id, fixed shear)
 
 void set_shear(int id, fixed horizontal_shear, fixed vertical_shear)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(horizontal_shear != item.attributes.horizontal_shear() || vertical_shear != item.attributes.vertical_shear())
@@ -686,6 +841,8 @@ bool horizontal_flip(int id)
 
 void set_horizontal_flip(int id, bool horizontal_flip)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(horizontal_flip != item.attributes.horizontal_flip())
@@ -702,6 +859,8 @@ bool vertical_flip(int id)
 
 void set_vertical_flip(int id, bool vertical_flip)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(vertical_flip != item.attributes.vertical_flip())
@@ -718,6 +877,8 @@ const affine_mat_attributes& attributes(int id)
 
 void set_attributes(int id, const affine_mat_attributes& attributes)
 {
+    _remove_shared(id);
+
     item_type& item = data.items[id];
 
     if(item.attributes != attributes)
@@ -42,6 +42,18 @@ namespace bn::sprite_affine_mats_manager
 
     [[nodiscard]] int create_optional(const affine_mat_attributes& attributes);
 
+    [[nodiscard]] int create_shared(const affine_mat_attributes& attributes);
+
+    [[nodiscard]] int create_shared_optional(const affine_mat_attributes& attributes);
+
+    [[nodiscard]] bool update_unique_shared(int id, const affine_mat_attributes& attributes);
+
+    [[nodiscard]] bool shared(int id);
+
+    [[nodiscard]] bool auto_share_enabled();
+
+    void set_auto_share_enabled(bool auto_share_enabled);
+
     void increase_usages(int id);
 
     void decrease_usages(int id);
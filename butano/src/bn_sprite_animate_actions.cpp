@@ -1,6 +1,7 @@
 #include "bn_sprite_animate_actions.h"
 
 #include "bn_limits.h"
+#include "bn_sprite_tiles_cache.h"
 
 namespace bn
 {
@@ -156,6 +157,317 @@ void isprite_animate_action::_assign_graphics_indexes(const ivector<uint16_t>& g
     *_graphics_indexes_ref = graphics_indexes;
 }
 
+isprite_delta_animate_action& isprite_delta_animate_action::operator=(const isprite_delta_animate_action& other)
+{
+    if(this != &other)
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= graphics_indexes().max_size(),
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ",
+                  graphics_indexes().max_size());
+
+        *_sprite_ref = *other._sprite_ref;
+        *_tiles_delta_item_ref = *other._tiles_delta_item_ref;
+        *_graphics_indexes_ref = *other._graphics_indexes_ref;
+        _assign(other);
+    }
+
+    return *this;
+}
+
+isprite_delta_animate_action& isprite_delta_animate_action::operator=(isprite_delta_animate_action&& other) noexcept
+{
+    if(this != &other)
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= graphics_indexes().max_size(),
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ",
+                  graphics_indexes().max_size());
+
+        *_sprite_ref = move(*other._sprite_ref);
+        *_tiles_delta_item_ref = *other._tiles_delta_item_ref;
+        *_graphics_indexes_ref = *other._graphics_indexes_ref;
+        _assign(other);
+    }
+
+    return *this;
+}
+
+void isprite_delta_animate_action::update()
+{
+    BN_ASSERT(! done(), "Action is done");
+
+    if(_current_wait_updates)
+    {
+        --_current_wait_updates;
+    }
+    else
+    {
+        const ivector<uint16_t>& graphics_indexes = this->graphics_indexes();
+        int current_graphics_indexes_index = _current_graphics_indexes_index;
+        int current_graphics_index = graphics_indexes[current_graphics_indexes_index];
+        _current_wait_updates = _wait_updates;
+
+        if(current_graphics_indexes_index == 0 ||
+                graphics_indexes[current_graphics_indexes_index - 1] != current_graphics_index)
+        {
+            _sprite_ref->set_tiles(*_tiles_delta_item_ref, current_graphics_index);
+        }
+
+        if(_forever && current_graphics_indexes_index == graphics_indexes.size() - 1)
+        {
+            _current_graphics_indexes_index = 0;
+        }
+        else
+        {
+            ++_current_graphics_indexes_index;
+        }
+    }
+}
+
+void isprite_delta_animate_action::set_wait_updates(int wait_updates)
+{
+    BN_ASSERT(wait_updates >= 0, "Invalid wait updates: ", wait_updates);
+    BN_ASSERT(wait_updates <= numeric_limits<decltype(_wait_updates)>::max(),
+              "Too many wait updates: ", wait_updates);
+
+    _wait_updates = uint16_t(wait_updates);
+
+    if(wait_updates < _current_wait_updates)
+    {
+        _current_wait_updates = uint16_t(wait_updates);
+    }
+}
+
+void isprite_delta_animate_action::set_next_change_updates(int next_change_updates)
+{
+    BN_ASSERT(next_change_updates >= 0 && next_change_updates <= _wait_updates,
+              "Invalid next change updates: ", next_change_updates, " - ", _wait_updates);
+
+    _current_wait_updates = next_change_updates;
+}
+
+void isprite_delta_animate_action::set_current_index(int current_index)
+{
+    const ivector<uint16_t>& graphics_indexes = this->graphics_indexes();
+    int num_graphics_indexes = graphics_indexes.size();
+
+    if(_forever)
+    {
+        BN_ASSERT(current_index >= 0 && current_index < num_graphics_indexes,
+                  "Invalid current index: ", current_index, " - ", num_graphics_indexes);
+
+        _current_graphics_indexes_index = current_index;
+    }
+    else
+    {
+        BN_ASSERT(current_index >= 0 && current_index <= num_graphics_indexes,
+                  "Invalid current index: ", current_index, " - ", num_graphics_indexes);
+
+        _current_graphics_indexes_index = current_index;
+
+        if(current_index == num_graphics_indexes)
+        {
+            --current_index;
+        }
+    }
+
+    _sprite_ref->set_tiles(*_tiles_delta_item_ref, graphics_indexes[current_index]);
+}
+
+void isprite_delta_animate_action::_set_refs(
+        sprite_ptr& sprite, sprite_tiles_delta_item& tiles_delta_item, ivector<uint16_t>& graphics_indexes)
+{
+    _sprite_ref = &sprite;
+    _tiles_delta_item_ref = &tiles_delta_item;
+    _graphics_indexes_ref = &graphics_indexes;
+}
+
+void isprite_delta_animate_action::_assign(const isprite_delta_animate_action& other)
+{
+    _wait_updates = other._wait_updates;
+    _current_graphics_indexes_index = other._current_graphics_indexes_index;
+    _current_wait_updates = other._current_wait_updates;
+    _forever = other._forever;
+}
+
+void isprite_delta_animate_action::_assign_graphics_indexes(const span<const uint16_t>& graphics_indexes)
+{
+    BN_ASSERT(graphics_indexes.size() > 1 && graphics_indexes.size() <= _graphics_indexes_ref->max_size(),
+              "Invalid graphics indexes count: ", graphics_indexes.size(), " - ", _graphics_indexes_ref->max_size());
+
+    for(uint16_t graphics_index : graphics_indexes)
+    {
+        _graphics_indexes_ref->push_back(graphics_index);
+    }
+}
+
+void isprite_delta_animate_action::_assign_graphics_indexes(const ivector<uint16_t>& graphics_indexes)
+{
+    BN_ASSERT(graphics_indexes.size() > 1 && graphics_indexes.size() <= _graphics_indexes_ref->max_size(),
+              "Invalid graphics indexes count: ", graphics_indexes.size(), " - ", _graphics_indexes_ref->max_size());
+
+    *_graphics_indexes_ref = graphics_indexes;
+}
+
+isprite_streamed_animate_action& isprite_streamed_animate_action::operator=(const isprite_streamed_animate_action& other)
+{
+    if(this != &other)
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= graphics_indexes().max_size(),
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ",
+                  graphics_indexes().max_size());
+
+        *_sprite_ref = *other._sprite_ref;
+        *_graphics_indexes_ref = *other._graphics_indexes_ref;
+        _assign(other);
+    }
+
+    return *this;
+}
+
+isprite_streamed_animate_action& isprite_streamed_animate_action::operator=(isprite_streamed_animate_action&& other) noexcept
+{
+    if(this != &other)
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= graphics_indexes().max_size(),
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ",
+                  graphics_indexes().max_size());
+
+        *_sprite_ref = move(*other._sprite_ref);
+        *_graphics_indexes_ref = *other._graphics_indexes_ref;
+        _assign(other);
+    }
+
+    return *this;
+}
+
+void isprite_streamed_animate_action::update()
+{
+    BN_ASSERT(! done(), "Action is done");
+
+    if(_current_wait_updates)
+    {
+        --_current_wait_updates;
+    }
+    else
+    {
+        const ivector<uint16_t>& graphics_indexes = this->graphics_indexes();
+        int current_graphics_indexes_index = _current_graphics_indexes_index;
+        int current_graphics_index = graphics_indexes[current_graphics_indexes_index];
+        _current_wait_updates = _wait_updates;
+
+        if(current_graphics_indexes_index == 0 ||
+                graphics_indexes[current_graphics_indexes_index - 1] != current_graphics_index)
+        {
+            _sprite_ref->set_tiles(_tiles_cache_ref->tiles(current_graphics_index));
+        }
+
+        if(_forever && current_graphics_indexes_index == graphics_indexes.size() - 1)
+        {
+            _current_graphics_indexes_index = 0;
+        }
+        else
+        {
+            ++_current_graphics_indexes_index;
+        }
+
+        if(! done())
+        {
+            int next_graphics_index = graphics_indexes[_current_graphics_indexes_index];
+
+            if(next_graphics_index != current_graphics_index)
+            {
+                _tiles_cache_ref->prefetch(next_graphics_index);
+            }
+        }
+    }
+}
+
+void isprite_streamed_animate_action::set_wait_updates(int wait_updates)
+{
+    BN_ASSERT(wait_updates >= 0, "Invalid wait updates: ", wait_updates);
+    BN_ASSERT(wait_updates <= numeric_limits<decltype(_wait_updates)>::max(),
+              "Too many wait updates: ", wait_updates);
+
+    _wait_updates = uint16_t(wait_updates);
+
+    if(wait_updates < _current_wait_updates)
+    {
+        _current_wait_updates = uint16_t(wait_updates);
+    }
+}
+
+void isprite_streamed_animate_action::set_next_change_updates(int next_change_updates)
+{
+    BN_ASSERT(next_change_updates >= 0 && next_change_updates <= _wait_updates,
+              "Invalid next change updates: ", next_change_updates, " - ", _wait_updates);
+
+    _current_wait_updates = next_change_updates;
+}
+
+void isprite_streamed_animate_action::set_current_index(int current_index)
+{
+    const ivector<uint16_t>& graphics_indexes = this->graphics_indexes();
+    int num_graphics_indexes = graphics_indexes.size();
+
+    if(_forever)
+    {
+        BN_ASSERT(current_index >= 0 && current_index < num_graphics_indexes,
+                  "Invalid current index: ", current_index, " - ", num_graphics_indexes);
+
+        _current_graphics_indexes_index = current_index;
+    }
+    else
+    {
+        BN_ASSERT(current_index >= 0 && current_index <= num_graphics_indexes,
+                  "Invalid current index: ", current_index, " - ", num_graphics_indexes);
+
+        _current_graphics_indexes_index = current_index;
+
+        if(current_index == num_graphics_indexes)
+        {
+            --current_index;
+        }
+    }
+
+    _sprite_ref->set_tiles(_tiles_cache_ref->tiles(graphics_indexes[current_index]));
+}
+
+void isprite_streamed_animate_action::_set_refs(
+        sprite_ptr& sprite, isprite_tiles_cache& tiles_cache, ivector<uint16_t>& graphics_indexes)
+{
+    _sprite_ref = &sprite;
+    _tiles_cache_ref = &tiles_cache;
+    _graphics_indexes_ref = &graphics_indexes;
+}
+
+void isprite_streamed_animate_action::_assign(const isprite_streamed_animate_action& other)
+{
+    _tiles_cache_ref = other._tiles_cache_ref;
+    _wait_updates = other._wait_updates;
+    _current_graphics_indexes_index = other._current_graphics_indexes_index;
+    _current_wait_updates = other._current_wait_updates;
+    _forever = other._forever;
+}
+
+void isprite_streamed_animate_action::_assign_graphics_indexes(const span<const uint16_t>& graphics_indexes)
+{
+    BN_ASSERT(graphics_indexes.size() > 1 && graphics_indexes.size() <= _graphics_indexes_ref->max_size(),
+              "Invalid graphics indexes count: ", graphics_indexes.size(), " - ", _graphics_indexes_ref->max_size());
+
+    for(uint16_t graphics_index : graphics_indexes)
+    {
+        _graphics_indexes_ref->push_back(graphics_index);
+    }
+}
+
+void isprite_streamed_animate_action::_assign_graphics_indexes(const ivector<uint16_t>& graphics_indexes)
+{
+    BN_ASSERT(graphics_indexes.size() > 1 && graphics_indexes.size() <= _graphics_indexes_ref->max_size(),
+              "Invalid graphics indexes count: ", graphics_indexes.size(), " - ", _graphics_indexes_ref->max_size());
+
+    *_graphics_indexes_ref = graphics_indexes;
+}
+
 isprite_cached_animate_action& isprite_cached_animate_action::operator=(
         const isprite_cached_animate_action& other)
 {
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sprite_group.h"
+
+#include "bn_sprites_manager.h"
+
+namespace bn
+{
+
+isprite_group::~isprite_group()
+{
+    if(_dirty)
+    {
+        sprites_manager::remove_dirty_group(*this);
+    }
+}
+
+void isprite_group::set_local_position(int index, const fixed_point& local_position)
+{
+    BN_ASSERT(index >= 0 && index < _children_ref->size(), "Invalid index: ", index, " - ", _children_ref->size());
+
+    child_type& child = (*_children_ref)[index];
+
+    if(local_position != child.local_position)
+    {
+        child.local_position = local_position;
+        _set_dirty();
+    }
+}
+
+void isprite_group::push_back(sprite_ptr&& sprite, const fixed_point& local_position)
+{
+    BN_ASSERT(! _children_ref->full(), "Group is full");
+
+    sprite.set_visible(_visible);
+    sprite.set_camera(_camera);
+    sprite.set_affine_mat(_affine_mat);
+    _children_ref->emplace_back(move(sprite), local_position);
+    _set_dirty();
+}
+
+void isprite_group::erase(int index)
+{
+    BN_ASSERT(index >= 0 && index < _children_ref->size(), "Invalid index: ", index, " - ", _children_ref->size());
+
+    _children_ref->erase(_children_ref->begin() + index);
+}
+
+void isprite_group::clear()
+{
+    _children_ref->clear();
+}
+
+void isprite_group::set_x(fixed x)
+{
+    if(x != _position.x())
+    {
+        _position.set_x(x);
+        _set_dirty();
+    }
+}
+
+void isprite_group::set_y(fixed y)
+{
+    if(y != _position.y())
+    {
+        _position.set_y(y);
+        _set_dirty();
+    }
+}
+
+void isprite_group::set_position(const fixed_point& position)
+{
+    if(position != _position)
+    {
+        _position = position;
+        _set_dirty();
+    }
+}
+
+void isprite_group::set_visible(bool visible)
+{
+    if(visible != _visible)
+    {
+        _visible = visible;
+
+        for(child_type& child : *_children_ref)
+        {
+            child.sprite.set_visible(visible);
+        }
+    }
+}
+
+void isprite_group::set_camera(camera_ptr&& camera)
+{
+    for(child_type& child : *_children_ref)
+    {
+        child.sprite.set_camera(camera);
+    }
+
+    _camera = move(camera);
+}
+
+void isprite_group::remove_camera()
+{
+    if(_camera)
+    {
+        for(child_type& child : *_children_ref)
+        {
+            child.sprite.remove_camera();
+        }
+
+        _camera.reset();
+    }
+}
+
+void isprite_group::set_affine_mat(sprite_affine_mat_ptr&& affine_mat)
+{
+    for(child_type& child : *_children_ref)
+    {
+        child.sprite.set_affine_mat(affine_mat);
+    }
+
+    _affine_mat = move(affine_mat);
+    _set_dirty();
+}
+
+void isprite_group::remove_affine_mat()
+{
+    if(_affine_mat)
+    {
+        for(child_type& child : *_children_ref)
+        {
+            child.sprite.remove_affine_mat();
+        }
+
+        _affine_mat.reset();
+        _set_dirty();
+    }
+}
+
+fixed isprite_group::rotation_angle() const
+{
+    if(const sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    {
+        return affine_mat->rotation_angle();
+    }
+
+    return 0;
+}
+
+void isprite_group::set_rotation_angle(fixed rotation_angle)
+{
+    _create_affine_mat().set_rotation_angle(rotation_angle);
+    _set_dirty();
+}
+
+fixed isprite_group::horizontal_scale() const
+{
+    if(const sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    {
+        return affine_mat->horizontal_scale();
+    }
+
+    return 1;
+}
+
+void isprite_group::set_horizontal_scale(fixed horizontal_scale)
+{
+    _create_affine_mat().set_horizontal_scale(horizontal_scale);
+    _set_dirty();
+}
+
+fixed isprite_group::vertical_scale() const
+{
+    if(const sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    {
+        return affine_mat->vertical_scale();
+    }
+
+    return 1;
+}
+
+void isprite_group::set_vertical_scale(fixed vertical_scale)
+{
+    _create_affine_mat().set_vertical_scale(vertical_scale);
+    _set_dirty();
+}
+
+void isprite_group::set_scale(fixed scale)
+{
+    _create_affine_mat().set_scale(scale);
+    _set_dirty();
+}
+
+void isprite_group::set_scale(fixed horizontal_scale, fixed vertical_scale)
+{
+    _create_affine_mat().set_scale(horizontal_scale, vertical_scale);
+    _set_dirty();
+}
+
+sprite_affine_mat_ptr& isprite_group::_create_affine_mat()
+{
+    if(! _affine_mat)
+    {
+        set_affine_mat(sprite_affine_mat_ptr::create());
+    }
+
+    return *_affine_mat;
+}
+
+void isprite_group::_set_dirty()
+{
+    if(! _dirty)
+    {
+        _dirty = true;
+        sprites_manager::add_dirty_group(*this);
+    }
+}
+
+}
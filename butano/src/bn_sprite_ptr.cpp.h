@@ -8,15 +8,48 @@
 #include "bn_sprite_builder.h"
 #include "bn_top_left_utils.h"
 #include "bn_sprites_manager.h"
+#include "bn_sprite_tiles_manager.h"
 #include "bn_affine_mat_attributes.h"
 #include "bn_sprite_first_attributes.h"
 #include "bn_sprite_third_attributes.h"
+#include "bn_sprite_tiles_delta_item.h"
 #include "bn_sprite_affine_second_attributes.h"
 #include "bn_sprite_regular_second_attributes.h"
 
 namespace bn
 {
 
+namespace
+{
+    // Shared affine mats are not modified, they are replaced with another shared one
+    // (even if auto share is disabled, since they could be used by other sprites):
+    template<typename Setter>
+    void _set_affine_mat_attributes(sprites_manager::id_type id, bool create_affine_mat, const Setter& setter)
+    {
+        optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(id);
+
+        if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+        {
+            if(affine_mat_ptr->shared())
+            {
+                affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+                setter(mat_attributes);
+                sprites_manager::set_new_affine_mat(id, mat_attributes);
+            }
+            else
+            {
+                setter(*affine_mat_ptr);
+            }
+        }
+        else if(create_affine_mat)
+        {
+            affine_mat_attributes mat_attributes;
+            setter(mat_attributes);
+            sprites_manager::set_new_affine_mat(id, mat_attributes);
+        }
+    }
+}
+
 sprite_ptr sprite_ptr::create(const sprite_item& item)
 {
     return sprite_ptr(sprites_manager::create(
@@ -328,6 +361,21 @@ void sprite_ptr::set_tiles(const sprite_tiles_item& tiles_item, int graphics_ind
     }
 }
 
+void sprite_ptr::set_tiles(const sprite_tiles_delta_item& tiles_delta_item, int graphics_index)
+{
+    const sprite_tiles_item& tiles_item = tiles_delta_item.tiles_item();
+    int tiles_handle = sprites_manager::tiles(_handle).handle();
+    span<const tile> old_tiles_ref = tiles_item.graphics_tiles_ref(
+                tiles_delta_item.previous_graphics_index(graphics_index));
+
+    if(! sprite_tiles_manager::set_tiles_ref_delta(tiles_handle, old_tiles_ref,
+                                                   tiles_item.graphics_tiles_ref(graphics_index),
+                                                   tiles_delta_item.changed_tiles(graphics_index)))
+    {
+        set_tiles(tiles_item, graphics_index);
+    }
+}
+
 void sprite_ptr::set_tiles(const sprite_tiles_item& tiles_item, const sprite_shape_size& shape_size)
 {
     optional<sprite_tiles_ptr> tiles = tiles_item.find_tiles();
@@ -555,18 +603,10 @@ fixed sprite_ptr::rotation_angle() const
 
 void sprite_ptr::set_rotation_angle(fixed rotation_angle)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    _set_affine_mat_attributes(_handle, rotation_angle != 0, [&](auto& target)
     {
-        affine_mat_ptr->set_rotation_angle(rotation_angle);
-    }
-    else if(rotation_angle != 0)
-    {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_rotation_angle(rotation_angle);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_rotation_angle(rotation_angle);
+    });
 }
 
 void sprite_ptr::set_rotation_angle_safe(fixed rotation_angle)
@@ -588,18 +628,10 @@ fixed sprite_ptr::horizontal_scale() const
 
 void sprite_ptr::set_horizontal_scale(fixed horizontal_scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
-    {
-        affine_mat_ptr->set_horizontal_scale(horizontal_scale);
-    }
-    else if(horizontal_scale != 1)
+    _set_affine_mat_attributes(_handle, horizontal_scale != 1, [&](auto& target)
     {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_horizontal_scale(horizontal_scale);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_horizontal_scale(horizontal_scale);
+    });
 }
 
 fixed sprite_ptr::vertical_scale() const
@@ -616,50 +648,26 @@ fixed sprite_ptr::vertical_scale() const
 
 void sprite_ptr::set_vertical_scale(fixed vertical_scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
-    {
-        affine_mat_ptr->set_vertical_scale(vertical_scale);
-    }
-    else if(vertical_scale != 1)
+    _set_affine_mat_attributes(_handle, vertical_scale != 1, [&](auto& target)
     {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_vertical_scale(vertical_scale);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_vertical_scale(vertical_scale);
+    });
 }
 
 void sprite_ptr::set_scale(fixed scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
-    {
-        affine_mat_ptr->set_scale(scale);
-    }
-    else if(scale != 1)
+    _set_affine_mat_attributes(_handle, scale != 1, [&](auto& target)
     {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_scale(scale);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_scale(scale);
+    });
 }
 
 void sprite_ptr::set_scale(fixed horizontal_scale, fixed vertical_scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    _set_affine_mat_attributes(_handle, horizontal_scale != 1 || vertical_scale != 1, [&](auto& target)
     {
-        affine_mat_ptr->set_scale(horizontal_scale, vertical_scale);
-    }
-    else if(horizontal_scale != 1 || vertical_scale != 1)
-    {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_scale(horizontal_scale, vertical_scale);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_scale(horizontal_scale, vertical_scale);
+    });
 }
 
 fixed sprite_ptr::horizontal_shear() const
@@ -676,18 +684,10 @@ fixed sprite_ptr::horizontal_shear() const
 
 void sprite_ptr::set_horizontal_shear(fixed horizontal_shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
-    {
-        affine_mat_ptr->set_horizontal_shear(horizontal_shear);
-    }
-    else if(horizontal_shear != 0)
+    _set_affine_mat_attributes(_handle, horizontal_shear != 0, [&](auto& target)
     {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_horizontal_shear(horizontal_shear);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_horizontal_shear(horizontal_shear);
+    });
 }
 
 fixed sprite_ptr::vertical_shear() const
@@ -704,50 +704,26 @@ fixed sprite_ptr::vertical_shear() const
 
 void sprite_ptr::set_vertical_shear(fixed vertical_shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
-    {
-        affine_mat_ptr->set_vertical_shear(vertical_shear);
-    }
-    else if(vertical_shear != 0)
+    _set_affine_mat_attributes(_handle, vertical_shear != 0, [&](auto& target)
     {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_vertical_shear(vertical_shear);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_vertical_shear(vertical_shear);
+    });
 }
 
 void sprite_ptr::set_shear(fixed shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    _set_affine_mat_attributes(_handle, shear != 0, [&](auto& target)
     {
-        affine_mat_ptr->set_shear(shear);
-    }
-    else if(shear != 0)
-    {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_shear(shear);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_shear(shear);
+    });
 }
 
 void sprite_ptr::set_shear(fixed horizontal_shear, fixed vertical_shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
-    {
-        affine_mat_ptr->set_shear(horizontal_shear, vertical_shear);
-    }
-    else if(horizontal_shear != 0 || vertical_shear != 0)
+    _set_affine_mat_attributes(_handle, horizontal_shear != 0 || vertical_shear != 0, [&](auto& target)
     {
-        affine_mat_attributes mat_attributes;
-        mat_attributes.set_shear(horizontal_shear, vertical_shear);
-        sprites_manager::set_new_affine_mat(_handle, mat_attributes);
-    }
+        target.set_shear(horizontal_shear, vertical_shear);
+    });
 }
 
 int sprite_ptr::bg_priority() const
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sprite_tiles_cache.h"
+
+#include "bn_memory.h"
+#include "bn_tile.h"
+#include "bn_algorithm.h"
+
+namespace bn
+{
+
+const sprite_tiles_ptr& isprite_tiles_cache::tiles(int graphics_index)
+{
+    int slot_index = _find_slot(graphics_index);
+
+    if(slot_index >= 0)
+    {
+        ++_hits;
+    }
+    else
+    {
+        slot_index = _load_slot(graphics_index);
+    }
+
+    slot_type& slot = (*_slots_ref)[slot_index];
+    slot.last_use = ++_use_counter;
+
+    if(slot_index != _current_slot_index)
+    {
+        _previous_slot_index = _current_slot_index;
+        _current_slot_index = slot_index;
+    }
+
+    return slot.tiles;
+}
+
+void isprite_tiles_cache::prefetch(int graphics_index)
+{
+    int slot_index = _find_slot(graphics_index);
+
+    if(slot_index >= 0)
+    {
+        ++_hits;
+    }
+    else
+    {
+        slot_index = _load_slot(graphics_index);
+    }
+
+    (*_slots_ref)[slot_index].last_use = ++_use_counter;
+}
+
+void isprite_tiles_cache::clear()
+{
+    for(slot_type& slot : *_slots_ref)
+    {
+        slot.last_use = 0;
+        slot.graphics_index = -1;
+    }
+
+    _use_counter = 0;
+    _current_slot_index = -1;
+    _previous_slot_index = -1;
+}
+
+isprite_tiles_cache::isprite_tiles_cache(const sprite_tiles_item& tiles_item) :
+    _tiles_item(tiles_item)
+{
+    BN_ASSERT(tiles_item.compression() == compression_type::NONE,
+              "Compressed tiles not supported: ", int(tiles_item.compression()));
+}
+
+void isprite_tiles_cache::_set_slots_ref(ivector<slot_type>& slots_ref, int slots_count)
+{
+    BN_ASSERT(slots_count > 1 && slots_count <= slots_ref.max_size(),
+              "Invalid slots count: ", slots_count, " - ", slots_ref.max_size());
+
+    _slots_ref = &slots_ref;
+    slots_count = min(slots_count, _tiles_item.graphics_count());
+
+    int tiles_count = _tiles_item.tiles_count_per_graphic();
+    bpp_mode bpp = _tiles_item.bpp();
+
+    for(int index = 0; index < slots_count; ++index)
+    {
+        slots_ref.emplace_back(sprite_tiles_ptr::allocate(tiles_count, bpp));
+    }
+}
+
+int isprite_tiles_cache::_find_slot(int graphics_index) const
+{
+    const ivector<slot_type>& slots = *_slots_ref;
+
+    for(int index = 0, limit = slots.size(); index < limit; ++index)
+    {
+        if(slots[index].graphics_index == graphics_index)
+        {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+int isprite_tiles_cache::_load_slot(int graphics_index)
+{
+    // The current and the previous tile sets can be displayed until the next VBlank,
+    // so they are only replaced when there's no other slot available:
+    ivector<slot_type>& slots = *_slots_ref;
+    int slots_count = slots.size();
+    int slot_index = -1;
+    unsigned slot_age = 0;
+
+    for(int protected_slots = 2; slot_index < 0; --protected_slots)
+    {
+        for(int index = 0; index < slots_count; ++index)
+        {
+            if((protected_slots > 0 && index == _current_slot_index) ||
+                    (protected_slots > 1 && index == _previous_slot_index))
+            {
+                continue;
+            }
+
+            const slot_type& slot = slots[index];
+            unsigned age = slot.graphics_index < 0 ? unsigned(-1) : _use_counter - slot.last_use;
+
+            if(slot_index < 0 || age > slot_age)
+            {
+                slot_index = index;
+                slot_age = age;
+            }
+        }
+    }
+
+    slot_type& slot = slots[slot_index];
+    span<const tile> source_tiles = _tiles_item.graphics_tiles_ref(graphics_index);
+    span<tile> vram_tiles = *slot.tiles.vram();
+    memory::copy(source_tiles[0], source_tiles.size(), vram_tiles[0]);
+    slot.graphics_index = graphics_index;
+
+    if(slot_index == _previous_slot_index)
+    {
+        _previous_slot_index = -1;
+    }
+    else if(slot_index == _current_slot_index)
+    {
+        _current_slot_index = -1;
+    }
+
+    ++_misses;
+    return slot_index;
+}
+
+}
@@ -74,10 +74,11 @@ namespace
 
     private:
         uint8_t _status: 2 = uint8_t(status_type::FREE);
-        uint8_t _compression: 2 = uint8_t(compression_type::NONE);
+        uint8_t _compression: 3 = uint8_t(compression_type::NONE);
 
     public:
         bool commit: 1 = false;
+        bool delta_commit: 1 = false;
         bool commit_if_recovered: 1 = false;
 
         [[nodiscard]] status_type status() const
@@ -261,6 +262,16 @@ namespace
     };
 
 
+    class delta_commit_item_type
+    {
+
+    public:
+        const uint16_t* changed_tiles = nullptr;
+        uint16_t changed_tiles_count = 0;
+        uint16_t id = 0;
+    };
+
+
     class static_data
     {
 
@@ -271,6 +282,7 @@ namespace
         vector<uint16_t, max_items> to_remove_items;
         vector<uint16_t, max_items> to_commit_uncompressed_items;
         vector<uint16_t, max_items> to_commit_compressed_items;
+        vector<delta_commit_item_type, max_items> to_commit_delta_items;
         uint16_t free_tiles_count = 0;
         uint16_t to_remove_tiles_count = 0;
         bool delay_commit = false;
@@ -477,8 +489,27 @@ namespace
         data.to_remove_items.erase(to_remove_items_it);
     }
 
+    void _erase_to_commit_delta_item(int id, item_type& item)
+    {
+        if(item.delta_commit)
+        {
+            item.delta_commit = false;
+
+            for(auto it = data.to_commit_delta_items.begin(), end = data.to_commit_delta_items.end(); it != end; ++it)
+            {
+                if(id == it->id)
+                {
+                    data.to_commit_delta_items.erase(it);
+                    return;
+                }
+            }
+        }
+    }
+
     void _insert_to_commit_item(int id, item_type& item)
     {
+        _erase_to_commit_delta_item(id, item);
+
         if(! item.commit)
         {
             item.commit = true;
@@ -492,6 +523,8 @@ namespace
 
     void _erase_to_commit_item(int id, item_type& item)
     {
+        _erase_to_commit_delta_item(id, item);
+
         if(item.commit)
         {
             item.commit = false;
@@ -601,6 +634,10 @@ namespace
             hw::decompress::huff(source_tiles_ptr, hw::sprite_tiles::tile_vram(index));
             break;
 
+        case compression_type::FAST_LZ:
+            hw::decompress::fast_lz(source_tiles_ptr, hw::sprite_tiles::tile_vram(index));
+            break;
+
         default:
             BN_ERROR("Unknown compression type: ", int(compression));
             break;
@@ -992,7 +1029,7 @@ void decrease_usages(int id)
     if(! item.usages) [[unlikely]]
     {
         item.set_status(status_type::TO_REMOVE);
-        item.commit_if_recovered = item.commit;
+        item.commit_if_recovered = item.commit || item.delta_commit;
         _erase_to_commit_item(id, item);
         _insert_to_remove_item(id);
         data.to_remove_tiles_count += item.tiles_count;
@@ -1081,6 +1118,47 @@ void set_tiles_ref(int id, const span<const tile>& tiles_ref, compression_type c
     }
 }
 
+bool set_tiles_ref_delta(int id, const span<const tile>& old_tiles_ref, const span<const tile>& tiles_ref,
+                         const span<const uint16_t>& changed_tiles)
+{
+    item_type& item = data.items.item(id);
+    const tile* new_tiles_data = tiles_ref.data();
+
+    if(item.usages != 1 || item.data != old_tiles_ref.data() || item.compression() != compression_type::NONE ||
+            int(item.tiles_count) != tiles_ref.size() || data.items_map.contains(new_tiles_data))
+    {
+        return false;
+    }
+
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - SET_TILES_REF_DELTA: ", item.start_tile, " - ", new_tiles_data,
+                        " - ", tiles_ref.size(), " - ", changed_tiles.size());
+
+    _erase_items_map_item(item.data);
+    _insert_items_map_item(new_tiles_data, id);
+    item.data = new_tiles_data;
+
+    if(! item.commit)
+    {
+        if(item.delta_commit)
+        {
+            // Changed tiles of consecutive deltas are not merged, all tiles are uploaded instead:
+            _insert_to_commit_item(id, item);
+        }
+        else
+        {
+            item.delta_commit = true;
+
+            delta_commit_item_type& delta_item = data.to_commit_delta_items.emplace_back();
+            delta_item.changed_tiles = changed_tiles.data();
+            delta_item.changed_tiles_count = uint16_t(changed_tiles.size());
+            delta_item.id = uint16_t(id);
+        }
+    }
+
+    BN_SPRITE_TILES_LOG_STATUS();
+    return true;
+}
+
 void reload_tiles_ref(int id)
 {
     item_type& item = data.items.item(id);
@@ -1179,6 +1257,35 @@ void update()
     data.delay_commit = false;
 }
 
+int uncompressed_commit_bytes()
+{
+    int tiles_count = 0;
+
+    for(int item_index : data.to_commit_uncompressed_items)
+    {
+        tiles_count += data.items.item(item_index).tiles_count;
+    }
+
+    for(const delta_commit_item_type& delta_item : data.to_commit_delta_items)
+    {
+        tiles_count += delta_item.changed_tiles_count;
+    }
+
+    return tiles_count * int(sizeof(tile));
+}
+
+int compressed_commit_bytes()
+{
+    int tiles_count = 0;
+
+    for(int item_index : data.to_commit_compressed_items)
+    {
+        tiles_count += data.items.item(item_index).tiles_count;
+    }
+
+    return tiles_count * int(sizeof(tile));
+}
+
 void commit_uncompressed(bool use_dma)
 {
     if(! data.to_commit_uncompressed_items.empty())
@@ -1208,6 +1315,51 @@ void commit_uncompressed(bool use_dma)
 
         BN_SPRITE_TILES_LOG_STATUS();
     }
+
+    if(! data.to_commit_delta_items.empty())
+    {
+        BN_SPRITE_TILES_LOG("sprite_tiles_manager - COMMIT DELTA");
+
+        for(const delta_commit_item_type& delta_item : data.to_commit_delta_items)
+        {
+            item_type& item = data.items.item(delta_item.id);
+            const tile* tiles_data = item.data;
+            const uint16_t* changed_tiles = delta_item.changed_tiles;
+            int changed_tiles_count = delta_item.changed_tiles_count;
+            int start_tile = int(item.start_tile);
+            int changed_tile_index = 0;
+
+            while(changed_tile_index < changed_tiles_count)
+            {
+                // Consecutive changed tiles are uploaded at once:
+                int first_tile = changed_tiles[changed_tile_index];
+                int tiles_count = 1;
+                ++changed_tile_index;
+
+                while(changed_tile_index < changed_tiles_count &&
+                      changed_tiles[changed_tile_index] == first_tile + tiles_count)
+                {
+                    ++tiles_count;
+                    ++changed_tile_index;
+                }
+
+                if(use_dma)
+                {
+                    hw::sprite_tiles::commit_with_dma(tiles_data + first_tile, start_tile + first_tile, tiles_count);
+                }
+                else
+                {
+                    hw::sprite_tiles::commit_with_cpu(tiles_data + first_tile, start_tile + first_tile, tiles_count);
+                }
+            }
+
+            item.delta_commit = false;
+        }
+
+        data.to_commit_delta_items.clear();
+
+        BN_SPRITE_TILES_LOG_STATUS();
+    }
 }
 
 void commit_compressed()
@@ -57,12 +57,19 @@ namespace bn::sprite_tiles_manager
 
     void set_tiles_ref(int id, const span<const tile>& tiles_ref, compression_type compression);
 
+    [[nodiscard]] bool set_tiles_ref_delta(int id, const span<const tile>& old_tiles_ref,
+                                           const span<const tile>& tiles_ref, const span<const uint16_t>& changed_tiles);
+
     void reload_tiles_ref(int id);
 
     [[nodiscard]] optional<span<tile>> vram(int id);
 
     void update();
 
+    [[nodiscard]] int uncompressed_commit_bytes();
+
+    [[nodiscard]] int compressed_commit_bytes();
+
     void commit_uncompressed(bool use_dma);
 
     void commit_compressed();
@@ -56,4 +56,9 @@ void reload()
     sprites_manager::reload_all();
 }
 
+int committed_bytes()
+{
+    return sprites_manager::committed_bytes();
+}
+
 }
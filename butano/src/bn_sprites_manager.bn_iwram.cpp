@@ -20,9 +20,9 @@ int _rebuild_handles_impl(int reserved_handles_count, void* hw_handles, intrusiv
     return hot::rebuild_handles(reserved_handles_count, hw_handles, layers);
 }
 
-bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers)
+bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers, unsigned cameras_mask)
 {
-    return hot::update_cameras(layers);
+    return hot::update_cameras(layers, cameras_mask);
 }
 
 }
@@ -21,6 +21,7 @@
 #include "bn_sprite_builder.cpp.h"
 #include "bn_sprite_third_attributes.cpp.h"
 #include "bn_sprite_affine_second_attributes.cpp.h"
+#include "bn_sprite_group.cpp.h"
 
 namespace bn::sprites_manager
 {
@@ -30,6 +31,13 @@ namespace
     static_assert(BN_CFG_SPRITES_MAX_ITEMS > 0);
 
     using item_type = sprites_manager_item;
+
+    // Handles are committed in runs of dirty blocks, trimmed to the first and last indexes to commit.
+    // A block is about the size which can be copied in the time needed to setup a copy:
+    constexpr int commit_block_shift = 3;
+    constexpr int commit_blocks_count = hw::sprites::count() >> commit_block_shift;
+
+    static_assert(commit_blocks_count <= 32);
     using sorted_items_type = vector<item_type*, BN_CFG_SPRITES_MAX_ITEMS>;
 
     class static_data
@@ -39,9 +47,14 @@ namespace
         pool<item_type, BN_CFG_SPRITES_MAX_ITEMS> items_pool;
         hw::sprites::handle_type handles[hw::sprites::count()];
         sorted_sprites::sorter sorter;
+        intrusive_list<isprite_group> dirty_groups;
         int reserved_handles_count = 0;
         int first_index_to_commit = 0;
         int last_index_to_commit = hw::sprites::count() - 1;
+        unsigned blocks_to_commit = unsigned(uint64_t(1) << commit_blocks_count) - 1;
+        int committed_bytes = 0;
+        int first_reserved_index_to_commit = hw::sprites::count();
+        int last_reserved_index_to_commit = 0;
         int last_visible_items_count = 0;
         bool check_items_on_screen = false;
         bool rebuild_handles = false;
@@ -50,6 +63,13 @@ namespace
 
     BN_DATA_EWRAM_BSS static_data data;
 
+    [[nodiscard]] constexpr unsigned _blocks_to_commit(int first_index, int last_index)
+    {
+        int first_block = first_index >> commit_block_shift;
+        int last_block = last_index >> commit_block_shift;
+        return unsigned((uint64_t(2) << last_block) - (uint64_t(1) << first_block));
+    }
+
     void _always_update_indexes_to_commit(const item_type& item)
     {
         int handles_index = item.handles_index;
@@ -57,6 +77,7 @@ namespace
         if(handles_index >= 0)
         {
             hw::sprites::copy_handle(item.handle, data.handles[handles_index]);
+            data.blocks_to_commit |= 1U << (handles_index >> commit_block_shift);
 
             if(handles_index < data.first_index_to_commit)
             {
@@ -172,6 +193,39 @@ namespace
         }
     }
 
+    void _assign_shared_affine_mat(item_type& item, const affine_mat_attributes& mat_attributes)
+    {
+        if(const sprite_affine_mat_ptr* item_affine_mat = item.affine_mat.get())
+        {
+            if(item_affine_mat->attributes() == mat_attributes)
+            {
+                return;
+            }
+
+            if(item.remove_affine_mat_when_not_needed && mat_attributes.flipped_identity())
+            {
+                _remove_affine_mat(item);
+                hw::sprites::set_horizontal_flip(mat_attributes.horizontal_flip(), item.handle);
+                hw::sprites::set_vertical_flip(mat_attributes.vertical_flip(), item.handle);
+                _update_indexes_to_commit(item);
+                return;
+            }
+
+            // If no one else uses the shared affine mat, it is updated in place instead of allocating another one:
+            if(sprite_affine_mats_manager::update_unique_shared(item_affine_mat->id(), mat_attributes))
+            {
+                return;
+            }
+
+            _assign_affine_mat(item.remove_affine_mat_when_not_needed, item,
+                               sprite_affine_mat_ptr::create_shared(mat_attributes));
+        }
+        else
+        {
+            _assign_affine_mat(true, item, sprite_affine_mat_ptr::create_shared(mat_attributes));
+        }
+    }
+
     void _rebuild_handles()
     {
         if(data.rebuild_handles)
@@ -212,6 +266,7 @@ namespace
             {
                 data.first_index_to_commit = 0;
                 data.last_index_to_commit = hw::sprites::count() - 1;
+                data.blocks_to_commit = _blocks_to_commit(0, hw::sprites::count() - 1);
             }
             else
             {
@@ -226,21 +281,119 @@ namespace
                     to_commit_items_count = visible_items_count;
                 }
 
+                // Handles whose commit was deferred in the last V-Blank are kept:
                 if(to_commit_items_count)
                 {
-                    data.first_index_to_commit = reserved_count;
-                    data.last_index_to_commit = reserved_count + to_commit_items_count - 1;
-                }
-                else
-                {
-                    data.first_index_to_commit = hw::sprites::count();
-                    data.last_index_to_commit = 0;
+                    int last_index_to_commit = reserved_count + to_commit_items_count - 1;
+                    data.first_index_to_commit = min(data.first_index_to_commit, reserved_count);
+                    data.last_index_to_commit = max(data.last_index_to_commit, last_index_to_commit);
+                    data.blocks_to_commit |= _blocks_to_commit(reserved_count, last_index_to_commit);
                 }
             }
         }
     }
+
+    [[nodiscard]] bool _update_group_item_position(const fixed_point& position, item_type& item)
+    {
+        fixed_point old_position = item.position;
+        item.position = position;
+
+        point old_integer_position(old_position.x().right_shift_integer(), old_position.y().right_shift_integer());
+        point new_integer_position(position.x().right_shift_integer(), position.y().right_shift_integer());
+        point diff = new_integer_position - old_integer_position;
+
+        if(diff == point())
+        {
+            return false;
+        }
+
+        point new_hw_position = item.hw_position + diff;
+        item.hw_position = new_hw_position;
+
+        hw::sprites::handle_type& handle = item.handle;
+        hw::sprites::set_x(new_hw_position.x(), handle);
+        hw::sprites::set_y(new_hw_position.y(), handle);
+
+        if(! item.visible)
+        {
+            return false;
+        }
+
+        item.check_on_screen = true;
+        return true;
+    }
+}
+
+}
+
+namespace bn
+{
+
+class sprite_groups_updater
+{
+
+public:
+    [[nodiscard]] static bool update(isprite_group& group)
+    {
+        using sprites_manager::item_type;
+
+        fixed_point group_position = group._position;
+        bool check_items_on_screen = false;
+        group._dirty = false;
+
+        if(const sprite_affine_mat_ptr* affine_mat = group._affine_mat.get())
+        {
+            // Affine matrices map screen coordinates to sprite coordinates,
+            // so local positions are transformed by the inverse of the registers values:
+            const affine_mat_attributes& attributes = affine_mat->attributes();
+            int pa = attributes.pa_register_value();
+            int pb = attributes.pb_register_value();
+            int pc = attributes.pc_register_value();
+            int pd = attributes.pd_register_value();
+            int determinant = (pa * pd) - (pb * pc);
+            fixed ma;
+            fixed mb;
+            fixed mc;
+            fixed md;
+
+            if(determinant) [[likely]]
+            {
+                ma = fixed::from_data(int((int64_t(pd) << 20) / determinant));
+                mb = fixed::from_data(int((int64_t(-pb) << 20) / determinant));
+                mc = fixed::from_data(int((int64_t(-pc) << 20) / determinant));
+                md = fixed::from_data(int((int64_t(pa) << 20) / determinant));
+            }
+
+            for(isprite_group::child_type& child : *group._children_ref)
+            {
+                const fixed_point& local_position = child.local_position;
+                fixed local_x = local_position.x();
+                fixed local_y = local_position.y();
+                fixed_point position(group_position.x() + (ma * local_x) + (mb * local_y),
+                                     group_position.y() + (mc * local_x) + (md * local_y));
+                auto item = static_cast<item_type*>(const_cast<void*>(child.sprite.handle()));
+                check_items_on_screen |= sprites_manager::_update_group_item_position(position, *item);
+            }
+        }
+        else
+        {
+            for(isprite_group::child_type& child : *group._children_ref)
+            {
+                auto item = static_cast<item_type*>(const_cast<void*>(child.sprite.handle()));
+                check_items_on_screen |= sprites_manager::_update_group_item_position(
+                            group_position + child.local_position, *item);
+            }
+        }
+
+        return check_items_on_screen;
+    }
+};
+
 }
 
+namespace bn::sprites_manager
+{
+
 void init()
 {
     ::new(static_cast<void*>(&data)) static_data();
@@ -258,6 +411,11 @@ int used_items_count()
     return data.items_pool.size();
 }
 
+int visible_items_count()
+{
+    return data.last_visible_items_count;
+}
+
 int available_items_count()
 {
     return data.items_pool.available();
@@ -751,7 +909,16 @@ void set_horizontal_flip(id_type id, bool horizontal_flip)
 
     if(sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
     {
-        item_affine_mat->set_horizontal_flip(horizontal_flip);
+        if(item_affine_mat->shared())
+        {
+            affine_mat_attributes mat_attributes = item_affine_mat->attributes();
+            mat_attributes.set_horizontal_flip(horizontal_flip);
+            _assign_shared_affine_mat(*item, mat_attributes);
+        }
+        else
+        {
+            item_affine_mat->set_horizontal_flip(horizontal_flip);
+        }
     }
     else
     {
@@ -783,7 +950,16 @@ void set_vertical_flip(id_type id, bool vertical_flip)
 
     if(sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
     {
-        item_affine_mat->set_vertical_flip(vertical_flip);
+        if(item_affine_mat->shared())
+        {
+            affine_mat_attributes mat_attributes = item_affine_mat->attributes();
+            mat_attributes.set_vertical_flip(vertical_flip);
+            _assign_shared_affine_mat(*item, mat_attributes);
+        }
+        else
+        {
+            item_affine_mat->set_vertical_flip(vertical_flip);
+        }
     }
     else
     {
@@ -1003,10 +1179,27 @@ void set_affine_mat(id_type id, sprite_affine_mat_ptr&& affine_mat)
 void set_new_affine_mat(id_type id, affine_mat_attributes& mat_attributes)
 {
     auto item = static_cast<item_type*>(id);
-    const hw::sprites::handle_type& handle = item->handle;
-    mat_attributes.set_horizontal_flip(hw::sprites::horizontal_flip(handle));
-    mat_attributes.set_vertical_flip(hw::sprites::vertical_flip(handle));
-    _assign_affine_mat(true, *item, sprite_affine_mat_ptr::create(mat_attributes));
+
+    if(item->affine_mat)
+    {
+        // Shared affine mats are not modified, they are replaced with another shared one:
+        _assign_shared_affine_mat(*item, mat_attributes);
+    }
+    else
+    {
+        const hw::sprites::handle_type& handle = item->handle;
+        mat_attributes.set_horizontal_flip(hw::sprites::horizontal_flip(handle));
+        mat_attributes.set_vertical_flip(hw::sprites::vertical_flip(handle));
+
+        if(sprite_affine_mats_manager::auto_share_enabled())
+        {
+            _assign_shared_affine_mat(*item, mat_attributes);
+        }
+        else
+        {
+            _assign_affine_mat(true, *item, sprite_affine_mat_ptr::create(mat_attributes));
+        }
+    }
 }
 
 void remove_affine_mat(id_type id)
@@ -1131,6 +1324,23 @@ void set_reserved_handles_count(int reserved_handles_count)
     }
 }
 
+void* reserved_handles()
+{
+    return data.handles;
+}
+
+void reload_reserved_handles(int first_index, int count)
+{
+    BN_ASSERT(first_index >= 0 && count >= 0 && first_index + count <= data.reserved_handles_count,
+              "Invalid reserved handles range: ", first_index, " - ", count, " - ", data.reserved_handles_count);
+
+    if(count)
+    {
+        data.first_reserved_index_to_commit = min(data.first_reserved_index_to_commit, first_index);
+        data.last_reserved_index_to_commit = max(data.last_reserved_index_to_commit, first_index + count - 1);
+    }
+}
+
 void reload(id_type id)
 {
     auto item = static_cast<item_type*>(id);
@@ -1333,12 +1543,12 @@ void fill_hblank_effect_third_attributes([[maybe_unused]] sprite_shape_size shap
     }
 }
 
-void update_cameras()
+void update_cameras(unsigned cameras_mask)
 {
     #if BN_CFG_SPRITES_USE_IWRAM
-        bool check_items_on_screen = _update_cameras_impl(data.sorter.layers());
+        bool check_items_on_screen = _update_cameras_impl(data.sorter.layers(), cameras_mask);
     #else
-        bool check_items_on_screen = hot::update_cameras(data.sorter.layers());
+        bool check_items_on_screen = hot::update_cameras(data.sorter.layers(), cameras_mask);
     #endif
 
     if(check_items_on_screen)
@@ -1366,8 +1576,36 @@ void update_auto_double_size(id_type id)
     _update_item_dimensions(*item);
 }
 
+void add_dirty_group(isprite_group& group)
+{
+    data.dirty_groups.push_back(group);
+}
+
+void remove_dirty_group(isprite_group& group)
+{
+    data.dirty_groups.erase(group);
+}
+
 void update()
 {
+    if(! data.dirty_groups.empty())
+    {
+        bool check_items_on_screen = false;
+
+        for(isprite_group& group : data.dirty_groups)
+        {
+            check_items_on_screen |= sprite_groups_updater::update(group);
+        }
+
+        data.dirty_groups.clear();
+
+        if(check_items_on_screen)
+        {
+            data.check_items_on_screen = true;
+            data.rebuild_handles = true;
+        }
+    }
+
     sprite_affine_mats_manager::update();
 
     if(data.check_items_on_screen)
@@ -1384,12 +1622,30 @@ void update()
     _rebuild_handles();
 }
 
+int committed_bytes()
+{
+    return data.committed_bytes;
+}
+
 void commit(bool use_dma)
 {
     sprite_affine_mats_manager::commit_data affine_mats_commit_data =
             sprite_affine_mats_manager::retrieve_commit_data();
     int first_index_to_commit = data.first_index_to_commit;
     int last_index_to_commit = data.last_index_to_commit;
+    unsigned blocks_to_commit = data.blocks_to_commit;
+
+    int first_reserved_index_to_commit = data.first_reserved_index_to_commit;
+
+    if(first_reserved_index_to_commit < hw::sprites::count())
+    {
+        int last_reserved_index_to_commit = data.last_reserved_index_to_commit;
+        first_index_to_commit = min(first_index_to_commit, first_reserved_index_to_commit);
+        last_index_to_commit = max(last_index_to_commit, last_reserved_index_to_commit);
+        blocks_to_commit |= _blocks_to_commit(first_reserved_index_to_commit, last_reserved_index_to_commit);
+        data.first_reserved_index_to_commit = hw::sprites::count();
+        data.last_reserved_index_to_commit = 0;
+    }
 
     if(int count = affine_mats_commit_data.count)
     {
@@ -1399,15 +1655,46 @@ void commit(bool use_dma)
         int last_mat_index_to_commit = first_mat_index_to_commit + (count * multiplier) - 1;
         first_index_to_commit = min(first_index_to_commit, first_mat_index_to_commit);
         last_index_to_commit = max(last_index_to_commit, last_mat_index_to_commit);
+        blocks_to_commit |= _blocks_to_commit(first_mat_index_to_commit, last_mat_index_to_commit);
     }
 
+    int committed_handles = 0;
+
     if(first_index_to_commit < hw::sprites::count())
     {
-        int commit_items_count = last_index_to_commit - first_index_to_commit + 1;
-        hw::sprites::commit(data.handles[0], first_index_to_commit, commit_items_count, use_dma);
+        int block = first_index_to_commit >> commit_block_shift;
+        blocks_to_commit >>= block;
+
+        while(blocks_to_commit)
+        {
+            if(blocks_to_commit & 1)
+            {
+                int first_index = max(block << commit_block_shift, first_index_to_commit);
+
+                while(blocks_to_commit & 1)
+                {
+                    blocks_to_commit >>= 1;
+                    ++block;
+                }
+
+                int last_index = min((block << commit_block_shift) - 1, last_index_to_commit);
+                int commit_items_count = last_index - first_index + 1;
+                hw::sprites::commit(data.handles[0], first_index, commit_items_count, use_dma);
+                committed_handles += commit_items_count;
+            }
+            else
+            {
+                blocks_to_commit >>= 1;
+                ++block;
+            }
+        }
+
         data.first_index_to_commit = hw::sprites::count();
         data.last_index_to_commit = 0;
+        data.blocks_to_commit = 0;
     }
+
+    data.committed_bytes = committed_handles * int(sizeof(hw::sprites::handle_type));
 }
 
 }
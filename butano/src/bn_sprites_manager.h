@@ -18,6 +18,7 @@ namespace bn
 class size;
 class point;
 class camera_ptr;
+class isprite_group;
 class sprite_builder;
 class sprite_tiles_ptr;
 class sprite_shape_size;
@@ -48,6 +49,8 @@ namespace sprites_manager
 
     [[nodiscard]] int available_items_count();
 
+    [[nodiscard]] int visible_items_count();
+
     [[nodiscard]] id_type create(const fixed_point& position, const sprite_shape_size& shape_size,
                                  sprite_tiles_ptr&& tiles, sprite_palette_ptr&& palette);
 
@@ -189,6 +192,10 @@ namespace sprites_manager
 
     void set_reserved_handles_count(int reserved_handles_count);
 
+    [[nodiscard]] void* reserved_handles();
+
+    void reload_reserved_handles(int first_index, int count);
+
     void reload(id_type id);
 
     void reload_blending();
@@ -213,7 +220,11 @@ namespace sprites_manager
     void fill_hblank_effect_third_attributes(
             sprite_shape_size shape_size, const sprite_third_attributes* third_attributes_ptr, uint16_t* dest_ptr);
 
-    void update_cameras();
+    void add_dirty_group(isprite_group& group);
+
+    void remove_dirty_group(isprite_group& group);
+
+    void update_cameras(unsigned cameras_mask);
 
     void remove_identity_affine_mat_when_not_needed(id_type id);
 
@@ -221,6 +232,8 @@ namespace sprites_manager
 
     void update();
 
+    [[nodiscard]] int committed_bytes();
+
     void commit(bool use_dma);
 
     #if BN_CFG_SPRITES_USE_IWRAM
@@ -229,7 +242,8 @@ namespace sprites_manager
         [[nodiscard]] BN_CODE_IWRAM int _rebuild_handles_impl(
                 int reserved_handles_count, void* hw_handles, intrusive_list<sorted_sprites::layer>& layers);
 
-        [[nodiscard]] BN_CODE_IWRAM bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers);
+        [[nodiscard]] BN_CODE_IWRAM bool _update_cameras_impl(
+                intrusive_list<sorted_sprites::layer>& layers, unsigned cameras_mask);
     #endif
 }
 
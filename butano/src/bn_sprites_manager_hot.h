@@ -89,7 +89,7 @@ inline void check_items_on_screen(intrusive_list<sorted_sprites::layer>& layers)
     return visible_items_count;
 }
 
-[[nodiscard]] inline bool update_cameras(intrusive_list<sorted_sprites::layer>& layers)
+[[nodiscard]] inline bool update_cameras(intrusive_list<sorted_sprites::layer>& layers, unsigned cameras_mask)
 {
     bool check_items_on_screen = false;
 
@@ -97,7 +97,10 @@ inline void check_items_on_screen(intrusive_list<sorted_sprites::layer>& layers)
     {
         for(sprites_manager_item& item : layer.items())
         {
-            if(item.camera)
+            const camera_ptr* camera = item.camera.get();
+
+            // Only items attached to an updated camera are updated:
+            if(camera && (cameras_mask & (1U << camera->id())))
             {
                 item.update_hw_position();
 
@@ -7,6 +7,7 @@
 
 #include "bn_array.h"
 #include "bn_string.h"
+#include "bn_format_to.h"
 #include "bn_string_view.h"
 #include "../hw/include/bn_hw_text.h"
 
@@ -109,42 +110,42 @@ void ostringstream::append(const char* char_array_ptr, int char_array_size)
 void ostringstream::append(int value)
 {
     array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
+    int size = format_to(buffer, value);
     _string->append(buffer.data(), size);
 }
 
 void ostringstream::append(long value)
 {
     array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
+    int size = format_to(buffer, value);
     _string->append(buffer.data(), size);
 }
 
 void ostringstream::append(int64_t value)
 {
     array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
+    int size = format_to(buffer, value);
     _string->append(buffer.data(), size);
 }
 
 void ostringstream::append(unsigned value)
 {
     array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
+    int size = format_to(buffer, value);
     _string->append(buffer.data(), size);
 }
 
 void ostringstream::append(unsigned long value)
 {
     array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
+    int size = format_to(buffer, value);
     _string->append(buffer.data(), size);
 }
 
 void ostringstream::append(uint64_t value)
 {
     array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
+    int size = format_to(buffer, value);
     _string->append(buffer.data(), size);
 }
 
@@ -171,7 +172,7 @@ void ostringstream::swap(ostringstream& other)
 void ostringstream::_append_fraction(unsigned fraction_result, int fraction_digits)
 {
     array<char, 32> buffer;
-    int fraction_size = hw::text::parse(fraction_result, buffer);
+    int fraction_size = format_to(buffer, fraction_result);
     istring& string = *_string;
     string.append('.');
 
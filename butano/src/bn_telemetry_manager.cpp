@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_telemetry_manager.h"
+
+#include "bn_telemetry.h"
+
+#if BN_CFG_TELEMETRY_ENABLED
+    #include "bn_log.h"
+    #include "bn_core.h"
+    #include "bn_string.h"
+    #include "bn_assert.h"
+    #include "bn_sstream.h"
+    #include "bn_commit_phase.h"
+    #include "bn_audio_manager.h"
+    #include "bn_memory_manager.h"
+    #include "bn_sprites_manager.h"
+    #include "bn_hblank_effects_manager.h"
+
+    namespace bn::telemetry_manager
+    {
+
+    namespace
+    {
+        constexpr int counters_count = telemetry::counters_count();
+
+        constexpr const char* counter_names[] = {
+            "cpu_ticks",
+            "vblank_ticks",
+            "missed_frames",
+            "sprites",
+            "visible_sprites",
+            "oam_bytes",
+            "palette_bytes",
+            "sprite_tiles_bytes",
+            "big_maps_bytes",
+            "bg_blocks_bytes",
+            "compressed_bytes",
+            "hblank_effects",
+            "sounds",
+            "alloc_operations",
+            "alloc_ewram_bytes",
+        };
+
+        static_assert(int(sizeof(counter_names) / sizeof(*counter_names)) == counters_count);
+
+
+        class sample_type
+        {
+
+        public:
+            int frame;
+            int values[counters_count];
+        };
+
+
+        class static_data
+        {
+
+        public:
+            sample_type samples[BN_CFG_TELEMETRY_MAX_SAMPLES];
+            int values[counters_count] = {};
+            int first_sample_index = 0;
+            int samples_count = 0;
+            int frame = 0;
+            int last_alloc_operations = 0;
+            bool paused = false;
+        };
+
+        BN_DATA_EWRAM_BSS static_data data;
+
+
+        [[nodiscard]] const sample_type& _sample(int sample_index)
+        {
+            BN_ASSERT(sample_index >= 0 && sample_index < data.samples_count,
+                      "Invalid sample index: ", sample_index, " - ", data.samples_count);
+
+            int index = data.first_sample_index + sample_index;
+
+            if(index >= BN_CFG_TELEMETRY_MAX_SAMPLES)
+            {
+                index -= BN_CFG_TELEMETRY_MAX_SAMPLES;
+            }
+
+            return data.samples[index];
+        }
+
+        [[nodiscard]] int _counter_index(telemetry_counter counter)
+        {
+            auto result = int(counter);
+            BN_ASSERT(result >= 0 && result < counters_count, "Invalid counter: ", result);
+
+            return result;
+        }
+    }
+
+    void init()
+    {
+        ::new(static_cast<void*>(&data)) static_data();
+
+        data.last_alloc_operations = memory_manager::alloc_operations();
+    }
+
+    void update()
+    {
+        int alloc_operations = memory_manager::alloc_operations();
+        int frame = data.frame + core::last_missed_frames() + 1;
+        data.frame = frame;
+
+        if(data.paused)
+        {
+            data.last_alloc_operations = alloc_operations;
+            return;
+        }
+
+        int* values = data.values;
+        values[int(telemetry_counter::CPU_TICKS)] = core::last_cpu_ticks();
+        values[int(telemetry_counter::VBLANK_TICKS)] = core::last_vblank_ticks();
+        values[int(telemetry_counter::MISSED_FRAMES)] = core::last_missed_frames();
+        values[int(telemetry_counter::SPRITES)] = sprites_manager::used_items_count();
+        values[int(telemetry_counter::VISIBLE_SPRITES)] = sprites_manager::visible_items_count();
+        values[int(telemetry_counter::OAM_BYTES)] = core::last_commit_bytes(commit_phase::SPRITES);
+        values[int(telemetry_counter::PALETTE_BYTES)] = core::last_commit_bytes(commit_phase::PALETTES);
+        values[int(telemetry_counter::SPRITE_TILES_BYTES)] = core::last_commit_bytes(commit_phase::SPRITE_TILES);
+        values[int(telemetry_counter::BIG_MAPS_BYTES)] = core::last_commit_bytes(commit_phase::BIG_MAPS);
+        values[int(telemetry_counter::BG_BLOCKS_BYTES)] = core::last_commit_bytes(commit_phase::BG_BLOCKS);
+        values[int(telemetry_counter::COMPRESSED_BYTES)] = core::last_commit_bytes(commit_phase::COMPRESSED);
+        values[int(telemetry_counter::HBLANK_EFFECTS)] = hblank_effects_manager::used_count();
+        values[int(telemetry_counter::SOUNDS)] = audio_manager::sounds_count();
+        values[int(telemetry_counter::ALLOC_OPERATIONS)] = alloc_operations - data.last_alloc_operations;
+        values[int(telemetry_counter::ALLOC_EWRAM_BYTES)] = memory_manager::used_alloc_ewram();
+        data.last_alloc_operations = alloc_operations;
+
+        int samples_count = data.samples_count;
+        int sample_index = data.first_sample_index + samples_count;
+
+        if(samples_count == BN_CFG_TELEMETRY_MAX_SAMPLES)
+        {
+            int first_sample_index = data.first_sample_index + 1;
+            data.first_sample_index = first_sample_index == BN_CFG_TELEMETRY_MAX_SAMPLES ? 0 : first_sample_index;
+        }
+        else
+        {
+            data.samples_count = samples_count + 1;
+        }
+
+        if(sample_index >= BN_CFG_TELEMETRY_MAX_SAMPLES)
+        {
+            sample_index -= BN_CFG_TELEMETRY_MAX_SAMPLES;
+        }
+
+        sample_type& sample = data.samples[sample_index];
+        sample.frame = frame;
+
+        for(int index = 0; index < counters_count; ++index)
+        {
+            sample.values[index] = values[index];
+        }
+    }
+
+    }
+
+    namespace bn::telemetry
+    {
+
+    const char* counter_name(telemetry_counter counter)
+    {
+        return telemetry_manager::counter_names[telemetry_manager::_counter_index(counter)];
+    }
+
+    int value(telemetry_counter counter)
+    {
+        return telemetry_manager::data.values[telemetry_manager::_counter_index(counter)];
+    }
+
+    int samples_count()
+    {
+        return telemetry_manager::data.samples_count;
+    }
+
+    int sample_frame(int sample_index)
+    {
+        return telemetry_manager::_sample(sample_index).frame;
+    }
+
+    int sample(int sample_index, telemetry_counter counter)
+    {
+        return telemetry_manager::_sample(sample_index).values[telemetry_manager::_counter_index(counter)];
+    }
+
+    bool paused()
+    {
+        return telemetry_manager::data.paused;
+    }
+
+    void set_paused(bool paused)
+    {
+        telemetry_manager::data.paused = paused;
+    }
+
+    void clear()
+    {
+        telemetry_manager::data.first_sample_index = 0;
+        telemetry_manager::data.samples_count = 0;
+    }
+
+    void log_csv()
+    {
+        #if BN_CFG_LOG_ENABLED
+            string<BN_CFG_LOG_MAX_SIZE> line;
+            ostringstream line_stream(line);
+            line_stream << "frame";
+
+            for(const char* counter_name : telemetry_manager::counter_names)
+            {
+                line_stream << ',' << counter_name;
+            }
+
+            bn::log(line);
+
+            for(int sample_index = 0, limit = samples_count(); sample_index < limit; ++sample_index)
+            {
+                const telemetry_manager::sample_type& sample = telemetry_manager::_sample(sample_index);
+                line.clear();
+                line_stream << sample.frame;
+
+                for(int value : sample.values)
+                {
+                    line_stream << ',' << value;
+                }
+
+                bn::log(line);
+            }
+        #endif
+    }
+
+    }
+#endif
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TELEMETRY_MANAGER_H
+#define BN_TELEMETRY_MANAGER_H
+
+#include "bn_common.h"
+
+namespace bn::telemetry_manager
+{
+    void init();
+
+    void update();
+}
+
+#endif
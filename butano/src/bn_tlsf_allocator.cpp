@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_tlsf_allocator.h"
+
+#include "bn_memory.h"
+#include "bn_algorithm.h"
+#include "bn_config_log.h"
+
+#if BN_CFG_LOG_ENABLED
+    #include "bn_log.h"
+#endif
+
+#if BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED || BN_CFG_TLSF_ALLOCATOR_FREE_CHECK_ENABLED
+    static_assert(BN_CFG_ASSERT_ENABLED);
+#endif
+
+namespace bn
+{
+
+namespace
+{
+    constexpr tlsf_allocator::size_type alignment_bytes = sizeof(int);
+
+    [[nodiscard]] tlsf_allocator::size_type _aligned_bytes(tlsf_allocator::size_type bytes)
+    {
+        if(tlsf_allocator::size_type extra_bytes = bytes % alignment_bytes)
+        {
+            bytes += alignment_bytes - extra_bytes;
+        }
+
+        return bytes;
+    }
+
+    [[nodiscard]] int _last_bit_index(unsigned value)
+    {
+        return 31 - __builtin_clz(value);
+    }
+
+    [[nodiscard]] int _first_bit_index(unsigned value)
+    {
+        return __builtin_ctz(value);
+    }
+}
+
+tlsf_allocator::~tlsf_allocator() noexcept
+{
+    BN_BASIC_ASSERT(_skip_empty_check_on_destructor || empty(), "Allocator is not empty");
+}
+
+void* tlsf_allocator::alloc(size_type bytes)
+{
+    BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+    bytes = _aligned_bytes(bytes) + _sizeof_used_item;
+
+    if(bytes < _sizeof_free_item)
+    {
+        bytes = _sizeof_free_item;
+    }
+
+    if(bytes > _free_bytes_count)
+    {
+        return nullptr;
+    }
+
+    item_type* item = _find_free_item(bytes);
+
+    if(! item)
+    {
+        return nullptr;
+    }
+
+    _remove_free_item(item);
+
+    size_type new_item_size = item->size - bytes;
+
+    if(new_item_size >= _sizeof_free_item)
+    {
+        item->size = bytes;
+
+        item_type* new_item = item->next();
+        new_item->previous = item;
+        new_item->size = new_item_size;
+        new_item->used = false;
+
+        item_type* new_next_item = new_item->next();
+
+        if(new_next_item != _end_item())
+        {
+            new_next_item->previous = new_item;
+        }
+
+        _insert_free_item(new_item);
+    }
+
+    item->used = true;
+    _free_bytes_count -= item->size;
+
+    #if BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED
+        _sanity_check();
+    #endif
+
+    return item->data();
+}
+
+void* tlsf_allocator::calloc(size_type num, size_type bytes)
+{
+    BN_ASSERT(num >= 0, "Invalid num: ", num);
+    BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+    bytes *= num;
+
+    void* result = alloc(bytes);
+
+    if(result)
+    {
+        auto int_result = reinterpret_cast<int*>(result);
+        memory::clear(_aligned_bytes(bytes) / size_type(sizeof(int)), *int_result);
+    }
+
+    return result;
+}
+
+void* tlsf_allocator::realloc(void* ptr, size_type new_bytes)
+{
+    if(! ptr)
+    {
+        return alloc(new_bytes);
+    }
+
+    BN_ASSERT(new_bytes >= 0, "Invalid new bytes: ", new_bytes);
+
+    uint8_t* item_ptr = static_cast<uint8_t*>(ptr) - _sizeof_used_item;
+    auto item = reinterpret_cast<item_type*>(item_ptr);
+    size_type old_bytes = item->size - _sizeof_used_item;
+
+    if(new_bytes == old_bytes)
+    {
+        return ptr;
+    }
+
+    void* new_ptr = alloc(new_bytes);
+
+    if(! new_ptr)
+    {
+        return nullptr;
+    }
+
+    auto old_ptr_data = reinterpret_cast<const int*>(ptr);
+    auto new_ptr_data = reinterpret_cast<int*>(new_ptr);
+    size_type bytes_to_copy = min(old_bytes, new_bytes);
+    memory::copy(*old_ptr_data, bytes_to_copy / 4, *new_ptr_data);
+    free(ptr);
+    return new_ptr;
+}
+
+void tlsf_allocator::free(void* ptr)
+{
+    if(! ptr)
+    {
+        return;
+    }
+
+    uint8_t* item_ptr = static_cast<uint8_t*>(ptr) - _sizeof_used_item;
+    auto item = reinterpret_cast<item_type*>(item_ptr);
+
+    #if BN_CFG_TLSF_ALLOCATOR_FREE_CHECK_ENABLED
+        _free_check(item);
+    #endif
+
+    item->used = false;
+    _free_bytes_count += item->size;
+
+    if(item_type* previous_item = item->previous)
+    {
+        if(! previous_item->used)
+        {
+            _remove_free_item(previous_item);
+            previous_item->size += item->size;
+            item = previous_item;
+        }
+    }
+
+    item_type* next_item = item->next();
+    item_type* end_item = _end_item();
+
+    if(next_item != end_item)
+    {
+        if(! next_item->used)
+        {
+            _remove_free_item(next_item);
+            item->size += next_item->size;
+            next_item = item->next();
+        }
+
+        if(next_item != end_item)
+        {
+            next_item->previous = item;
+        }
+    }
+
+    _insert_free_item(item);
+
+    #if BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED
+        _sanity_check();
+    #endif
+}
+
+void tlsf_allocator::reset(void* start, size_type bytes)
+{
+    BN_ASSERT(bytes >= 0 && bytes % size_type(sizeof(int)) == 0, "Invalid bytes: ", bytes);
+    BN_ASSERT(bytes < 1 << (_first_level_count + _first_level_shift - 1), "Too many bytes: ", bytes);
+    BN_BASIC_ASSERT(empty(), "Allocator is not empty");
+
+    _first_level_bitmap = 0;
+
+    for(int first_level = 0; first_level < _first_level_count; ++first_level)
+    {
+        _second_level_bitmaps[first_level] = 0;
+
+        for(item_type*& free_item : _free_items[first_level])
+        {
+            free_item = nullptr;
+        }
+    }
+
+    if(bytes >= _sizeof_free_item)
+    {
+        BN_BASIC_ASSERT(start, "Start is null");
+        BN_ASSERT(aligned<alignment_bytes>(start), "Start is not aligned");
+
+        auto first_item = reinterpret_cast<item_type*>(start);
+        first_item->previous = nullptr;
+        first_item->size = bytes;
+        first_item->used = false;
+
+        _start_ptr = static_cast<uint8_t*>(start);
+        _total_bytes_count = bytes;
+        _free_bytes_count = bytes;
+        _insert_free_item(first_item);
+    }
+    else
+    {
+        _start_ptr = nullptr;
+        _total_bytes_count = 0;
+        _free_bytes_count = 0;
+    }
+
+    #if BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED
+        _sanity_check();
+    #endif
+}
+
+void tlsf_allocator::log_status() const
+{
+    #if BN_CFG_LOG_ENABLED
+        BN_LOG("items: ");
+        BN_LOG('[');
+
+        const item_type* item = _begin_item();
+        const item_type* end_item = _end_item();
+
+        while(item != end_item)
+        {
+            BN_LOG("    ",
+                   item->used ? "used" : "free",
+                   " - size: ", item->size);
+
+            item = item->next();
+        }
+
+        BN_LOG(']');
+        BN_LOG("first_level_bitmap: ", _first_level_bitmap);
+        BN_LOG("free_bytes_count: ", _free_bytes_count);
+        BN_LOG("total_bytes_count: ", _total_bytes_count);
+    #endif
+}
+
+void tlsf_allocator::_free_list_indexes(unsigned bytes, int& first_level, int& second_level)
+{
+    if(bytes < 1U << _first_level_shift)
+    {
+        // Small items are indexed linearly:
+        first_level = 0;
+        second_level = int(bytes) >> (_first_level_shift - _second_level_count_log2);
+    }
+    else
+    {
+        int last_bit_index = _last_bit_index(bytes);
+        first_level = last_bit_index - _first_level_shift + 1;
+        second_level = int(bytes >> (last_bit_index - _second_level_count_log2)) - _second_level_count;
+    }
+}
+
+tlsf_allocator::item_type* tlsf_allocator::_find_free_item(size_type bytes)
+{
+    // Bytes are rounded up to the next size class, so any item of the found class is big enough:
+    auto unsigned_bytes = unsigned(bytes);
+
+    if(unsigned_bytes >= 1U << _first_level_shift)
+    {
+        unsigned_bytes += (1U << (_last_bit_index(unsigned_bytes) - _second_level_count_log2)) - 1;
+    }
+
+    int first_level;
+    int second_level;
+    _free_list_indexes(unsigned_bytes, first_level, second_level);
+
+    if(first_level >= _first_level_count)
+    {
+        return nullptr;
+    }
+
+    unsigned second_level_bitmap = _second_level_bitmaps[first_level] & (~0U << second_level);
+
+    if(! second_level_bitmap)
+    {
+        unsigned first_level_bitmap = _first_level_bitmap & (~0U << (first_level + 1));
+
+        if(! first_level_bitmap)
+        {
+            return nullptr;
+        }
+
+        first_level = _first_bit_index(first_level_bitmap);
+        second_level_bitmap = _second_level_bitmaps[first_level];
+    }
+
+    second_level = _first_bit_index(second_level_bitmap);
+    return _free_items[first_level][second_level];
+}
+
+void tlsf_allocator::_insert_free_item(item_type* item)
+{
+    int first_level;
+    int second_level;
+    _free_list_indexes(unsigned(item->size), first_level, second_level);
+
+    item_type*& first_free_item = _free_items[first_level][second_level];
+    item->free_items.previous = nullptr;
+    item->free_items.next = first_free_item;
+
+    if(first_free_item)
+    {
+        first_free_item->free_items.previous = item;
+    }
+
+    first_free_item = item;
+    _first_level_bitmap |= 1U << first_level;
+    _second_level_bitmaps[first_level] |= uint16_t(1U << second_level);
+}
+
+void tlsf_allocator::_remove_free_item(item_type* item)
+{
+    item_type* previous_free_item = item->free_items.previous;
+    item_type* next_free_item = item->free_items.next;
+
+    if(next_free_item)
+    {
+        next_free_item->free_items.previous = previous_free_item;
+    }
+
+    if(previous_free_item)
+    {
+        previous_free_item->free_items.next = next_free_item;
+        return;
+    }
+
+    int first_level;
+    int second_level;
+    _free_list_indexes(unsigned(item->size), first_level, second_level);
+
+    _free_items[first_level][second_level] = next_free_item;
+
+    if(! next_free_item)
+    {
+        uint16_t second_level_bitmap = _second_level_bitmaps[first_level] & ~uint16_t(1U << second_level);
+        _second_level_bitmaps[first_level] = second_level_bitmap;
+
+        if(! second_level_bitmap)
+        {
+            _first_level_bitmap &= ~(1U << first_level);
+        }
+    }
+}
+
+#if BN_CFG_TLSF_ALLOCATOR_SANITY_CHECK_ENABLED
+    void tlsf_allocator::_sanity_check() const
+    {
+        const item_type* item = _begin_item();
+        const item_type* end_item = _end_item();
+        size_type real_used_bytes = 0;
+        size_type num_free_items = 0;
+
+        while(item != end_item)
+        {
+            if(item->previous)
+            {
+                BN_ASSERT(item->previous->next() == item, item);
+
+                if(! item->used)
+                {
+                    BN_ASSERT(item->previous->used, item);
+                }
+            }
+
+            const item_type* next_item = item->next();
+
+            if(next_item != end_item)
+            {
+                BN_ASSERT(next_item->previous == item, item);
+            }
+
+            if(item->used)
+            {
+                real_used_bytes += item->size;
+            }
+            else
+            {
+                ++num_free_items;
+            }
+
+            item = next_item;
+        }
+
+        BN_ASSERT(real_used_bytes == used_bytes(), real_used_bytes, " - ", used_bytes());
+
+        size_type num_list_free_items = 0;
+
+        for(int first_level = 0; first_level < _first_level_count; ++first_level)
+        {
+            unsigned second_level_bitmap = _second_level_bitmaps[first_level];
+            BN_ASSERT(bool(second_level_bitmap) == bool(_first_level_bitmap & (1U << first_level)), first_level);
+
+            for(int second_level = 0; second_level < _second_level_count; ++second_level)
+            {
+                const item_type* free_item = _free_items[first_level][second_level];
+                BN_ASSERT(bool(free_item) == bool(second_level_bitmap & (1U << second_level)),
+                          first_level, " - ", second_level);
+
+                while(free_item)
+                {
+                    ++num_list_free_items;
+
+                    BN_ASSERT(! free_item->used);
+
+                    const item_type* next_free_item = free_item->free_items.next;
+                    BN_ASSERT(! next_free_item || next_free_item->free_items.previous == free_item);
+
+                    free_item = next_free_item;
+                }
+            }
+        }
+
+        BN_ASSERT(num_free_items == num_list_free_items);
+    }
+#endif
+
+#if BN_CFG_TLSF_ALLOCATOR_FREE_CHECK_ENABLED
+    void tlsf_allocator::_free_check(const item_type* item) const
+    {
+        const item_type* current_item = _begin_item();
+        const item_type* end_item = _end_item();
+
+        while(current_item != end_item)
+        {
+            if(current_item == item)
+            {
+                BN_ASSERT(current_item->used, "Item is free: ", item->data());
+                return;
+            }
+
+            current_item = current_item->next();
+        }
+
+        BN_ASSERT(current_item->used, "Item not found: ", item->data());
+    }
+#endif
+}
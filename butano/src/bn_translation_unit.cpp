@@ -3,14 +3,19 @@
  * zlib License, see LICENSE file.
  */
 
+#include "bn_collision_grid.cpp.h"
 #include "bn_color_effect.cpp.h"
 #include "bn_generic_pool.cpp.h"
 #include "bn_timer.cpp.h"
 
 #include "bn_backdrop.cpp.h"
+#include "bn_binary_log.cpp.h"
 #include "bn_format.cpp.h"
+#include "bn_format_to.cpp.h"
+#include "bn_items_registry.cpp.h"
 #include "bn_log.cpp.h"
 #include "bn_math.cpp.h"
+#include "bn_regular_bg_collision_item.cpp.h"
 #include "bn_reciprocal_lut.cpp.h"
 #include "bn_sin_lut.cpp.h"
 #include "bn_sram.cpp.h"
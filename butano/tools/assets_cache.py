@@ -0,0 +1,139 @@
+"""
+Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import hashlib
+import json
+import os
+import shutil
+
+
+# Content addressed cache shared across projects.
+#
+# Generated files are stored in a folder named after the hash of the input files and the tools version,
+# so a fresh checkout can reuse the files generated by any other project with the same inputs.
+#
+# The compression types chosen when an item uses "auto" compression are stored apart with their own key.
+# It depends on the tools version too, since updated tools can provide new compression types.
+class AssetsCache:
+
+    @staticmethod
+    def create(tool_file_paths, external_tool_path):
+        cache_folder_path = os.environ.get('BN_ASSETS_CACHE')
+
+        if cache_folder_path is None:
+            cache_folder_path = os.path.join(os.path.expanduser('~'), '.cache', 'butano', 'assets')
+        elif len(cache_folder_path) == 0:
+            return None
+
+        try:
+            os.makedirs(cache_folder_path, exist_ok=True)
+        except OSError:
+            return None
+
+        tools_hash = hashlib.sha256()
+
+        for tool_file_path in tool_file_paths:
+            with open(tool_file_path, 'rb') as tool_file:
+                tools_hash.update(tool_file.read())
+
+        external_tool_hash = hashlib.sha256()
+        resolved_external_tool_path = shutil.which(external_tool_path)
+
+        if resolved_external_tool_path is not None:
+            with open(resolved_external_tool_path, 'rb') as external_tool_file:
+                external_tool_hash.update(external_tool_file.read())
+        else:
+            external_tool_hash.update(external_tool_path.encode())
+
+        return AssetsCache(cache_folder_path, tools_hash.hexdigest(), external_tool_hash.hexdigest())
+
+    def __init__(self, cache_folder_path, tools_hash, external_tool_hash):
+        self.__cache_folder_path = cache_folder_path
+        self.__tools_hash = tools_hash
+        self.__external_tool_hash = external_tool_hash
+
+    def keys(self, name, input_file_paths):
+        inputs_hash = hashlib.sha256(name.encode())
+
+        for input_file_path in input_file_paths:
+            with open(input_file_path, 'rb') as input_file:
+                inputs_hash.update(hashlib.sha256(input_file.read()).digest())
+
+        inputs_hash.update(self.__external_tool_hash.encode())
+        inputs_hash.update(self.__tools_hash.encode())
+        compressions_key = inputs_hash.hexdigest()
+        inputs_hash.update(b'outputs')
+        return compressions_key, inputs_hash.hexdigest()
+
+    def load_compressions(self, compressions_key):
+        try:
+            with open(self.__compressions_file_path(compressions_key), 'r') as compressions_file:
+                return json.load(compressions_file)
+        except (OSError, ValueError):
+            return {}
+
+    def store_compressions(self, compressions_key, compressions):
+        file_path = self.__compressions_file_path(compressions_key)
+
+        try:
+            os.makedirs(os.path.dirname(file_path), exist_ok=True)
+            temp_file_path = file_path + '.' + str(os.getpid())
+
+            with open(temp_file_path, 'w') as temp_file:
+                json.dump(compressions, temp_file)
+
+            os.replace(temp_file_path, file_path)
+        except OSError:
+            pass
+
+    def load_outputs(self, outputs_key, build_folder_path):
+        folder_path = self.__outputs_folder_path(outputs_key)
+
+        try:
+            with open(os.path.join(folder_path, 'info.json'), 'r') as info_file:
+                info = json.load(info_file)
+
+            for file_name in info['files']:
+                shutil.copyfile(os.path.join(folder_path, file_name), os.path.join(build_folder_path, file_name))
+
+            return os.path.join(build_folder_path, info['header']), int(info['size'])
+        except (OSError, ValueError, KeyError):
+            return None
+
+    def store_outputs(self, outputs_key, file_paths, header_file_path, total_size):
+        folder_path = self.__outputs_folder_path(outputs_key)
+
+        if os.path.isdir(folder_path):
+            return
+
+        temp_folder_path = folder_path + '.' + str(os.getpid())
+
+        try:
+            os.makedirs(temp_folder_path, exist_ok=True)
+            file_names = []
+
+            for file_path in file_paths:
+                file_name = os.path.basename(file_path)
+                shutil.copyfile(file_path, os.path.join(temp_folder_path, file_name))
+                file_names.append(file_name)
+
+            info = {
+                'files': file_names,
+                'header': os.path.basename(header_file_path),
+                'size': total_size,
+            }
+
+            with open(os.path.join(temp_folder_path, 'info.json'), 'w') as info_file:
+                json.dump(info, info_file)
+
+            os.rename(temp_folder_path, folder_path)
+        except OSError:
+            shutil.rmtree(temp_folder_path, ignore_errors=True)
+
+    def __compressions_file_path(self, compressions_key):
+        return os.path.join(self.__cache_folder_path, 'compressions', compressions_key[:2], compressions_key + '.json')
+
+    def __outputs_folder_path(self, outputs_key):
+        return os.path.join(self.__cache_folder_path, 'outputs', outputs_key[:2], outputs_key)
@@ -0,0 +1,70 @@
+"""
+Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import os
+import tempfile
+import unittest
+
+from assets_cache import AssetsCache
+
+
+class AssetsCacheTests(unittest.TestCase):
+
+    def setUp(self):
+        self.__temp_folder = tempfile.TemporaryDirectory()
+        self.__folder_path = self.__temp_folder.name
+        self.__tool_file_path = self.__write_file('tool.py', 'version 1')
+        self.__input_file_path = self.__write_file('input.bmp', 'input')
+        os.environ['BN_ASSETS_CACHE'] = os.path.join(self.__folder_path, 'cache')
+
+    def tearDown(self):
+        del os.environ['BN_ASSETS_CACHE']
+        self.__temp_folder.cleanup()
+
+    def test_same_inputs_give_same_keys(self):
+        self.assertEqual(self.__keys(), self.__keys())
+
+    def test_input_change_invalidates_both_keys(self):
+        compressions_key, outputs_key = self.__keys()
+        self.__write_file('input.bmp', 'modified input')
+        new_compressions_key, new_outputs_key = self.__keys()
+        self.assertNotEqual(compressions_key, new_compressions_key)
+        self.assertNotEqual(outputs_key, new_outputs_key)
+
+    def test_tool_change_invalidates_both_keys(self):
+        compressions_key, outputs_key = self.__keys()
+        self.__write_file('tool.py', 'version 2')
+        new_compressions_key, new_outputs_key = self.__keys()
+        self.assertNotEqual(compressions_key, new_compressions_key)
+        self.assertNotEqual(outputs_key, new_outputs_key)
+
+    def test_tool_change_discards_stored_compressions(self):
+        cache = self.__cache()
+        compressions_key, outputs_key = cache.keys('input', [self.__input_file_path])
+        cache.store_compressions(compressions_key, {'tiles': 'lz77'})
+        self.assertEqual(cache.load_compressions(compressions_key), {'tiles': 'lz77'})
+
+        self.__write_file('tool.py', 'version 2')
+        cache = self.__cache()
+        compressions_key, outputs_key = cache.keys('input', [self.__input_file_path])
+        self.assertEqual(cache.load_compressions(compressions_key), {})
+
+    def __write_file(self, file_name, content):
+        file_path = os.path.join(self.__folder_path, file_name)
+
+        with open(file_path, 'w') as file:
+            file.write(content)
+
+        return file_path
+
+    def __cache(self):
+        return AssetsCache.create([self.__tool_file_path], 'missing_external_tool')
+
+    def __keys(self):
+        return self.__cache().keys('input', [self.__input_file_path])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -49,6 +49,8 @@ class BMP:
             if bits_per_pixel != 4 and bits_per_pixel != 8:
                 raise ValueError('Invalid bits per pixel: ' + str(bits_per_pixel))
 
+            self.__bits_per_pixel = bits_per_pixel
+
             compression_method = read_int()
 
             if compression_method != 0:
@@ -92,6 +94,37 @@ class BMP:
 
             self.colors_count = colors_count
 
+    def pixel_rows(self):
+        width = self.width
+        height = self.height
+
+        if self.__bits_per_pixel == 4:
+            row_size = width // 2
+        else:
+            row_size = width
+
+        with open(self.__file_path, 'rb') as file:
+            file.seek(self.__pixels_offset)
+            pixels = file.read(row_size * height)  # no padding, multiple of 8.
+
+        rows = []
+
+        for y in range(height - 1, -1, -1):  # bottom-up rows.
+            row_data = pixels[y * row_size:(y + 1) * row_size]
+
+            if self.__bits_per_pixel == 4:
+                row = []
+
+                for pixels_pair in row_data:
+                    row.append(pixels_pair >> 4)
+                    row.append(pixels_pair & 15)
+            else:
+                row = list(row_data)
+
+            rows.append(row)
+
+        return rows
+
     def quantize(self, output_file_path):
         if self.colors_count == 16:
             shutil.copyfile(self.__file_path, output_file_path)
@@ -0,0 +1,185 @@
+"""
+Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import argparse
+import sys
+
+
+RECORD_PREFIX = '#BL '
+CONTINUATION_PREFIX = '#BL+ '
+
+INT = 0
+UNSIGNED = 1
+BOOL = 2
+CHAR = 3
+POINTER = 4
+STRING = 5
+INT64 = 6
+UNSIGNED64 = 7
+FIXED = 0x80
+
+
+class Rom:
+
+    def __init__(self, rom_file_path, base_address):
+        with open(rom_file_path, 'rb') as rom_file:
+            self.__data = rom_file.read()
+
+        self.__base_address = base_address
+
+    def contains(self, address):
+        return 0 <= address - self.__base_address < len(self.__data)
+
+    def byte(self, address):
+        if not self.contains(address):
+            raise ValueError('invalid address: 0x%08X' % address)
+
+        return self.__data[address - self.__base_address]
+
+    def string(self, address):
+        if not self.contains(address):
+            return '<0x%08X>' % address
+
+        start = address - self.__base_address
+        end = self.__data.index(b'\0', start)
+        return self.__data[start:end].decode('utf-8', errors='replace')
+
+
+def _signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def _arg_text(rom, arg_type, words, word_index):
+    value = words[word_index]
+
+    if arg_type & FIXED:
+        precision = arg_type & 0x7F
+        return str(_signed(value) / (1 << precision)), 1
+
+    if arg_type == INT:
+        return str(_signed(value)), 1
+
+    if arg_type == UNSIGNED:
+        return str(value), 1
+
+    if arg_type == BOOL:
+        return 'true' if value else 'false', 1
+
+    if arg_type == CHAR:
+        return chr(value & 0xFF), 1
+
+    if arg_type == POINTER:
+        return '0x%08X' % value, 1
+
+    if arg_type == STRING:
+        return rom.string(value), 1
+
+    value |= words[word_index + 1] << 32
+
+    if arg_type == INT64:
+        return str(value - (1 << 64) if value & (1 << 63) else value), 2
+
+    if arg_type == UNSIGNED64:
+        return str(value), 2
+
+    raise ValueError('Unknown argument type: ' + str(arg_type))
+
+
+def _format(format_string, args):
+    result = []
+    arg_index = 0
+    index = 0
+
+    while index < len(format_string):
+        character = format_string[index]
+        next_character = format_string[index + 1] if index + 1 < len(format_string) else ''
+
+        if character == '{' and next_character == '{':
+            result.append('{')
+            index += 2
+        elif character == '{' and next_character == '}':
+            result.append(args[arg_index] if arg_index < len(args) else '{}')
+            arg_index += 1
+            index += 2
+        elif character == '}' and next_character == '}':
+            result.append('}')
+            index += 2
+        else:
+            result.append(character)
+            index += 1
+
+    return ''.join(result)
+
+
+def decode_record(rom, record_text):
+    hex_words = record_text.strip()
+    words = [int(hex_words[index:index + 8], 16) for index in range(0, len(hex_words), 8)]
+    format_string = rom.string(words[0])
+    types_address = words[1]
+    args_count = rom.byte(types_address)
+    args = []
+    word_index = 2
+
+    for arg_index in range(args_count):
+        arg_text, arg_words = _arg_text(rom, rom.byte(types_address + 1 + arg_index), words, word_index)
+        args.append(arg_text)
+        word_index += arg_words
+
+    return _format(format_string, args)
+
+
+def _decode_line(rom, line_prefix, record_text):
+    try:
+        return line_prefix + decode_record(rom, record_text) + '\n'
+    except (ValueError, IndexError) as exc:
+        return line_prefix + RECORD_PREFIX + record_text + ' (decode error: ' + str(exc) + ')\n'
+
+
+def decode_log(rom, input_file, output_file):
+    # Records longer than BN_CFG_LOG_MAX_SIZE are split in lines starting with CONTINUATION_PREFIX:
+    pending_prefix = None
+    pending_text = ''
+
+    for line in input_file:
+        continuation_index = line.find(CONTINUATION_PREFIX)
+
+        if continuation_index >= 0 and pending_prefix is not None:
+            pending_text += line[continuation_index + len(CONTINUATION_PREFIX):].strip()
+            continue
+
+        if pending_prefix is not None:
+            output_file.write(_decode_line(rom, pending_prefix, pending_text))
+            pending_prefix = None
+
+        record_index = line.find(RECORD_PREFIX)
+
+        if record_index >= 0:
+            pending_prefix = line[:record_index]
+            pending_text = line[record_index + len(RECORD_PREFIX):].strip()
+        else:
+            output_file.write(line)
+
+    if pending_prefix is not None:
+        output_file.write(_decode_line(rom, pending_prefix, pending_text))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Butano binary log tool.')
+    parser.add_argument('--rom', required=True, help='ROM file path (*.gba)')
+    parser.add_argument('--log', help='emulator log file path (standard input is read if not specified)')
+    parser.add_argument('--base', default='0x08000000', help='ROM base address (0x02000000 for multiboot ROMs)')
+
+    try:
+        args = parser.parse_args()
+        rom = Rom(args.rom, int(args.base, 0))
+
+        if args.log:
+            with open(args.log, 'r', errors='replace') as log_file:
+                decode_log(rom, log_file, sys.stdout)
+        else:
+            decode_log(rom, sys.stdin, sys.stdout)
+    except Exception as exc:
+        sys.stderr.write('Error: ' + str(exc) + '\n')
+        exit(-1)
@@ -10,8 +10,10 @@ import string
 import subprocess
 import sys
 
+from assets_cache import AssetsCache
 from bmp import BMP
 from file_info import FileInfo
+from gba_compression import compress
 from pool import create_pool
 
 
@@ -80,7 +82,7 @@ def validate_palette_item(palette_item):
 
 
 def validate_compression(compression):
-    if compression not in ['none', 'lz77', 'run_length', 'huffman', 'auto', 'auto_no_huffman']:
+    if compression not in ['none', 'lz77', 'run_length', 'huffman', 'fast_lz', 'auto', 'auto_no_huffman', 'auto_fast']:
         raise ValueError('Unknown compression: ' + str(compression))
 
 
@@ -97,16 +99,362 @@ def compression_label(compression):
     if compression == 'huffman':
         return 'compression_type::HUFFMAN'
 
+    if compression == 'fast_lz':
+        return 'compression_type::FAST_LZ'
+
     raise ValueError('Unknown compression: ' + str(compression))
 
 
-def append_compression_command(tag, compression, command):
-    if compression == 'lz77':
-        command.append('-' + tag + 'zl')
-    elif compression == 'run_length':
-        command.append('-' + tag + 'zr')
-    elif compression == 'huffman':
-        command.append('-' + tag + 'zh')
+def cached_compression(compression, compressions, tag):
+    if compression.startswith('auto'):
+        try:
+            return compressions[tag]
+        except KeyError:
+            pass
+
+    return compression
+
+
+def compression_candidates(compression):
+    if compression == 'auto' or compression == 'auto_fast':
+        return ['none', 'run_length', 'lz77', 'huffman', 'fast_lz']
+
+    if compression == 'auto_no_huffman':
+        return ['none', 'run_length', 'lz77', 'fast_lz']
+
+    return [compression]
+
+
+# Rough estimation of the CPU cycles required to decompress each byte (or to copy it, for uncompressed data).
+#
+# They are only used to sort compression types by decompression speed, so they don't need to be exact.
+# The decompression benchmarks of the profiler test can be used to refine them.
+decompression_cycles_per_byte = {
+    'none': 1,
+    'fast_lz': 2,
+    'run_length': 8,
+    'lz77': 12,
+    'huffman': 40,
+}
+
+# Compressed data larger than the smallest one by more than this factor is discarded by the "auto_fast" compression:
+auto_fast_max_size_factor = 1.25
+
+
+def best_compression(data, compression, label):
+    results = []
+
+    for candidate in compression_candidates(compression):
+        candidate_data = compress(data, candidate)
+
+        if candidate_data is not None:
+            results.append((candidate, candidate_data))
+
+    if len(results) == 0:
+        raise ValueError('Huffman tree too big for ' + label + ' data')
+
+    result_compression, result_data = min(results, key=lambda result: len(result[1]))
+
+    if compression == 'auto_fast':
+        max_size = len(result_data) * auto_fast_max_size_factor
+        results = [result for result in results if len(result[1]) <= max_size]
+        result_compression, result_data = min(results, key=lambda result: (
+            decompression_cycles_per_byte[result[0]], len(result[1])))
+
+    return result_compression, result_data
+
+
+def data_lines(data):
+    result = []
+
+    for line_index in range(0, len(data), 32):
+        line_end = min(line_index + 32, len(data))
+        words = [data[word_index:word_index + 4] for word_index in range(line_index, line_end, 4)]
+        result.append('\t.word ' + ','.join('0x%08X' % int.from_bytes(word, 'little') for word in words))
+
+    return result
+
+
+# Arrays generated by grit without compression.
+#
+# They are compressed in-process instead of calling grit once per compression type,
+# so all compression types can be tested with just one grit call.
+class GritData:
+
+    __directive_sizes = {'.word': 4, '.hword': 2, '.byte': 1}
+
+    def __init__(self, grit_file_path_no_ext):
+        self.__header_file_path = grit_file_path_no_ext + '.h'
+        self.__data_file_path = grit_file_path_no_ext + '.s'
+        self.__arrays = []
+
+        with open(self.__data_file_path, 'r') as data_file:
+            self.__lines = data_file.read().splitlines()
+
+        array = None
+
+        for line_index, line in enumerate(self.__lines):
+            line_words = line.split(None, 1)
+
+            if len(line_words) == 2 and line_words[0] in GritData.__directive_sizes and array is not None:
+                value_size = GritData.__directive_sizes[line_words[0]]
+                value_mask = (1 << (value_size * 8)) - 1
+
+                if array['first_line'] is None:
+                    array['first_line'] = line_index
+
+                array['last_line'] = line_index
+                array['element_size'] = value_size
+
+                for value in line_words[1].split('@')[0].split(','):
+                    array['data'] += (int(value.strip(), 0) & value_mask).to_bytes(value_size, 'little')
+            elif len(line_words) == 1 and line_words[0].endswith(':'):
+                first_block_line = line_index
+
+                while first_block_line > 0 and self.__lines[first_block_line - 1].strip().startswith('.'):
+                    first_block_line -= 1
+
+                array = {
+                    'label': line_words[0][:-1],
+                    'first_block_line': first_block_line,
+                    'first_line': None,
+                    'last_line': None,
+                    'element_size': 1,
+                    'data': bytearray(),
+                    'compression': 'none',
+                    'modified': False,
+                    'removed': False,
+                }
+                self.__arrays.append(array)
+            elif array is not None and array['first_line'] is not None:
+                array = None
+
+    def data(self, label_suffix):
+        array = self.__find(label_suffix)
+
+        if array is None:
+            return None
+
+        return bytes(array['data'])
+
+    def set_data(self, label_suffix, data):
+        array = self.__find(label_suffix)
+        array['data'] = bytearray(data)
+        array['modified'] = True
+
+    def remove(self, label_suffix):
+        array = self.__find(label_suffix)
+
+        if array is not None:
+            array['removed'] = True
+
+    def compress(self, label_suffix, compression):
+        array = self.__find(label_suffix)
+
+        if array is None:
+            if compression.startswith('auto'):
+                return 'none'
+
+            return compression
+
+        array['compression'], array['data'] = best_compression(array['data'], compression, array['label'])
+        return array['compression']
+
+    def write(self):
+        self.__write_data_file()
+        self.__write_header_file()
+
+    def __find(self, label_suffix):
+        for array in self.__arrays:
+            if array['label'].endswith(label_suffix) and not array['removed']:
+                return array
+
+        return None
+
+    def __write_data_file(self):
+        lines = self.__lines
+
+        for array in reversed(self.__arrays):
+            if array['first_line'] is not None:
+                if array['removed']:
+                    del lines[array['first_block_line']:array['last_line'] + 1]
+                elif array['compression'] != 'none' or array['modified']:
+                    data = array['data']
+                    lines[array['first_line']:array['last_line'] + 1] = data_lines(data)
+                    label_regex = r'(\.global\s+' + re.escape(array['label']) + r'\s+@\s*)[0-9]+'
+                    lines = [re.sub(label_regex, r'\g<1>' + str(len(data)), line) for line in lines]
+
+        with open(self.__data_file_path, 'w') as data_file:
+            data_file.write('\n'.join(lines) + '\n')
+
+    def __write_header_file(self):
+        with open(self.__header_file_path, 'r') as header_file:
+            header_lines = header_file.read().split('\n')
+
+        comment_keywords = {'Tiles': 'tiles', 'Pal': 'palette', 'Map': 'map'}
+        total_sizes = []
+
+        for array in self.__arrays:
+            label = array['label']
+
+            if array['removed']:
+                label_regex = re.compile(r'\b' + re.escape(label) + r'(Len)?\b')
+                header_lines = [line for line in header_lines if label_regex.search(line) is None]
+                continue
+
+            data_size = len(array['data'])
+            compression = array['compression']
+            total_sizes.append(data_size)
+
+            if compression != 'none' or array['modified']:
+                elements_count = (data_size + array['element_size'] - 1) // array['element_size']
+                label_length_regex = r'#define ' + re.escape(label) + r'Len [0-9]+'
+                label_size_regex = re.escape(label) + r'\[[0-9]+]'
+                header_lines = [re.sub(label_length_regex, '#define ' + label + 'Len ' + str(data_size), line)
+                                for line in header_lines]
+                header_lines = [re.sub(label_size_regex, label + '[' + str(elements_count) + ']', line)
+                                for line in header_lines]
+
+            if compression != 'none':
+                for label_suffix, comment_keyword in comment_keywords.items():
+                    if label.endswith(label_suffix):
+                        for line_index, header_line in enumerate(header_lines):
+                            if header_line.startswith('//') and '+ ' in header_line and \
+                                    comment_keyword in header_line:
+                                header_lines[line_index] = header_line.replace(
+                                    'not compressed', compression + ' compressed')
+
+        total_size_line = 'Total size: ' + ' + '.join(str(size) for size in total_sizes) + ' = ' + \
+                          str(sum(total_sizes))
+        header_lines = [re.sub(r'Total size:.*', total_size_line, line) for line in header_lines]
+
+        with open(self.__header_file_path, 'w') as header_file:
+            header_file.write('\n'.join(header_lines))
+
+
+def parse_collision_colors(info):
+    try:
+        collision_colors = info['collision_colors']
+    except KeyError:
+        return None
+
+    if not isinstance(collision_colors, list) or len(collision_colors) == 0:
+        raise ValueError('Invalid collision colors field: ' + str(collision_colors))
+
+    result = set()
+
+    for collision_color in collision_colors:
+        collision_color = int(collision_color)
+
+        if collision_color < 0 or collision_color > 255:
+            raise ValueError('Invalid collision color: ' + str(collision_color))
+
+        result.add(collision_color)
+
+    return result
+
+
+def parse_group(info, tag):
+    try:
+        group = str(info[tag])
+    except KeyError:
+        return None
+
+    if not group.isidentifier():
+        raise ValueError('Invalid ' + tag.replace('_', ' ') + ': ' + group)
+
+    return group
+
+
+def collision_cell_type(solid_pixels):
+    # Solid pixels per cell type: empty, solid, slope up and slope down.
+    errors = [0, 0, 0, 0]
+
+    for y in range(8):
+        for x in range(8):
+            solid = solid_pixels[(y * 8) + x]
+            errors[0] += solid
+            errors[1] += 1 - solid
+            errors[2] += solid != (x + y >= 7)
+            errors[3] += solid != (y >= x)
+
+    return errors.index(min(errors))
+
+
+def collision_words(bmp, collision_colors):
+    rows = bmp.pixel_rows()
+    width = bmp.width // 8
+    height = bmp.height // 8
+    result = []
+
+    for cy in range(height):
+        cell_rows = rows[cy * 8:(cy + 1) * 8]
+
+        for wx in range(0, width, 16):
+            word = 0
+
+            for cx in range(wx, wx + 16):
+                solid_pixels = []
+
+                for cell_row in cell_rows:
+                    for pixel in cell_row[cx * 8:(cx + 1) * 8]:
+                        solid_pixels.append(1 if pixel in collision_colors else 0)
+
+                word |= collision_cell_type(solid_pixels) << ((cx - wx) * 2)
+
+            result.append(word)
+
+    return result
+
+
+def write_collision_words(header_file, array_name, words):
+    header_file.write('constexpr inline uint32_t ' + array_name + '[' + str(len(words)) + '] =' + '\n')
+    header_file.write('{' + '\n')
+
+    for index in range(0, len(words), 8):
+        header_file.write('    ' + ', '.join('0x%08X' % word for word in words[index:index + 8]) + ',' + '\n')
+
+    header_file.write('};' + '\n')
+    header_file.write('\n')
+
+
+def sprite_tiles_delta(tiles_data, graphics):
+    tile_size = 32
+    tiles_count_per_graphic = len(tiles_data) // (tile_size * graphics)
+    graphics_tiles = []
+
+    for graphics_index in range(graphics):
+        graphics_start = graphics_index * tiles_count_per_graphic * tile_size
+        graphics_tiles.append([tiles_data[graphics_start + (tile_index * tile_size):
+                                          graphics_start + ((tile_index + 1) * tile_size)]
+                               for tile_index in range(tiles_count_per_graphic)])
+
+    # Changed tiles of each graphic are computed against the previous one (the first one against the last one):
+    offsets = [0]
+    changed_tiles = []
+
+    for graphics_index in range(graphics):
+        current_tiles = graphics_tiles[graphics_index]
+        previous_tiles = graphics_tiles[graphics_index - 1]
+
+        for tile_index in range(tiles_count_per_graphic):
+            if current_tiles[tile_index] != previous_tiles[tile_index]:
+                changed_tiles.append(tile_index)
+
+        offsets.append(len(changed_tiles))
+
+    return offsets + changed_tiles
+
+
+def write_sprite_tiles_delta(header_file, array_name, values):
+    header_file.write('constexpr inline uint16_t ' + array_name + '[' + str(len(values)) + '] =' + '\n')
+    header_file.write('{' + '\n')
+
+    for index in range(0, len(values), 16):
+        header_file.write('    ' + ', '.join(str(value) for value in values[index:index + 16]) + ',' + '\n')
+
+    header_file.write('};' + '\n')
+    header_file.write('\n')
 
 
 def remove_file(file_path):
@@ -222,55 +570,65 @@ class SpriteItem:
             except KeyError:
                 self.__palette_compression = 'none'
 
-    def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
+        try:
+            self.__tiles_delta = bool(info['tiles_delta'])
+        except KeyError:
+            self.__tiles_delta = False
+
+        if self.__tiles_delta:
+            if self.__graphics < 2:
+                raise ValueError('Tiles delta requires more than one graphic: ' + str(self.__graphics))
 
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
+            if self.__tiles_compression != 'none':
+                raise ValueError('Tiles delta requires uncompressed tiles: ' + self.__tiles_compression)
 
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
+        self.__palette_group = parse_group(info, 'palette_group')
 
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
+        if self.__palette_group is not None and self.__bpp_8:
+            raise ValueError('Palette groups require 4BPP sprites')
 
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
+    def file_name_no_ext(self):
+        return self.__file_name_no_ext
 
-        self.__execute_command(grit, tiles_compression, palette_compression)
-        return self.__write_header(tiles_compression, palette_compression, False)
+    def palette_group(self):
+        return self.__palette_group
 
-    def __test_tiles_compression(self, grit, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(grit, new_tiles_compression, 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', True)
+    def palette_compression(self):
+        return self.__palette_compression
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
+    def extract(self, grit):
+        self.__execute_command(grit)
+        return GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
 
-        return best_tiles_compression, best_file_size
+    def process(self, grit, compressions):
+        tiles_compression = cached_compression(self.__tiles_compression, compressions, 'tiles')
+        palette_compression = cached_compression(self.__palette_compression, compressions, 'palette')
 
-    def __test_palette_compression(self, grit, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_palette_compression)
-        new_file_size = self.__write_header('none', new_palette_compression, True)
+        grit_data = self.extract(grit)
+        tiles_delta = self.__tiles_delta_data(grit_data)
+        tiles_compression = grit_data.compress('Tiles', tiles_compression)
+        palette_compression = grit_data.compress('Pal', palette_compression)
+        grit_data.write()
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
+        compressions['tiles'] = tiles_compression
+        compressions['palette'] = palette_compression
 
-        return best_palette_compression, best_file_size
+        return self.__write_header(tiles_compression, palette_compression, tiles_delta, None)
 
-    def __write_header(self, tiles_compression, palette_compression, skip_write):
+    def process_palette_group_member(self, grit_data, palette_index):
+        tiles_delta = self.__tiles_delta_data(grit_data)
+        grit_data.remove('Pal')
+        tiles_compression = grit_data.compress('Tiles', self.__tiles_compression)
+        grit_data.write()
+        return self.__write_header(tiles_compression, None, tiles_delta, palette_index)
+
+    def __tiles_delta_data(self, grit_data):
+        if self.__tiles_delta:
+            return sprite_tiles_delta(grit_data.data('Tiles'), self.__graphics)
+
+        return None
+
+    def __write_header(self, tiles_compression, palette_compression, tiles_delta, palette_group_index):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_sprite_items_' + name + '.h'
@@ -291,11 +649,7 @@ class SpriteItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -308,14 +662,29 @@ class SpriteItem:
         grit_data = re.sub(r'Tiles\[([0-9]+)]', 'Tiles[' + str(tiles_count) + ']', grit_data)
         grit_data = re.sub(r'Pal\[([0-9]+)]', 'Pal[' + str(self.__colors_count) + ']', grit_data)
 
+        if tiles_delta is not None:
+            total_size += len(tiles_delta) * 2
+
         with open(header_file_path, 'w') as header_file:
             include_guard = 'BN_SPRITE_ITEMS_' + name.upper() + '_H'
             header_file.write('#ifndef ' + include_guard + '\n')
             header_file.write('#define ' + include_guard + '\n')
             header_file.write('\n')
             header_file.write('#include "bn_sprite_item.h"' + '\n')
+
+            if tiles_delta is not None:
+                header_file.write('#include "bn_sprite_tiles_delta_item.h"' + '\n')
+
             header_file.write(grit_data)
             header_file.write('\n')
+
+            if tiles_delta is not None:
+                write_sprite_tiles_delta(header_file, name + '_bn_tiles_delta', tiles_delta)
+
+            if palette_group_index is not None:
+                header_file.write('#include "bn_sprite_palette_items_' + self.__palette_group + '.h"' + '\n')
+                header_file.write('\n')
+
             header_file.write('namespace bn::sprite_items' + '\n')
             header_file.write('{' + '\n')
             header_file.write('    constexpr inline sprite_item ' + name + '(' +
@@ -323,10 +692,23 @@ class SpriteItem:
                               'sprite_size::' + self.__size + '), ' + '\n            ' +
                               'sprite_tiles_item(span<const tile>(' + name + '_bn_gfxTiles, ' +
                               str(tiles_count) + '), ' + bpp_mode_label + ', ' + compression_label(tiles_compression) +
-                              ', ' + str(self.__graphics) + '), ' + '\n            ' +
-                              'sprite_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
-                              str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
-                              compression_label(palette_compression) + '));\n')
+                              ', ' + str(self.__graphics) + '), ' + '\n            ')
+
+            if palette_group_index is None:
+                header_file.write('sprite_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
+                                  str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
+                                  compression_label(palette_compression) + '));\n')
+            else:
+                header_file.write('bn::sprite_palette_items::' + self.__palette_group + '_' +
+                                  str(palette_group_index) + ');\n')
+
+            if tiles_delta is not None:
+                header_file.write('\n')
+                header_file.write('    constexpr inline sprite_tiles_delta_item ' + name + '_tiles_delta(' +
+                                  name + '.tiles_item(), ' + '\n            ' +
+                                  'span<const uint16_t>(' + name + '_bn_tiles_delta, ' +
+                                  str(len(tiles_delta)) + '));' + '\n')
+
             header_file.write('}' + '\n')
             header_file.write('\n')
             header_file.write('#endif' + '\n')
@@ -334,7 +716,7 @@ class SpriteItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, tiles_compression, palette_compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-gt', '-pe' + str(self.__colors_count), '-Mw', str(self.__width / 8),
                    '-Mh', str(self.__height / 8)]
 
@@ -343,8 +725,6 @@ class SpriteItem:
         else:
             command.append('-gB4')
 
-        append_compression_command('g', tiles_compression, command)
-        append_compression_command('p', palette_compression, command)
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -395,31 +775,19 @@ class SpriteTilesItem:
         except KeyError:
             self.__compression = 'none'
 
-    def process(self, grit):
-        compression = self.__compression
-
-        if compression.startswith('auto'):
-            test_huffman = compression == 'auto'
-            compression, file_size = self.__test_compression(grit, compression, 'none', None)
-            compression, file_size = self.__test_compression(grit, compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(grit, compression, 'lz77', file_size)
+    def process(self, grit, compressions):
+        compression = cached_compression(self.__compression, compressions, 'data')
 
-            if test_huffman:
-                compression, file_size = self.__test_compression(grit, compression, 'huffman', file_size)
+        self.__execute_command(grit)
+        grit_data = GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
+        compression = grit_data.compress('Tiles', compression)
+        grit_data.write()
 
-        self.__execute_command(grit, compression)
-        return self.__write_header(compression, False)
+        compressions['data'] = compression
 
-    def __test_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression)
-        new_file_size = self.__write_header(new_compression, True)
+        return self.__write_header(compression)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, compression, skip_write):
+    def __write_header(self, compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_sprite_tiles_items_' + name + '.h'
@@ -439,11 +807,7 @@ class SpriteTilesItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -481,7 +845,7 @@ class SpriteTilesItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-gt', '-p!', '-Mw', str(self.__width / 8), '-Mh', str(self.__height / 8)]
 
         if self.__bpp_8:
@@ -489,7 +853,6 @@ class SpriteTilesItem:
         else:
             command.append('-gB4')
 
-        append_compression_command('g', compression, command)
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -515,31 +878,19 @@ class SpritePaletteItem:
         except KeyError:
             self.__compression = 'none'
 
-    def process(self, grit):
-        compression = self.__compression
-
-        if compression.startswith('auto'):
-            test_huffman = compression == 'auto'
-            compression, file_size = self.__test_compression(grit, compression, 'none', None)
-            compression, file_size = self.__test_compression(grit, compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(grit, compression, 'lz77', file_size)
+    def process(self, grit, compressions):
+        compression = cached_compression(self.__compression, compressions, 'data')
 
-            if test_huffman:
-                compression, file_size = self.__test_compression(grit, compression, 'huffman', file_size)
+        self.__execute_command(grit)
+        grit_data = GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
+        compression = grit_data.compress('Pal', compression)
+        grit_data.write()
 
-        self.__execute_command(grit, compression)
-        return self.__write_header(compression, False)
+        compressions['data'] = compression
 
-    def __test_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression)
-        new_file_size = self.__write_header(new_compression, True)
+        return self.__write_header(compression)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, compression, skip_write):
+    def __write_header(self, compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_sprite_palette_items_' + name + '.h'
@@ -551,11 +902,7 @@ class SpritePaletteItem:
             for grit_line in grit_data.splitlines():
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -587,9 +934,8 @@ class SpritePaletteItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-g!', '-pe' + str(self.__colors_count)]
-        append_compression_command('p', compression, command)
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -653,6 +999,12 @@ class RegularBgItem:
         else:
             self.__sbb = width == 512 or height == 512
 
+        self.__collision_colors = parse_collision_colors(info)
+        self.__tiles_group = parse_group(info, 'tiles_group')
+
+        if self.__collision_colors is not None:
+            self.__collision_bmp = bmp
+
         try:
             self.__repeated_tiles_reduction = bool(info['repeated_tiles_reduction'])
         except KeyError:
@@ -729,74 +1081,50 @@ class RegularBgItem:
             except KeyError:
                 self.__map_compression = 'none'
 
-    def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-        map_compression = self.__map_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
+    def file_name_no_ext(self):
+        return self.__file_name_no_ext
 
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
+    def tiles_group(self):
+        return self.__tiles_group
 
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
+    def bpp_8(self):
+        return self.__bpp_8
 
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
+    def flipped_tiles_reduction(self):
+        return self.__flipped_tiles_reduction
 
-        if map_compression.startswith('auto'):
-            test_huffman = map_compression == 'auto'
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'none', None)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'run_length', file_size)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'lz77', file_size)
+    def tiles_compression(self):
+        return self.__tiles_compression
 
-            if test_huffman:
-                map_compression, file_size = self.__test_map_compression(grit, map_compression, 'huffman', file_size)
+    def extract(self, grit):
+        self.__execute_command(grit)
+        return GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
 
-        self.__execute_command(grit, tiles_compression, palette_compression, map_compression)
-        return self.__write_header(tiles_compression, palette_compression, map_compression, False)
+    def process(self, grit, compressions):
+        tiles_compression = cached_compression(self.__tiles_compression, compressions, 'tiles')
+        palette_compression = cached_compression(self.__palette_compression, compressions, 'palette')
+        map_compression = cached_compression(self.__map_compression, compressions, 'map')
 
-    def __test_tiles_compression(self, grit, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(grit, new_tiles_compression, 'none', 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
+        grit_data = self.extract(grit)
+        tiles_compression = grit_data.compress('Tiles', tiles_compression)
+        palette_compression = grit_data.compress('Pal', palette_compression)
+        map_compression = grit_data.compress('Map', map_compression)
+        grit_data.write()
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
+        compressions['tiles'] = tiles_compression
+        compressions['palette'] = palette_compression
+        compressions['map'] = map_compression
 
-        return best_tiles_compression, best_file_size
+        return self.__write_header(tiles_compression, palette_compression, map_compression, None)
 
-    def __test_palette_compression(self, grit, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_palette_compression, 'none')
-        new_file_size = self.__write_header('none', new_palette_compression, 'none', True)
+    def process_tiles_group_member(self, grit_data, tiles_count):
+        grit_data.remove('Tiles')
+        palette_compression = grit_data.compress('Pal', self.__palette_compression)
+        map_compression = grit_data.compress('Map', self.__map_compression)
+        grit_data.write()
+        return self.__write_header(None, palette_compression, map_compression, tiles_count)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
-
-        return best_palette_compression, best_file_size
-
-    def __test_map_compression(self, grit, best_map_compression, new_map_compression, best_file_size):
-        self.__execute_command(grit, 'none', 'none', new_map_compression)
-        new_file_size = self.__write_header('none', 'none', new_map_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_map_compression, new_file_size
-
-        return best_map_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, map_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression, map_compression, tiles_group_tiles_count):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_regular_bg_items_' + name + '.h'
@@ -818,16 +1146,15 @@ class RegularBgItem:
                         except ValueError:
                             pass
 
+                    if tiles_group_tiles_count is not None:
+                        tiles_count = tiles_group_tiles_count
+
                     if tiles_count > 1024:
                         raise ValueError('Regular BGs with more than 1024 tiles not supported: ' + str(tiles_count))
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -840,25 +1167,48 @@ class RegularBgItem:
         grit_data = re.sub(r'Tiles\[([0-9]+)]', 'Tiles[' + str(tiles_count) + ']', grit_data)
         grit_data = re.sub(r'Pal\[([0-9]+)]', 'Pal[' + str(self.__colors_count) + ']', grit_data)
 
+        if self.__collision_colors is not None:
+            collision_data = collision_words(self.__collision_bmp, self.__collision_colors)
+            total_size += len(collision_data) * 4
+        else:
+            collision_data = None
+
         with open(header_file_path, 'w') as header_file:
             include_guard = 'BN_REGULAR_BG_ITEMS_' + name.upper() + '_H'
             header_file.write('#ifndef ' + include_guard + '\n')
             header_file.write('#define ' + include_guard + '\n')
             header_file.write('\n')
             header_file.write('#include "bn_regular_bg_item.h"' + '\n')
+
+            if collision_data is not None:
+                header_file.write('#include "bn_regular_bg_collision_item.h"' + '\n')
+
             header_file.write(grit_data)
             header_file.write('\n')
 
+            if collision_data is not None:
+                write_collision_words(header_file, name + '_bn_collision', collision_data)
+
+            if self.__tiles_group is not None:
+                header_file.write('#include "bn_regular_bg_tiles_items_' + self.__tiles_group + '.h"' + '\n')
+
+                if self.__palette_item is None:
+                    header_file.write('\n')
+
             if self.__palette_item is not None:
                 header_file.write('#include "bn_bg_palette_items_' + self.__palette_item + '.h"' + '\n')
                 header_file.write('\n')
 
             header_file.write('namespace bn::regular_bg_items' + '\n')
             header_file.write('{' + '\n')
-            header_file.write('    constexpr inline regular_bg_item ' + name + '(' + '\n            ' +
-                              'regular_bg_tiles_item(span<const tile>(' + name + '_bn_gfxTiles, ' +
-                              str(tiles_count) + '), ' + bpp_mode_label + ', ' + compression_label(tiles_compression) +
-                              '), ' + '\n            ')
+            header_file.write('    constexpr inline regular_bg_item ' + name + '(' + '\n            ')
+
+            if self.__tiles_group is None:
+                header_file.write('regular_bg_tiles_item(span<const tile>(' + name + '_bn_gfxTiles, ' +
+                                  str(tiles_count) + '), ' + bpp_mode_label + ', ' +
+                                  compression_label(tiles_compression) + '), ' + '\n            ')
+            else:
+                header_file.write('bn::regular_bg_tiles_items::' + self.__tiles_group + ',' + '\n            ')
 
             if self.__palette_item is None:
                 header_file.write('bg_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
@@ -871,6 +1221,13 @@ class RegularBgItem:
                               'size(' + str(self.__width) + ', ' + str(self.__height) + '), ' +
                               compression_label(map_compression) + ', ' + str(self.__maps) + ', ' +
                               str(self.__big).lower() + '));' + '\n')
+
+            if collision_data is not None:
+                header_file.write('\n')
+                header_file.write('    constexpr inline regular_bg_collision_item ' + name + '_collision(' +
+                                  name + '_bn_collision[0], size(' + str(self.__width) + ', ' +
+                                  str(self.__height) + '), ' + str(self.__maps) + ');' + '\n')
+
             header_file.write('}' + '\n')
             header_file.write('\n')
             header_file.write('#endif' + '\n')
@@ -878,7 +1235,7 @@ class RegularBgItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, tiles_compression, palette_compression, map_compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path]
 
         if self.__colors_count > 0:
@@ -912,9 +1269,6 @@ class RegularBgItem:
         else:
             command.append('-mLf')
 
-        append_compression_command('g', tiles_compression, command)
-        append_compression_command('p', palette_compression, command)
-        append_compression_command('m', map_compression, command)
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -956,55 +1310,22 @@ class RegularBgTilesItem:
             self.__palette_colors_count = 0
             self.__palette_compression = 'none'
 
-    def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
-
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression)
-        return self.__write_header(tiles_compression, palette_compression, False)
-
-    def __test_tiles_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression, 'none')
-        new_file_size = self.__write_header(new_compression, 'none', True)
+    def process(self, grit, compressions):
+        tiles_compression = cached_compression(self.__tiles_compression, compressions, 'tiles')
+        palette_compression = cached_compression(self.__palette_compression, compressions, 'palette')
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
+        self.__execute_command(grit)
+        grit_data = GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
+        tiles_compression = grit_data.compress('Tiles', tiles_compression)
+        palette_compression = grit_data.compress('Pal', palette_compression)
+        grit_data.write()
 
-        return best_compression, best_file_size
+        compressions['tiles'] = tiles_compression
+        compressions['palette'] = palette_compression
 
-    def __test_palette_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_compression)
-        new_file_size = self.__write_header('none', new_compression, True)
+        return self.__write_header(tiles_compression, palette_compression)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_regular_bg_tiles_items_' + name + '.h'
@@ -1031,11 +1352,7 @@ class RegularBgTilesItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1083,7 +1400,7 @@ class RegularBgTilesItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, tiles_compression, palette_compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-m!']
 
         if self.__bpp_8:
@@ -1091,11 +1408,8 @@ class RegularBgTilesItem:
         else:
             command.append('-gB4')
 
-        append_compression_command('g', tiles_compression, command)
-
         if self.__generate_palette:
             command.append('-pe' + str(self.__palette_colors_count))
-            append_compression_command('p', palette_compression, command)
         else:
             command.append('-p!')
 
@@ -1210,74 +1524,25 @@ class AffineBgItem:
             except KeyError:
                 self.__map_compression = 'none'
 
-    def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-        map_compression = self.__map_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
-
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        if map_compression.startswith('auto'):
-            test_huffman = map_compression == 'auto'
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'none', None)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'run_length', file_size)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'lz77', file_size)
-
-            if test_huffman:
-                map_compression, file_size = self.__test_map_compression(grit, map_compression, 'huffman', file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression, map_compression)
-        return self.__write_header(tiles_compression, palette_compression, map_compression, False)
-
-    def __test_tiles_compression(self, grit, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(grit, new_tiles_compression, 'none', 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
-
-        return best_tiles_compression, best_file_size
-
-    def __test_palette_compression(self, grit, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_palette_compression, 'none')
-        new_file_size = self.__write_header('none', new_palette_compression, 'none', True)
+    def process(self, grit, compressions):
+        tiles_compression = cached_compression(self.__tiles_compression, compressions, 'tiles')
+        palette_compression = cached_compression(self.__palette_compression, compressions, 'palette')
+        map_compression = cached_compression(self.__map_compression, compressions, 'map')
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
+        self.__execute_command(grit)
+        grit_data = GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
+        tiles_compression = grit_data.compress('Tiles', tiles_compression)
+        palette_compression = grit_data.compress('Pal', palette_compression)
+        map_compression = grit_data.compress('Map', map_compression)
+        grit_data.write()
 
-        return best_palette_compression, best_file_size
+        compressions['tiles'] = tiles_compression
+        compressions['palette'] = palette_compression
+        compressions['map'] = map_compression
 
-    def __test_map_compression(self, grit, best_map_compression, new_map_compression, best_file_size):
-        self.__execute_command(grit, 'none', 'none', new_map_compression)
-        new_file_size = self.__write_header('none', 'none', new_map_compression, True)
+        return self.__write_header(tiles_compression, palette_compression, map_compression)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_map_compression, new_file_size
-
-        return best_map_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, map_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression, map_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_affine_bg_items_' + name + '.h'
@@ -1304,11 +1569,7 @@ class AffineBgItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1354,7 +1615,7 @@ class AffineBgItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, tiles_compression, palette_compression, map_compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-gB8', '-mLa', '-mu8']
 
         if self.__colors_count > 0:
@@ -1367,9 +1628,6 @@ class AffineBgItem:
         else:
             command.append('-mR!')
 
-        append_compression_command('g', tiles_compression, command)
-        append_compression_command('p', palette_compression, command)
-        append_compression_command('m', map_compression, command)
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -1410,55 +1668,22 @@ class AffineBgTilesItem:
             self.__palette_colors_count = 0
             self.__palette_compression = 'none'
 
-    def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
-
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression)
-        return self.__write_header(tiles_compression, palette_compression, False)
-
-    def __test_tiles_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression, 'none')
-        new_file_size = self.__write_header(new_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
+    def process(self, grit, compressions):
+        tiles_compression = cached_compression(self.__tiles_compression, compressions, 'tiles')
+        palette_compression = cached_compression(self.__palette_compression, compressions, 'palette')
 
-        return best_compression, best_file_size
+        self.__execute_command(grit)
+        grit_data = GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
+        tiles_compression = grit_data.compress('Tiles', tiles_compression)
+        palette_compression = grit_data.compress('Pal', palette_compression)
+        grit_data.write()
 
-    def __test_palette_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_compression)
-        new_file_size = self.__write_header('none', new_compression, True)
+        compressions['tiles'] = tiles_compression
+        compressions['palette'] = palette_compression
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
+        return self.__write_header(tiles_compression, palette_compression)
 
-        return best_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_affine_bg_tiles_items_' + name + '.h'
@@ -1485,11 +1710,7 @@ class AffineBgTilesItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1532,13 +1753,11 @@ class AffineBgTilesItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, tiles_compression, palette_compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-gB8', '-m!']
-        append_compression_command('g', tiles_compression, command)
 
         if self.__generate_palette:
             command.append('-pe' + str(self.__palette_colors_count))
-            append_compression_command('p', palette_compression, command)
         else:
             command.append('-p!')
 
@@ -1567,31 +1786,19 @@ class BgPaletteItem:
         except KeyError:
             self.__compression = 'none'
 
-    def process(self, grit):
-        compression = self.__compression
-
-        if compression.startswith('auto'):
-            test_huffman = compression == 'auto'
-            compression, file_size = self.__test_compression(grit, compression, 'none', None)
-            compression, file_size = self.__test_compression(grit, compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(grit, compression, 'lz77', file_size)
-
-            if test_huffman:
-                compression, file_size = self.__test_compression(grit, compression, 'huffman', file_size)
+    def process(self, grit, compressions):
+        compression = cached_compression(self.__compression, compressions, 'data')
 
-        self.__execute_command(grit, compression)
-        return self.__write_header(compression, False)
+        self.__execute_command(grit)
+        grit_data = GritData(self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
+        compression = grit_data.compress('Pal', compression)
+        grit_data.write()
 
-    def __test_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression)
-        new_file_size = self.__write_header(new_compression, True)
+        compressions['data'] = compression
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
+        return self.__write_header(compression)
 
-        return best_compression, best_file_size
-
-    def __write_header(self, compression, skip_write):
+    def __write_header(self, compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_bg_palette_items_' + name + '.h'
@@ -1603,11 +1810,7 @@ class BgPaletteItem:
             for grit_line in grit_data.splitlines():
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1639,9 +1842,8 @@ class BgPaletteItem:
 
         return total_size, header_file_path
 
-    def __execute_command(self, grit, compression):
+    def __execute_command(self, grit):
         command = [grit, self.__file_path, '-g!', '-pe' + str(self.__colors_count)]
-        append_compression_command('p', compression, command)
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -1651,6 +1853,311 @@ class BgPaletteItem:
             raise ValueError(grit + ' call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
 
+def flip_tile(tile, bpp_8, horizontal_flip, vertical_flip):
+    row_size = 8 if bpp_8 else 4
+    rows = [tile[row_index:row_index + row_size] for row_index in range(0, len(tile), row_size)]
+
+    if vertical_flip:
+        rows.reverse()
+
+    if horizontal_flip:
+        if bpp_8:
+            rows = [row[::-1] for row in rows]
+        else:
+            rows = [bytes(((value & 0x0F) << 4) | (value >> 4) for value in row[::-1]) for row in rows]
+
+    return b''.join(rows)
+
+
+# Shared tiles of multiple regular BGs with the same tiles_group field.
+#
+# Repeated tiles (and flipped ones if the BG has flipped tiles reduction enabled) are stored only once,
+# and the maps of the BGs reference them with the map cells flip bits.
+class RegularBgTilesGroup:
+
+    def __init__(self, name, build_folder_path, items):
+        self.__name = name
+        self.__build_folder_path = build_folder_path
+        self.__items = items
+        self.__bpp_8 = items[0].bpp_8()
+        self.__tiles_compression = items[0].tiles_compression()
+
+        for item in items:
+            if item.bpp_8() != self.__bpp_8:
+                raise ValueError('All regular BGs of a tiles group must have the same BPP mode: ' +
+                                 item.file_name_no_ext())
+
+            if item.tiles_compression() != self.__tiles_compression:
+                raise ValueError('All regular BGs of a tiles group must have the same tiles compression: ' +
+                                 item.file_name_no_ext())
+
+    def process(self, grit):
+        tile_size = 64 if self.__bpp_8 else 32
+        tiles = []
+        tile_indexes = {}
+        flipped_tile_indexes = {}
+        items_grit_data = []
+        results = []
+
+        for item in self.__items:
+            grit_data = item.extract(grit)
+            item_tiles = grit_data.data('Tiles')
+            item_map = grit_data.data('Map')
+            flipped_tiles_reduction = item.flipped_tiles_reduction()
+            tiles_remap = []
+
+            for tile_index in range(0, len(item_tiles), tile_size):
+                tile = item_tiles[tile_index:tile_index + tile_size]
+                tile_remap = tile_indexes.get(tile)
+
+                if tile_remap is None and flipped_tiles_reduction:
+                    tile_remap = flipped_tile_indexes.get(tile)
+
+                if tile_remap is None:
+                    tile_remap = (len(tiles), 0)
+                    tiles.append(tile)
+                    tile_indexes[tile] = tile_remap
+
+                    for flip in range(1, 4):
+                        flipped_tile = flip_tile(tile, self.__bpp_8, flip & 1, flip & 2)
+                        flipped_tile_indexes.setdefault(flipped_tile, (tile_remap[0], flip))
+
+                tiles_remap.append(tile_remap)
+
+            map_cells = bytearray()
+
+            for map_cell_index in range(0, len(item_map), 2):
+                map_cell = int.from_bytes(item_map[map_cell_index:map_cell_index + 2], 'little')
+                new_tile_index, tile_flip = tiles_remap[map_cell & 0x3FF]
+                map_cell = (map_cell & 0xF000) | ((((map_cell >> 10) & 3) ^ tile_flip) << 10) | new_tile_index
+                map_cells += map_cell.to_bytes(2, 'little')
+
+            grit_data.set_data('Map', map_cells)
+            items_grit_data.append(grit_data)
+
+        tiles_count = len(tiles)
+
+        if tiles_count > 1024:
+            raise ValueError('Regular BG tiles groups with more than 1024 tiles not supported: ' + str(tiles_count))
+
+        for item, grit_data in zip(self.__items, items_grit_data):
+            total_size, header_file_path = item.process_tiles_group_member(grit_data, tiles_count)
+            results.append([item.file_name_no_ext() + '.bmp', header_file_path, total_size])
+
+        results.append(self.__write_tiles(b''.join(tiles), tiles_count))
+        return results
+
+    def __write_tiles(self, tiles_data, tiles_count):
+        name = self.__name
+        label = name + '_bn_gfxTiles'
+
+        # Tiles are stored in the assembly file of the first regular BG, since only the ones named after
+        # graphics files are built:
+        data_file_path = self.__build_folder_path + '/' + self.__items[0].file_name_no_ext() + '_bn_gfx.s'
+        header_file_path = self.__build_folder_path + '/bn_regular_bg_tiles_items_' + name + '.h'
+        compression, tiles_data = best_compression(tiles_data, self.__tiles_compression, label)
+
+        if self.__bpp_8:
+            bpp_mode_label = 'bpp_mode::BPP_8'
+            tiles_count *= 2
+        else:
+            bpp_mode_label = 'bpp_mode::BPP_4'
+
+        with open(data_file_path, 'a') as data_file:
+            data_file.write('\n')
+            data_file.write('\t.section .rodata' + '\n')
+            data_file.write('\t.align\t2' + '\n')
+            data_file.write('\t.global ' + label + '\t\t@ ' + str(len(tiles_data)) + ' unsigned chars' + '\n')
+            data_file.write('\t.hidden ' + label + '\n')
+            data_file.write(label + ':' + '\n')
+            data_file.write('\n'.join(data_lines(tiles_data)) + '\n')
+
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_REGULAR_BG_TILES_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_regular_bg_tiles_item.h"' + '\n')
+            header_file.write('\n')
+            header_file.write('extern const bn::tile ' + label + '[' + str(tiles_count) + '];' + '\n')
+            header_file.write('\n')
+            header_file.write('namespace bn::regular_bg_tiles_items' + '\n')
+            header_file.write('{' + '\n')
+            header_file.write('    constexpr inline regular_bg_tiles_item ' + name + '(' + '\n            ' +
+                              'span<const tile>(' + label + ', ' + str(tiles_count) + '), ' + bpp_mode_label +
+                              ', ' + compression_label(compression) + ');' + '\n')
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
+
+        return [name + ' tiles group', header_file_path, len(tiles_data)]
+
+
+def pack_palettes(color_sets, max_colors):
+    # Color sets which are subsets of other ones don't need their own palette:
+    sorted_color_sets = sorted(set(frozenset(color_set) for color_set in color_sets),
+                               key=lambda color_set: (-len(color_set), sorted(color_set)))
+    palettes = []
+
+    for color_set in sorted_color_sets:
+        if not any(color_set.issubset(palette) for palette in palettes):
+            palettes.append(set(color_set))
+
+    # Merge the pair of palettes with the most shared colors (and then the one which makes more palettes redundant)
+    # until no more pairs fit in one palette:
+    while True:
+        best_merge = None
+
+        for i in range(len(palettes) - 1):
+            i_palette = palettes[i]
+
+            for j in range(i + 1, len(palettes)):
+                j_palette = palettes[j]
+                union = i_palette.union(j_palette)
+
+                if len(union) <= max_colors:
+                    shared_colors = len(i_palette.intersection(j_palette))
+                    quality = shared_colors - (len(union) - shared_colors)
+                    erased_palettes = sum(1 for palette in palettes if palette.issubset(union))
+                    key = (quality, erased_palettes)
+
+                    if best_merge is None or key > best_merge[0]:
+                        best_merge = (key, union)
+
+        if best_merge is None:
+            break
+
+        union = best_merge[1]
+        palettes = [palette for palette in palettes if not palette.issubset(union)]
+        palettes.append(union)
+
+    return [sorted(palette) for palette in palettes]
+
+
+# Shared palettes of multiple sprites with the same palette_group field.
+#
+# The colors used by each sprite are packed in as few 4BPP palettes as possible,
+# and the tiles of each sprite are remapped to the colors of the palette assigned to it.
+class SpritePaletteGroup:
+
+    def __init__(self, name, build_folder_path, items):
+        self.__name = name
+        self.__build_folder_path = build_folder_path
+        self.__items = items
+        self.__palette_compression = items[0].palette_compression()
+
+        for item in items:
+            if item.palette_compression() != self.__palette_compression:
+                raise ValueError('All sprites of a palette group must have the same palette compression: ' +
+                                 item.file_name_no_ext())
+
+    def process(self, grit):
+        items_grit_data = []
+        items_colors = []
+        color_sets = []
+        transparent_color = None
+        results = []
+
+        for item in self.__items:
+            grit_data = item.extract(grit)
+            item_tiles = grit_data.data('Tiles')
+            item_palette = grit_data.data('Pal')
+            item_colors = [int.from_bytes(item_palette[color_index:color_index + 2], 'little')
+                           for color_index in range(0, len(item_palette), 2)]
+            used_color_indexes = set()
+
+            for value in item_tiles:
+                used_color_indexes.add(value & 0x0F)
+                used_color_indexes.add(value >> 4)
+
+            used_color_indexes.discard(0)
+
+            if transparent_color is None:
+                transparent_color = item_colors[0]
+
+            items_grit_data.append(grit_data)
+            items_colors.append(item_colors)
+            color_sets.append(set(item_colors[color_index] for color_index in used_color_indexes))
+
+        palettes = pack_palettes(color_sets, 15)
+
+        for item, grit_data, item_colors, color_set in zip(self.__items, items_grit_data, items_colors, color_sets):
+            palette_index = next(index for index, palette in enumerate(palettes) if color_set.issubset(palette))
+            palette = palettes[palette_index]
+            color_indexes_remap = [0] * 16
+
+            for color_index in range(1, 16):
+                if color_index < len(item_colors) and item_colors[color_index] in color_set:
+                    color_indexes_remap[color_index] = palette.index(item_colors[color_index]) + 1
+
+            tiles = bytes(color_indexes_remap[value & 0x0F] | (color_indexes_remap[value >> 4] << 4)
+                          for value in grit_data.data('Tiles'))
+            grit_data.set_data('Tiles', tiles)
+
+            total_size, header_file_path = item.process_palette_group_member(grit_data, palette_index)
+            results.append([item.file_name_no_ext() + '.bmp', header_file_path, total_size])
+
+        results.append(self.__write_palettes(transparent_color, palettes))
+        return results
+
+    def __write_palettes(self, transparent_color, palettes):
+        name = self.__name
+
+        # Palettes are stored in the assembly file of the first sprite, since only the ones named after
+        # graphics files are built:
+        data_file_path = self.__build_folder_path + '/' + self.__items[0].file_name_no_ext() + '_bn_gfx.s'
+        header_file_path = self.__build_folder_path + '/bn_sprite_palette_items_' + name + '.h'
+        palettes_compression = []
+        total_size = 0
+
+        with open(data_file_path, 'a') as data_file:
+            for palette_index, palette in enumerate(palettes):
+                label = name + '_' + str(palette_index) + '_bn_gfxPal'
+                colors = [transparent_color] + palette + [0] * (15 - len(palette))
+                palette_data = b''.join(color.to_bytes(2, 'little') for color in colors)
+                compression, palette_data = best_compression(palette_data, self.__palette_compression, label)
+                palettes_compression.append(compression)
+                total_size += len(palette_data)
+
+                data_file.write('\n')
+                data_file.write('\t.section .rodata' + '\n')
+                data_file.write('\t.align\t2' + '\n')
+                data_file.write('\t.global ' + label + '\t\t@ ' + str(len(palette_data)) + ' unsigned chars' + '\n')
+                data_file.write('\t.hidden ' + label + '\n')
+                data_file.write(label + ':' + '\n')
+                data_file.write('\n'.join(data_lines(palette_data)) + '\n')
+
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_SPRITE_PALETTE_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_sprite_palette_item.h"' + '\n')
+            header_file.write('\n')
+
+            for palette_index in range(len(palettes)):
+                header_file.write('extern const bn::color ' + name + '_' + str(palette_index) + '_bn_gfxPal[16];' +
+                                  '\n')
+
+            header_file.write('\n')
+            header_file.write('namespace bn::sprite_palette_items' + '\n')
+            header_file.write('{' + '\n')
+
+            for palette_index, compression in enumerate(palettes_compression):
+                palette_name = name + '_' + str(palette_index)
+                header_file.write('    constexpr inline sprite_palette_item ' + palette_name + '(' +
+                                  'span<const color>(' + palette_name + '_bn_gfxPal, 16), ' + '\n            ' +
+                                  'bpp_mode::BPP_4, ' + compression_label(compression) + ');' + '\n')
+
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
+
+        return [name + ' palette group', header_file_path, total_size]
+
+
 class GraphicsFileInfo:
 
     def __init__(self, json_file_path, file_path, file_name, file_name_no_ext, file_info_path):
@@ -1660,63 +2167,298 @@ class GraphicsFileInfo:
         self.__file_name_no_ext = file_name_no_ext
         self.__file_info_path = file_info_path
 
+    def file_name(self):
+        return self.__file_name
+
     def print_file_name(self):
         print(self.__file_name)
 
-    def process(self, grit, build_folder_path):
+    def process(self, grit, build_folder_path, cache):
         try:
-            try:
-                with open(self.__json_file_path) as json_file:
-                    info = json.load(json_file)
-            except Exception as exception:
-                raise ValueError(self.__json_file_path + ' graphics json file parse failed: ' + str(exception))
+            if cache is not None:
+                compressions_key, outputs_key = cache.keys(self.__file_name_no_ext,
+                                                           [self.__file_path, self.__json_file_path])
+                cached_outputs = cache.load_outputs(outputs_key, build_folder_path)
 
-            try:
-                graphics_type = str(info['type'])
-            except KeyError:
-                raise ValueError('type field not found in graphics json file: ' + self.__json_file_path)
-
-            if graphics_type == 'sprite':
-                item = SpriteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'sprite_tiles':
-                item = SpriteTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'sprite_palette':
-                item = SpritePaletteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'regular_bg':
-                item = RegularBgItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'regular_bg_tiles':
-                item = RegularBgTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'affine_bg':
-                item = AffineBgItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'affine_bg_tiles':
-                item = AffineBgTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
-            elif graphics_type == 'bg_palette':
-                item = BgPaletteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+                if cached_outputs is not None:
+                    header_file_path, total_size = cached_outputs
+                    self.write_file_info()
+                    return [[self.__file_name, header_file_path, total_size]]
+
+                compressions = cache.load_compressions(compressions_key)
+            else:
+                compressions_key = None
+                outputs_key = None
+                compressions = {}
+
+            item = self.create_item(build_folder_path)
+            total_size, header_file_path = item.process(grit, compressions)
+
+            if cache is not None:
+                cache.store_compressions(compressions_key, compressions)
+                data_file_path = build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx.s'
+                cache.store_outputs(outputs_key, [header_file_path, data_file_path], header_file_path, total_size)
+
+            self.write_file_info()
+            return [[self.__file_name, header_file_path, total_size]]
+        except Exception as exc:
+            return [[self.__file_name, exc]]
+
+    def create_item(self, build_folder_path):
+        try:
+            with open(self.__json_file_path) as json_file:
+                info = json.load(json_file)
+        except Exception as exception:
+            raise ValueError(self.__json_file_path + ' graphics json file parse failed: ' + str(exception))
+
+        try:
+            graphics_type = str(info['type'])
+        except KeyError:
+            raise ValueError('type field not found in graphics json file: ' + self.__json_file_path)
+
+        if graphics_type == 'sprite':
+            item = SpriteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'sprite_tiles':
+            item = SpriteTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'sprite_palette':
+            item = SpritePaletteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'regular_bg':
+            item = RegularBgItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'regular_bg_tiles':
+            item = RegularBgTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'affine_bg':
+            item = AffineBgItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'affine_bg_tiles':
+            item = AffineBgTilesItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        elif graphics_type == 'bg_palette':
+            item = BgPaletteItem(self.__file_path, self.__file_name_no_ext, build_folder_path, info)
+        else:
+            raise ValueError('Unknown graphics type "' + graphics_type +
+                             '" found in graphics json file: ' + self.__json_file_path)
+
+        return item
+
+    def write_file_info(self):
+        with open(self.__file_info_path, 'w') as file_info:
+            file_info.write('')
+
+
+# Graphics files of the regular BGs with the same tiles_group field,
+# or of the sprites with the same palette_group field.
+#
+# They are processed together and not cached, since the generated files depend on all of them.
+class GraphicsGroupInfo:
+
+    def __init__(self, name, group_type, graphics_file_infos):
+        self.__name = name
+        self.__group_type = group_type
+        self.__graphics_file_infos = graphics_file_infos
+
+    def print_file_name(self):
+        for graphics_file_info in self.__graphics_file_infos:
+            graphics_file_info.print_file_name()
+
+    def process(self, grit, build_folder_path, cache):
+        try:
+            items = [graphics_file_info.create_item(build_folder_path)
+                     for graphics_file_info in self.__graphics_file_infos]
+
+            if self.__group_type == 'tiles_group':
+                group = RegularBgTilesGroup(self.__name, build_folder_path, items)
             else:
-                raise ValueError('Unknown graphics type "' + graphics_type +
-                                 '" found in graphics json file: ' + self.__json_file_path)
+                group = SpritePaletteGroup(self.__name, build_folder_path, items)
 
-            total_size, header_file_path = item.process(grit)
+            results = group.process(grit)
 
-            with open(self.__file_info_path, 'w') as file_info:
-                file_info.write('')
+            for graphics_file_info in self.__graphics_file_infos:
+                graphics_file_info.write_file_info()
 
-            return [self.__file_name, header_file_path, total_size]
+            return results
         except Exception as exc:
-            return [self.__file_name, exc]
+            return [[self.__name + ' ' + self.__group_type.replace('_', ' '), exc]]
 
 
 class GraphicsFileInfoProcessor:
 
-    def __init__(self, grit, build_folder_path):
+    def __init__(self, grit, build_folder_path, cache):
         self.__grit = grit
         self.__build_folder_path = build_folder_path
+        self.__cache = cache
 
     def __call__(self, graphics_file_info):
-        return graphics_file_info.process(self.__grit, self.__build_folder_path)
+        return graphics_file_info.process(self.__grit, self.__build_folder_path, self.__cache)
+
+
+def read_graphics_info(json_file_path):
+    try:
+        with open(json_file_path) as json_file:
+            return json.load(json_file)
+    except Exception:
+        # Errors are reported when the graphics file is processed:
+        return None
+
+
+def read_graphics_group(info):
+    try:
+        graphics_type = str(info['type'])
 
+        if graphics_type == 'regular_bg':
+            group_type = 'tiles_group'
+        elif graphics_type == 'sprite':
+            group_type = 'palette_group'
+        else:
+            return None
+
+        group = parse_group(info, group_type)
+
+        if group is not None:
+            return group_type, group
+    except Exception:
+        # Errors are reported when the graphics file is processed:
+        pass
+
+    return None
+
+
+def graphics_group_header_file_path(build_folder_path, group_type, group):
+    if group_type == 'tiles_group':
+        return build_folder_path + '/bn_regular_bg_tiles_items_' + group + '.h'
+
+    return build_folder_path + '/bn_sprite_palette_items_' + group + '.h'
+
+
+# Graphics types with items registry (bn_<type>_registry.h), and the class name of their items:
+registry_item_types = {
+    'sprite': 'sprite_item',
+    'regular_bg': 'regular_bg_item',
+}
+
+
+def read_graphics_registry_item(info, graphics_file_name_no_ext, json_file_path):
+    try:
+        graphics_type = str(info['type'])
+    except Exception:
+        # Errors are reported when the graphics file is processed:
+        return None
 
-def list_graphics_file_infos(graphics_paths, build_folder_path):
+    if graphics_type not in registry_item_types:
+        return None
+
+    try:
+        registry_group = parse_group(info, 'registry_group')
+    except ValueError as exc:
+        raise ValueError(str(exc) + ' (' + json_file_path + ')')
+
+    return graphics_type, graphics_file_name_no_ext, registry_group
+
+
+def registry_name_hash(name):
+    # Same as bn::hash<bn::string_view>:
+    data = name.encode('ascii')
+    prime = 0x01000193
+    result = 0x811C9DC5
+    words = len(data) // 4
+
+    for word_index in range(words):
+        word = int.from_bytes(data[word_index * 4:word_index * 4 + 4], 'little')
+        result = ((result * prime) & 0xFFFFFFFF) ^ word
+
+    tail = data[words * 4:]
+
+    if len(tail) > 0:
+        value = 0
+
+        for byte in tail:
+            value = (value << 8) + byte
+
+        result = ((result * prime) & 0xFFFFFFFF) ^ value
+
+    return result
+
+
+def write_graphics_registry(build_folder_path, graphics_type, registry_name, item_names):
+    item_class = registry_item_types[graphics_type]
+    namespace = graphics_type + '_registry' + registry_name
+    header_file_path = build_folder_path + '/bn_' + namespace + '.h'
+    include_guard = 'BN_' + namespace.upper() + '_H'
+    entries = sorted([[registry_name_hash(name), name, index] for index, name in enumerate(item_names)])
+
+    lines = ['#ifndef ' + include_guard,
+             '#define ' + include_guard,
+             '',
+             '#include "bn_optional.h"',
+             '#include "bn_items_registry.h"']
+    lines += ['#include "bn_' + graphics_type + '_items_' + name + '.h"' for name in item_names]
+    lines += ['',
+              'namespace bn::' + namespace,
+              '{',
+              '    enum class id : uint16_t',
+              '    {']
+    lines += ['        ' + name + ',' for name in item_names]
+    lines += ['    };',
+              '',
+              '    constexpr inline int count = ' + str(len(item_names)) + ';',
+              '',
+              '    constexpr inline const ' + item_class + '* items[] = {']
+    lines += ['        &' + graphics_type + '_items::' + name + ',' for name in item_names]
+    lines += ['    };',
+              '',
+              '    constexpr inline items_registry_entry entries[] = {']
+    lines += ['        items_registry_entry(' + hex(name_hash) + 'u, "' + name + '", ' + str(index) + '),'
+              for name_hash, name, index in entries]
+    lines += ['    };',
+              '',
+              '    [[nodiscard]] constexpr const ' + item_class + '& item(id item_id)',
+              '    {',
+              '        return *items[int(item_id)];',
+              '    }',
+              '',
+              '    [[nodiscard]] inline optional<id> find_id(const string_view& name)',
+              '    {',
+              '        int index = items_registry_find(entries, name);',
+              '        return index >= 0 ? optional<id>(id(index)) : optional<id>();',
+              '    }',
+              '',
+              '    [[nodiscard]] inline const ' + item_class + '* find(const string_view& name)',
+              '    {',
+              '        int index = items_registry_find(entries, name);',
+              '        return index >= 0 ? items[index] : nullptr;',
+              '    }',
+              '}',
+              '',
+              '#endif',
+              '']
+    header_data = '\n'.join(lines) + '\n'
+
+    # Registries are written only if they have changed, to avoid rebuilding the files which include them:
+    if os.path.isfile(header_file_path):
+        with open(header_file_path, 'r') as header_file:
+            if header_file.read() == header_data:
+                return None
+
+    with open(header_file_path, 'w') as header_file:
+        header_file.write(header_data)
+
+    return header_file_path
+
+
+def write_graphics_registries(build_folder_path, registry_items):
+    registries = {}
+
+    for graphics_type, name, registry_group in sorted(registry_items):
+        registries.setdefault((graphics_type, ''), []).append(name)
+
+        if registry_group is not None:
+            registries.setdefault((graphics_type, '_' + registry_group), []).append(name)
+
+    for (graphics_type, registry_name), item_names in sorted(registries.items()):
+        header_file_path = write_graphics_registry(build_folder_path, graphics_type, registry_name, item_names)
+
+        if header_file_path is not None:
+            print('    ' + graphics_type.replace('_', ' ') + ' registry written in ' + header_file_path)
+
+
+def list_graphics_file_infos(graphics_paths, build_folder_path, registry_items):
     graphics_file_paths = []
 
     for graphics_path in graphics_paths.split(' '):
@@ -1733,6 +2475,7 @@ def list_graphics_file_infos(graphics_paths, build_folder_path):
 
     graphics_file_infos = []
     file_names_set = set()
+    graphics_groups = {}
 
     for graphics_file_path in graphics_file_paths:
         graphics_file_name = os.path.basename(graphics_file_path)
@@ -1768,16 +2511,45 @@ def list_graphics_file_infos(graphics_paths, build_folder_path):
                         json_file_mtime = os.path.getmtime(json_file_path)
                         build = file_info_mtime < json_file_mtime
 
-                if build:
-                    graphics_file_infos.append(GraphicsFileInfo(
-                        json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext,
-                        file_info_path))
+                graphics_file_info = GraphicsFileInfo(
+                    json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext, file_info_path)
+                info = read_graphics_info(json_file_path)
+
+                if info is not None:
+                    graphics_group = read_graphics_group(info)
+                    registry_item = read_graphics_registry_item(info, graphics_file_name_no_ext, json_file_path)
+
+                    if registry_item is not None:
+                        registry_items.append(registry_item)
+                else:
+                    graphics_group = None
+
+                if graphics_group is not None:
+                    graphics_group_files = graphics_groups.setdefault(graphics_group, [[], False])
+                    graphics_group_files[0].append(graphics_file_info)
+                    graphics_group_files[1] = graphics_group_files[1] or build
+                elif build:
+                    graphics_file_infos.append(graphics_file_info)
+
+    for (group_type, group), graphics_group_files in sorted(graphics_groups.items()):
+        if group in file_names_set:
+            raise ValueError('There\'s a graphics file with the same name as a ' + group_type.replace('_', ' ') +
+                             ': ' + group)
+
+        # All graphics files of a group are processed again if any of them has changed:
+        header_file_path = graphics_group_header_file_path(build_folder_path, group_type, group)
+        build = graphics_group_files[1] or not os.path.exists(header_file_path)
+
+        if build:
+            group_graphics_file_infos = sorted(graphics_group_files[0], key=lambda info: info.file_name())
+            graphics_file_infos.append(GraphicsGroupInfo(group, group_type, group_graphics_file_infos))
 
     return graphics_file_infos
 
 
 def process_graphics(grit, graphics_paths, build_folder_path):
-    graphics_file_infos = list_graphics_file_infos(graphics_paths, build_folder_path)
+    registry_items = []
+    graphics_file_infos = list_graphics_file_infos(graphics_paths, build_folder_path, registry_items)
 
     if len(graphics_file_infos) > 0:
         for graphics_file_info in graphics_file_infos:
@@ -1785,14 +2557,19 @@ def process_graphics(grit, graphics_paths, build_folder_path):
 
         sys.stdout.flush()
 
+        tools_folder_path = os.path.dirname(os.path.abspath(__file__))
+        tool_file_paths = [tools_folder_path + '/butano_graphics_tool.py', tools_folder_path + '/bmp.py',
+                           tools_folder_path + '/gba_compression.py', tools_folder_path + '/assets_cache.py']
+        cache = AssetsCache.create(tool_file_paths, grit)
+
         pool = create_pool()
-        process_results = pool.map(GraphicsFileInfoProcessor(grit, build_folder_path), graphics_file_infos)
+        process_results = pool.map(GraphicsFileInfoProcessor(grit, build_folder_path, cache), graphics_file_infos)
         pool.close()
 
         total_size = 0
         process_excs = []
 
-        for process_result in process_results:
+        for process_result in [result for results in process_results for result in results]:
             if len(process_result) == 3:
                 file_size = process_result[2]
                 total_size += file_size
@@ -1810,3 +2587,5 @@ def process_graphics(grit, graphics_paths, build_folder_path):
             exit(-1)
 
         print('    ' + 'Processed graphics size: ' + str(total_size) + ' bytes')
+
+    write_graphics_registries(build_folder_path, registry_items)
@@ -0,0 +1,385 @@
+"""
+Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import heapq
+
+
+def _header(compression_type, data_size):
+    if data_size >= 1 << 24:
+        raise ValueError('Too much data to compress: ' + str(data_size))
+
+    return bytearray([compression_type, data_size & 0xFF, (data_size >> 8) & 0xFF, (data_size >> 16) & 0xFF])
+
+
+def _align(result):
+    while len(result) % 4:
+        result.append(0)
+
+    return bytes(result)
+
+
+def lz77(data):
+    # VRAM safe (no references to the previous byte), as it is decompressed 16 bits at a time:
+    min_offset = 2
+    max_offset = 4096
+    min_length = 3
+    max_length = 18
+    max_chain = 64
+
+    data_size = len(data)
+    result = _header(0x10, data_size)
+    heads = {}
+    previous = [-1] * data_size
+    index = 0
+
+    def insert(position):
+        if position + min_length <= data_size:
+            key = data[position:position + min_length]
+            previous[position] = heads.get(key, -1)
+            heads[key] = position
+
+    while index < data_size:
+        flags_index = len(result)
+        result.append(0)
+        flags = 0
+
+        for block in range(8):
+            if index >= data_size:
+                break
+
+            best_length = 0
+            best_offset = 0
+
+            if index + min_length <= data_size:
+                candidate = heads.get(data[index:index + min_length], -1)
+                length_limit = min(max_length, data_size - index)
+                chain = 0
+
+                while candidate >= 0 and chain < max_chain:
+                    offset = index - candidate
+
+                    if offset > max_offset:
+                        break
+
+                    if offset >= min_offset:
+                        length = min_length
+
+                        while length < length_limit and data[candidate + length] == data[index + length]:
+                            length += 1
+
+                        if length > best_length:
+                            best_length = length
+                            best_offset = offset
+
+                            if length == length_limit:
+                                break
+
+                    candidate = previous[candidate]
+                    chain += 1
+
+            if best_length >= min_length:
+                flags |= 0x80 >> block
+                value = ((best_length - min_length) << 12) | (best_offset - 1)
+                result.append(value >> 8)
+                result.append(value & 0xFF)
+
+                for position in range(index, index + best_length):
+                    insert(position)
+
+                index += best_length
+            else:
+                result.append(data[index])
+                insert(index)
+                index += 1
+
+        result[flags_index] = flags
+
+    return _align(result)
+
+
+def run_length(data):
+    min_run = 3
+    max_run = 130
+    max_literals = 128
+
+    data_size = len(data)
+    result = _header(0x30, data_size)
+    literals_start = 0
+    index = 0
+
+    def flush_literals(end):
+        start = literals_start
+
+        while start < end:
+            count = min(max_literals, end - start)
+            result.append(count - 1)
+            result.extend(data[start:start + count])
+            start += count
+
+    while index < data_size:
+        value = data[index]
+        run = 1
+
+        while index + run < data_size and run < max_run and data[index + run] == value:
+            run += 1
+
+        if run >= min_run:
+            flush_literals(index)
+            result.append(0x80 | (run - min_run))
+            result.append(value)
+            index += run
+            literals_start = index
+        else:
+            index += run
+
+    flush_literals(data_size)
+    return _align(result)
+
+
+class _HuffmanNode:
+
+    def __init__(self, weight, symbol=None, children=None):
+        self.weight = weight
+        self.symbol = symbol
+        self.children = children
+        self.internal_nodes_count = 0 if children is None else \
+            1 + children[0].internal_nodes_count + children[1].internal_nodes_count
+        self.pair_index = 0
+        self.table_index = 0
+        self.flags = 0
+
+    def leaf(self):
+        return self.children is None
+
+
+def _huffman_tree(data):
+    frequencies = [0] * 256
+
+    for value in data:
+        frequencies[value] += 1
+
+    nodes = [_HuffmanNode(frequency, symbol) for symbol, frequency in enumerate(frequencies) if frequency]
+
+    while len(nodes) < 2:
+        # The tree needs at least two leaves:
+        used_symbols = set(node.symbol for node in nodes)
+        nodes.append(_HuffmanNode(0, next(symbol for symbol in range(256) if symbol not in used_symbols)))
+
+    heap = [(node.weight, order, node) for order, node in enumerate(nodes)]
+    heapq.heapify(heap)
+    order = len(heap)
+
+    while len(heap) > 1:
+        first_weight, first_order, first = heapq.heappop(heap)
+        second_weight, second_order, second = heapq.heappop(heap)
+        parent = _HuffmanNode(first_weight + second_weight, children=(first, second))
+        heapq.heappush(heap, (parent.weight, order, parent))
+        order += 1
+
+    return heap[0][2]
+
+
+def _huffman_table(root):
+    # Node children are stored in pairs, and a node can only reference a pair up to 63 pairs after its own one.
+    # Smaller subtrees are placed first (so most subtrees are stored contiguously),
+    # unless the oldest pending node is running out of range:
+    max_offset = 63
+    offset_margin = 8
+    table = [0, 0]
+    pending = [root]
+    pairs_count = 1
+
+    while pending:
+        oldest = min(pending, key=lambda pending_node: pending_node.pair_index)
+
+        if pairs_count - oldest.pair_index - 1 >= max_offset - offset_margin:
+            node = oldest
+        else:
+            node = min(pending, key=lambda pending_node: (pending_node.internal_nodes_count, pending_node.pair_index))
+
+        pending.remove(node)
+        offset = pairs_count - node.pair_index - 1
+
+        if offset > max_offset:
+            return None
+
+        node.flags = offset
+        node.table_index = len(table)
+
+        for child_index, child in enumerate(node.children):
+            child.pair_index = pairs_count
+
+            if child.leaf():
+                node.flags |= 0x80 >> child_index
+                table.append(child.symbol)
+            else:
+                table.append(0)
+                pending.append(child)
+
+        pairs_count += 1
+
+    # Node bytes are written after placing their children, since offsets are not known before:
+    nodes = [(root, 1)]
+
+    while nodes:
+        node, table_index = nodes.pop()
+        table[table_index] = node.flags
+
+        for child_index, child in enumerate(node.children):
+            if not child.leaf():
+                nodes.append((child, node.table_index + child_index))
+
+    return table
+
+
+def _huffman_codes(root):
+    codes = {}
+    nodes = [(root, '')]
+
+    while nodes:
+        node, code = nodes.pop()
+
+        if node.leaf():
+            codes[node.symbol] = code
+        else:
+            nodes.append((node.children[0], code + '0'))
+            nodes.append((node.children[1], code + '1'))
+
+    return codes
+
+
+def huffman(data):
+    root = _huffman_tree(data)
+    table = _huffman_table(root)
+
+    if table is None:
+        return None
+
+    # First table byte is the tree size, so the tree data must end at a word boundary:
+    while len(table) % 4:
+        table.append(0)
+
+    table[0] = (len(table) // 2) - 1
+    result = _header(0x28, len(data))
+    result.extend(table)
+
+    codes = _huffman_codes(root)
+    bits = ''.join(codes[value] for value in data)
+    bits += '0' * (-len(bits) % 32)
+
+    for bit_index in range(0, len(bits), 32):
+        result.extend(int(bits[bit_index:bit_index + 32], 2).to_bytes(4, 'little'))
+
+    return _align(result)
+
+
+def fast_lz(data):
+    # Word granularity LZ, so it can be decompressed with word reads and writes only (see bn_hw_decompress).
+    # Each sequence is a control word (literals count, match words count and match offset in words)
+    # followed by its literal words:
+    data_size = len(data)
+
+    if data_size % 4:
+        return None
+
+    min_length = 2
+    max_length = 255
+    max_literals = 255
+    max_offset = 65535
+    max_chain = 64
+
+    words = [int.from_bytes(data[index:index + 4], 'little') for index in range(0, data_size, 4)]
+    words_count = len(words)
+    result = _header(0x40, data_size)
+    heads = {}
+    previous = [-1] * words_count
+    literals_start = 0
+    index = 0
+
+    def insert(position):
+        if position + min_length <= words_count:
+            key = (words[position], words[position + 1])
+            previous[position] = heads.get(key, -1)
+            heads[key] = position
+
+    def append_sequence(literals_count, match_length, match_offset):
+        result.extend((literals_count | (match_length << 8) | (match_offset << 16)).to_bytes(4, 'little'))
+
+        for literal_index in range(literals_start, literals_start + literals_count):
+            result.extend(words[literal_index].to_bytes(4, 'little'))
+
+    while index < words_count:
+        best_length = 0
+        best_offset = 0
+
+        if index + min_length <= words_count:
+            candidate = heads.get((words[index], words[index + 1]), -1)
+            length_limit = min(max_length, words_count - index)
+            chain = 0
+
+            while candidate >= 0 and chain < max_chain:
+                offset = index - candidate
+
+                if offset > max_offset:
+                    break
+
+                length = min_length
+
+                while length < length_limit and words[candidate + length] == words[index + length]:
+                    length += 1
+
+                if length > best_length:
+                    best_length = length
+                    best_offset = offset
+
+                    if length == length_limit:
+                        break
+
+                candidate = previous[candidate]
+                chain += 1
+
+        if best_length >= min_length:
+            while index - literals_start > max_literals:
+                append_sequence(max_literals, 0, 0)
+                literals_start += max_literals
+
+            append_sequence(index - literals_start, best_length, best_offset)
+
+            for position in range(index, index + best_length):
+                insert(position)
+
+            index += best_length
+            literals_start = index
+        else:
+            insert(index)
+            index += 1
+
+    while literals_start < words_count:
+        literals_count = min(max_literals, words_count - literals_start)
+        append_sequence(literals_count, 0, 0)
+        literals_start += literals_count
+
+    return bytes(result)
+
+
+def compress(data, compression):
+    data = bytes(data)
+
+    if compression == 'none':
+        return data
+
+    if compression == 'lz77':
+        return lz77(data)
+
+    if compression == 'run_length':
+        return run_length(data)
+
+    if compression == 'huffman':
+        return huffman(data)
+
+    if compression == 'fast_lz':
+        return fast_lz(data)
+
+    raise ValueError('Unknown compression: ' + str(compression))
@@ -20,6 +20,27 @@
 
 namespace
 {
+    void move_camera(bn::camera_ptr& camera)
+    {
+        if(bn::keypad::left_held())
+        {
+            camera.set_x(camera.x() - 1);
+        }
+        else if(bn::keypad::right_held())
+        {
+            camera.set_x(camera.x() + 1);
+        }
+
+        if(bn::keypad::up_held())
+        {
+            camera.set_y(camera.y() - 1);
+        }
+        else if(bn::keypad::down_held())
+        {
+            camera.set_y(camera.y() + 1);
+        }
+    }
+
     void camera_scene(bn::camera_ptr& camera, bn::sprite_text_generator& text_generator)
     {
         constexpr bn::string_view info_text_lines[] = {
@@ -32,28 +53,39 @@ namespace
 
         while(! bn::keypad::start_pressed())
         {
-            if(bn::keypad::left_held())
-            {
-                camera.set_x(camera.x() - 1);
-            }
-            else if(bn::keypad::right_held())
-            {
-                camera.set_x(camera.x() + 1);
-            }
-
-            if(bn::keypad::up_held())
-            {
-                camera.set_y(camera.y() - 1);
-            }
-            else if(bn::keypad::down_held())
-            {
-                camera.set_y(camera.y() + 1);
-            }
+            move_camera(camera);
+            info.update();
+            bn::core::update();
+        }
 
+        camera.set_position(0, 0);
+    }
+
+    void parallax_camera_scene(bn::camera_ptr& camera, bn::regular_bg_ptr& clouds_bg,
+                               bn::sprite_text_generator& text_generator)
+    {
+        constexpr bn::string_view info_text_lines[] = {
+            "PAD: move camera",
+            "Clouds follow it at half speed",
+            "",
+            "START: go to next scene",
+        };
+
+        common::info info("Parallax camera", info_text_lines, text_generator);
+
+        // Parallax cameras follow their parent camera, so only the parent camera needs to be moved.
+        // This one is destroyed at the end of the scene, so its ID is reused the next time the scene is shown:
+        bn::camera_ptr clouds_camera = bn::camera_ptr::create_parallax(camera, bn::fixed_point(0.5, 0.5));
+        clouds_bg.set_camera(clouds_camera);
+
+        while(! bn::keypad::start_pressed())
+        {
+            move_camera(camera);
             info.update();
             bn::core::update();
         }
 
+        clouds_bg.remove_camera();
         camera.set_position(0, 0);
     }
 
@@ -113,5 +145,8 @@ int main()
 
         camera_actions_scene(camera, text_generator);
         bn::core::update();
+
+        parallax_camera_scene(camera, clouds_bg, text_generator);
+        bn::core::update();
     }
 }
@@ -7,7 +7,6 @@
 #include "bn_keypad.h"
 #include "bn_regular_bg_ptr.h"
 #include "bn_sprite_text_generator.h"
-#include "bn_regular_bg_map_cell_info.h"
 
 #include "bn_sprite_items_dog.h"
 #include "bn_regular_bg_items_map.h"
@@ -30,8 +29,7 @@ int main()
     bn::sprite_ptr dog_sprite = bn::sprite_items::dog.create_sprite(0, 0);
 
     const bn::regular_bg_map_item& map_item = bn::regular_bg_items::map.map_item();
-    bn::regular_bg_map_cell valid_map_cell = map_item.cell(0, 0);
-    int valid_tile_index = bn::regular_bg_map_cell_info(valid_map_cell).tile_index();
+    const bn::regular_bg_collision_item& collision_item = bn::regular_bg_items::map_collision;
     bn::point dog_map_position(16, 16);
 
     while(true)
@@ -58,10 +56,7 @@ int main()
             new_dog_map_position.set_y(new_dog_map_position.y() + 1);
         }
 
-        bn::regular_bg_map_cell dog_map_cell = map_item.cell(new_dog_map_position);
-        int dog_tile_index = bn::regular_bg_map_cell_info(dog_map_cell).tile_index();
-
-        if(dog_tile_index == valid_tile_index)
+        if(collision_item.cell_type(new_dog_map_position) == bn::regular_bg_collision_cell_type::EMPTY)
         {
             dog_map_position = new_dog_map_position;
         }
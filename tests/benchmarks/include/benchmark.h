@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "bn_timer.h"
+#include "bn_string_view.h"
+
+/**
+ * Registers a benchmark which runs its operation the given number of iterations.
+ *
+ * Its body must contain a loop like this one:
+ *
+ * while(state.keep_running())
+ * {
+ *     // Measured operation
+ * }
+ *
+ * Code before and after the loop (like initialization) is not measured.
+ */
+#define BN_BENCHMARK_ITERATIONS(name, iterations) \
+    static void _benchmark_##name(benchmark_state& state); \
+    [[maybe_unused]] static benchmark _benchmark_##name##_registration(#name, _benchmark_##name, iterations); \
+    static void _benchmark_##name(benchmark_state& state)
+
+/**
+ * Registers a benchmark which runs its operation the default number of iterations.
+ */
+#define BN_BENCHMARK(name) \
+    BN_BENCHMARK_ITERATIONS(name, benchmark::default_iterations)
+
+
+class benchmark_state
+{
+
+public:
+    explicit benchmark_state(int iterations) :
+        _pending_iterations(iterations)
+    {
+    }
+
+    [[nodiscard]] int iterations() const
+    {
+        return _iterations;
+    }
+
+    [[nodiscard]] int elapsed_ticks() const
+    {
+        return _elapsed_ticks;
+    }
+
+    [[nodiscard]] bool keep_running()
+    {
+        if(_remaining_iterations) [[likely]]
+        {
+            --_remaining_iterations;
+            return true;
+        }
+
+        return _next();
+    }
+
+    template<typename Type>
+    static void do_not_optimize(Type& value)
+    {
+        asm volatile("" : "+r,m"(value) : : "memory");
+    }
+
+    static void clobber_memory()
+    {
+        asm volatile("" : : : "memory");
+    }
+
+private:
+    bn::timer _timer;
+    int _remaining_iterations = 0;
+    int _pending_iterations;
+    int _iterations = 0;
+    int _elapsed_ticks = 0;
+
+    [[nodiscard]] bool _next();
+};
+
+
+using benchmark_function = void(*)(benchmark_state&);
+
+
+class benchmark
+{
+
+public:
+    static constexpr int default_iterations = 1000;
+
+    benchmark(const char* name, benchmark_function function, int iterations);
+
+    benchmark(const benchmark& other) = delete;
+
+    benchmark& operator=(const benchmark& other) = delete;
+
+    [[nodiscard]] static benchmark* first()
+    {
+        return _first;
+    }
+
+    [[nodiscard]] bn::string_view name() const
+    {
+        return _name;
+    }
+
+    [[nodiscard]] int iterations() const
+    {
+        return _iterations;
+    }
+
+    [[nodiscard]] benchmark* next() const
+    {
+        return _next;
+    }
+
+    /**
+     * Runs the benchmark once with an eighth of its iterations as warm-up (not measured),
+     * and then the given number of repetitions with all of its iterations.
+     *
+     * Returns the minimum elapsed CPU cycles of the measured repetitions,
+     * without the cost of the loop itself.
+     */
+    [[nodiscard]] int run(int repetitions) const;
+
+private:
+    inline static benchmark* _first = nullptr;
+    inline static benchmark* _last = nullptr;
+
+    const char* _name;
+    benchmark_function _function;
+    int _iterations;
+    benchmark* _next = nullptr;
+};
+
+#endif
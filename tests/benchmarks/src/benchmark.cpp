@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "benchmark.h"
+
+#include "bn_core.h"
+#include "bn_limits.h"
+#include "bn_config_timer.h"
+
+namespace
+{
+    void _empty_benchmark(benchmark_state& state)
+    {
+        while(state.keep_running())
+        {
+            benchmark_state::clobber_memory();
+        }
+    }
+
+    [[nodiscard]] int _run_once(benchmark_function function, int iterations)
+    {
+        benchmark_state state(iterations);
+        function(state);
+        BN_ASSERT(state.iterations() == iterations, "Benchmark loop exited early: ", state.iterations());
+
+        return state.elapsed_ticks() * BN_CFG_TIMER_FREQUENCY;
+    }
+
+    [[nodiscard]] int _run_min(benchmark_function function, int iterations, int repetitions)
+    {
+        int result = bn::numeric_limits<int>::max();
+
+        for(int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            // Start right after V-Blank to reduce interrupts noise:
+            bn::core::update();
+
+            result = bn::min(result, _run_once(function, iterations));
+        }
+
+        return result;
+    }
+}
+
+bool benchmark_state::_next()
+{
+    if(int pending_iterations = _pending_iterations)
+    {
+        _pending_iterations = 0;
+        _iterations = pending_iterations;
+        _remaining_iterations = pending_iterations - 1;
+        _timer.restart();
+        return true;
+    }
+
+    _elapsed_ticks = _timer.elapsed_ticks();
+    return false;
+}
+
+benchmark::benchmark(const char* name, benchmark_function function, int iterations) :
+    _name(name),
+    _function(function),
+    _iterations(iterations)
+{
+    BN_ASSERT(iterations > 0, "Invalid iterations: ", iterations);
+
+    if(_last)
+    {
+        _last->_next = this;
+    }
+    else
+    {
+        _first = this;
+    }
+
+    _last = this;
+}
+
+int benchmark::run(int repetitions) const
+{
+    BN_ASSERT(repetitions > 0, "Invalid repetitions: ", repetitions);
+
+    int iterations = _iterations;
+
+    if(int warm_up_iterations = iterations / 8)
+    {
+        [[maybe_unused]] int warm_up_cycles = _run_once(_function, warm_up_iterations);
+    }
+
+    int cycles = _run_min(_function, iterations, repetitions);
+    int loop_cycles = _run_min(_empty_benchmark, iterations, repetitions);
+    return bn::max(cycles - loop_cycles, 0);
+}
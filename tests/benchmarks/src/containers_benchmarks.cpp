@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_random.h"
+#include "bn_unique_ptr.h"
+#include "bn_unordered_map.h"
+
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int map_size = 256;
+
+    using map_type = bn::unordered_map<int, int, map_size>;
+
+    [[nodiscard]] bn::unique_ptr<map_type> _create_map()
+    {
+        bn::unique_ptr<map_type> result(new map_type());
+        bn::random random;
+
+        while(! result->full())
+        {
+            result->insert_or_assign(int(random.get() << 1), 0);
+        }
+
+        return result;
+    }
+}
+
+BN_BENCHMARK(unordered_map_insert_erase)
+{
+    bn::unique_ptr<map_type> map(new map_type());
+    int key = 0;
+
+    while(state.keep_running())
+    {
+        map->insert(key, key);
+
+        if(map->full())
+        {
+            map->clear();
+        }
+
+        ++key;
+    }
+}
+
+BN_BENCHMARK(unordered_map_find_hit)
+{
+    bn::unique_ptr<map_type> map = _create_map();
+    map_type::iterator it = map->begin();
+    int found = 0;
+
+    while(state.keep_running())
+    {
+        found += map->contains(it->first);
+        ++it;
+
+        if(it == map->end())
+        {
+            it = map->begin();
+        }
+    }
+
+    benchmark_state::do_not_optimize(found);
+}
+
+BN_BENCHMARK(unordered_map_find_miss)
+{
+    bn::unique_ptr<map_type> map = _create_map();
+    bn::random random;
+    int found = 0;
+
+    while(state.keep_running())
+    {
+        found += map->contains(int(random.get() << 1) | 1);
+    }
+
+    benchmark_state::do_not_optimize(found);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_array.h"
+#include "bn_unique_ptr.h"
+
+#include "../../butano/hw/include/bn_hw_decompress.h"
+
+#include "bn_regular_bg_items_butano_huge_rl.h"
+#include "bn_regular_bg_items_butano_huge_huff.h"
+#include "bn_regular_bg_items_butano_huge_lz77.h"
+#include "bn_regular_bg_items_butano_huge_fast_lz.h"
+
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int decompress_iterations = 4;
+
+    using decompress_buffer = bn::array<uint8_t, 64 * 1024>;
+
+    [[nodiscard]] bn::unique_ptr<decompress_buffer> _create_buffer()
+    {
+        return bn::unique_ptr<decompress_buffer>(new decompress_buffer());
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(rl_wram, decompress_iterations)
+{
+    const bn::tile* tiles = bn::regular_bg_items::butano_huge_rl.tiles_item().tiles_ref().data();
+    bn::unique_ptr<decompress_buffer> buffer = _create_buffer();
+
+    while(state.keep_running())
+    {
+        bn::hw::decompress::rl_wram(tiles, buffer->data());
+        benchmark_state::clobber_memory();
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(rl_vram, decompress_iterations)
+{
+    const bn::tile* tiles = bn::regular_bg_items::butano_huge_rl.tiles_item().tiles_ref().data();
+    bn::unique_ptr<decompress_buffer> buffer = _create_buffer();
+
+    while(state.keep_running())
+    {
+        bn::hw::decompress::rl_vram(tiles, buffer->data());
+        benchmark_state::clobber_memory();
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(lz77, decompress_iterations)
+{
+    const bn::tile* tiles = bn::regular_bg_items::butano_huge_lz77.tiles_item().tiles_ref().data();
+    bn::unique_ptr<decompress_buffer> buffer = _create_buffer();
+
+    while(state.keep_running())
+    {
+        bn::hw::decompress::lz77(tiles, buffer->data());
+        benchmark_state::clobber_memory();
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(huff, decompress_iterations)
+{
+    const bn::tile* tiles = bn::regular_bg_items::butano_huge_huff.tiles_item().tiles_ref().data();
+    bn::unique_ptr<decompress_buffer> buffer = _create_buffer();
+
+    while(state.keep_running())
+    {
+        bn::hw::decompress::huff(tiles, buffer->data());
+        benchmark_state::clobber_memory();
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(fast_lz, decompress_iterations)
+{
+    const bn::tile* tiles = bn::regular_bg_items::butano_huge_fast_lz.tiles_item().tiles_ref().data();
+    bn::unique_ptr<decompress_buffer> buffer = _create_buffer();
+
+    while(state.keep_running())
+    {
+        bn::hw::decompress::fast_lz(tiles, buffer->data());
+        benchmark_state::clobber_memory();
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_log.h"
+#include "bn_core.h"
+#include "bn_colors.h"
+#include "bn_sprite_ptr.h"
+#include "bn_bg_palettes.h"
+#include "bn_config_log.h"
+#include "bn_sprite_text_generator.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+#include "benchmark.h"
+
+#if ! BN_CFG_LOG_ENABLED
+    static_assert(false, "Enable logs in bn_config_log.h to run benchmarks");
+#endif
+
+// Results are logged in CSV format, so the suite can be run headless in an emulator with logging support
+// (like mGBA) and its output parsed by a script. The last line is always "benchmarks_end".
+
+namespace
+{
+    constexpr int repetitions = 3;
+}
+
+int main()
+{
+    bn::core::init();
+
+    bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+    text_generator.set_center_alignment();
+
+    auto text = text_generator.generate<8>(0, 0, "Running benchmarks...");
+    bn::bg_palettes::set_transparent_color(bn::colors::gray);
+    bn::core::update();
+
+    BN_LOG("benchmark,iterations,cycles,cycles_per_op");
+
+    for(const benchmark* item = benchmark::first(); item; item = item->next())
+    {
+        int iterations = item->iterations();
+        int cycles = item->run(repetitions);
+        auto cycles_per_op_hundredths = int((int64_t(cycles) * 100) / iterations);
+        int cycles_per_op_integer = cycles_per_op_hundredths / 100;
+        int cycles_per_op_fraction = cycles_per_op_hundredths % 100;
+
+        BN_LOG(item->name(), ',', iterations, ',', cycles, ',', cycles_per_op_integer, '.',
+               cycles_per_op_fraction < 10 ? "0" : "", cycles_per_op_fraction);
+    }
+
+    BN_LOG("benchmarks_end");
+    text = text_generator.generate<8>(0, 0, "Benchmarks finished");
+
+    while(true)
+    {
+        bn::core::update();
+    }
+}
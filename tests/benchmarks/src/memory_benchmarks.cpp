@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_array.h"
+#include "bn_memory.h"
+#include "bn_cstring.h"
+#include "bn_unique_ptr.h"
+
+#include "../../butano/hw/include/bn_hw_dma.h"
+#include "../../butano/hw/include/bn_hw_memory.h"
+
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int max_bytes = 4096;
+
+    class memory_buffers
+    {
+
+    public:
+        alignas(int) bn::array<uint8_t, max_bytes + 4> source = {};
+        alignas(int) bn::array<uint8_t, max_bytes + 4> destination = {};
+    };
+
+    [[nodiscard]] bn::unique_ptr<memory_buffers> _create_buffers()
+    {
+        return bn::unique_ptr<memory_buffers>(new memory_buffers());
+    }
+
+    template<int Bytes, int SourceOffset, int DestinationOffset>
+    void _memcpy(benchmark_state& state)
+    {
+        bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+        const uint8_t* source = buffers->source.data() + SourceOffset;
+        uint8_t* destination = buffers->destination.data() + DestinationOffset;
+
+        while(state.keep_running())
+        {
+            bn::memcpy(destination, source, Bytes);
+            benchmark_state::do_not_optimize(destination);
+        }
+    }
+
+    template<int Bytes>
+    void _copy_half_words(benchmark_state& state)
+    {
+        bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+        uint8_t* destination = buffers->destination.data();
+
+        while(state.keep_running())
+        {
+            bn::hw::memory::copy_half_words(buffers->source.data(), Bytes / 2, destination);
+            benchmark_state::do_not_optimize(destination);
+        }
+    }
+
+    template<int Bytes>
+    void _copy_words(benchmark_state& state)
+    {
+        bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+        uint8_t* destination = buffers->destination.data();
+
+        while(state.keep_running())
+        {
+            bn::hw::memory::copy_words(buffers->source.data(), Bytes / 4, destination);
+            benchmark_state::do_not_optimize(destination);
+        }
+    }
+
+    template<int Bytes>
+    void _dma_copy_words(benchmark_state& state)
+    {
+        bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+        uint8_t* destination = buffers->destination.data();
+
+        while(state.keep_running())
+        {
+            bn::hw::dma::copy_words(buffers->source.data(), Bytes / 4, destination);
+            benchmark_state::do_not_optimize(destination);
+        }
+    }
+
+    template<int Bytes, int LhsOffset, int RhsOffset>
+    void _memcmp(benchmark_state& state)
+    {
+        bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+        const uint8_t* lhs = buffers->source.data() + LhsOffset;
+        const uint8_t* rhs = buffers->destination.data() + RhsOffset;
+        int result = 0;
+
+        while(state.keep_running())
+        {
+            result += bn::memcmp(lhs, rhs, Bytes);
+            benchmark_state::do_not_optimize(result);
+        }
+    }
+}
+
+BN_BENCHMARK(memcpy_16)
+{
+    _memcpy<16, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcpy_64)
+{
+    _memcpy<64, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcpy_256)
+{
+    _memcpy<256, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcpy_1k)
+{
+    _memcpy<1024, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcpy_4k)
+{
+    _memcpy<4096, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcpy_1k_half_aligned)
+{
+    _memcpy<1024, 2, 2>(state);
+}
+
+BN_BENCHMARK(memcpy_1k_byte_aligned)
+{
+    _memcpy<1024, 1, 1>(state);
+}
+
+BN_BENCHMARK(memcpy_1k_misaligned)
+{
+    _memcpy<1024, 1, 0>(state);
+}
+
+BN_BENCHMARK(copy_half_words_64)
+{
+    _copy_half_words<64>(state);
+}
+
+BN_BENCHMARK(copy_half_words_1k)
+{
+    _copy_half_words<1024>(state);
+}
+
+BN_BENCHMARK(copy_half_words_4k)
+{
+    _copy_half_words<4096>(state);
+}
+
+BN_BENCHMARK(copy_words_64)
+{
+    _copy_words<64>(state);
+}
+
+BN_BENCHMARK(copy_words_256)
+{
+    _copy_words<256>(state);
+}
+
+BN_BENCHMARK(copy_words_1k)
+{
+    _copy_words<1024>(state);
+}
+
+BN_BENCHMARK(copy_words_4k)
+{
+    _copy_words<4096>(state);
+}
+
+BN_BENCHMARK(dma_copy_words_64)
+{
+    _dma_copy_words<64>(state);
+}
+
+BN_BENCHMARK(dma_copy_words_256)
+{
+    _dma_copy_words<256>(state);
+}
+
+BN_BENCHMARK(dma_copy_words_1k)
+{
+    _dma_copy_words<1024>(state);
+}
+
+BN_BENCHMARK(dma_copy_words_4k)
+{
+    _dma_copy_words<4096>(state);
+}
+
+BN_BENCHMARK(copy_words_fiq_1k)
+{
+    bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+    uint8_t* destination = buffers->destination.data();
+
+    while(state.keep_running())
+    {
+        bn::hw::memory::copy_words_fiq(buffers->source.data(), 1024 / 4, destination);
+        benchmark_state::do_not_optimize(destination);
+    }
+}
+
+BN_BENCHMARK(memory_copy_1k)
+{
+    bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+    uint8_t* destination = buffers->destination.data();
+
+    while(state.keep_running())
+    {
+        bn::memory::copy(buffers->source[0], 1024, *destination);
+        benchmark_state::do_not_optimize(destination);
+    }
+}
+
+BN_BENCHMARK(memset_1k)
+{
+    bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+    uint8_t* destination = buffers->destination.data();
+
+    while(state.keep_running())
+    {
+        bn::memset(destination, 0x12, 1024);
+        benchmark_state::do_not_optimize(destination);
+    }
+}
+
+BN_BENCHMARK(set_words_1k)
+{
+    bn::unique_ptr<memory_buffers> buffers = _create_buffers();
+    uint8_t* destination = buffers->destination.data();
+
+    while(state.keep_running())
+    {
+        bn::hw::memory::set_words(0x12121212, 1024 / 4, destination);
+        benchmark_state::do_not_optimize(destination);
+    }
+}
+
+BN_BENCHMARK(memcmp_16)
+{
+    _memcmp<16, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcmp_256)
+{
+    _memcmp<256, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcmp_1k)
+{
+    _memcmp<1024, 0, 0>(state);
+}
+
+BN_BENCHMARK(memcmp_1k_byte_aligned)
+{
+    _memcmp<1024, 1, 1>(state);
+}
+
+BN_BENCHMARK(memcmp_1k_misaligned)
+{
+    _memcmp<1024, 1, 0>(state);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_vector.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_text_generator.h"
+
+#include "../../butano/src/bn_sprites_manager.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int sorted_sprites = 64;
+}
+
+// Each z order change moves the sprite to another layer of the sprites sorter,
+// and then the sorted hardware handles are rebuilt as in bn::core::update:
+BN_BENCHMARK(sprite_sort_z_order)
+{
+    const bn::sprite_item& sprite_item = common::variable_8x16_sprite_font.item();
+    bn::vector<bn::sprite_ptr, sorted_sprites> sprites;
+
+    for(int index = 0; index < sorted_sprites; ++index)
+    {
+        sprites.push_back(sprite_item.create_sprite(0, 0));
+        sprites.back().set_z_order(index % 8);
+    }
+
+    int index = 0;
+
+    while(state.keep_running())
+    {
+        bn::sprite_ptr& sprite = sprites[index];
+        sprite.set_z_order((sprite.z_order() + 1) % 8);
+        bn::sprites_manager::update();
+        index = (index + 1) % sorted_sprites;
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(text_generator_16_chars, 100)
+{
+    bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+    bn::vector<bn::sprite_ptr, 8> sprites;
+
+    while(state.keep_running())
+    {
+        sprites.clear();
+        text_generator.generate(0, 0, "Score: 123456789", sprites);
+    }
+}
+
+BN_BENCHMARK_ITERATIONS(text_generator_16_chars_per_char, 100)
+{
+    bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+    text_generator.set_one_sprite_per_character(true);
+
+    bn::vector<bn::sprite_ptr, 16> sprites;
+
+    while(state.keep_running())
+    {
+        sprites.clear();
+        text_generator.generate(0, 0, "Score: 123456789", sprites);
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BG_MAP_DOUBLE_BUFFERS_TESTS_H
+#define BG_MAP_DOUBLE_BUFFERS_TESTS_H
+
+#include "bn_core.h"
+#include "bn_size.h"
+#include "bn_color.h"
+#include "bn_affine_bg_ptr.h"
+#include "bn_regular_bg_ptr.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_bg_palette_item.h"
+#include "bn_affine_bg_tiles_ptr.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "bn_affine_bg_map_double_buffer.h"
+#include "bn_regular_bg_map_double_buffer.h"
+#include "tests.h"
+
+class bg_map_double_buffers_tests : public tests
+{
+
+public:
+    bg_map_double_buffers_tests() :
+        tests("bg_map_double_buffers")
+    {
+        static constexpr bn::color colors[16] = {};
+
+        {
+            bn::bg_palette_ptr palette = bn::bg_palette_ptr::create(bn::bg_palette_item(colors, bn::bpp_mode::BPP_4));
+            bn::regular_bg_tiles_ptr tiles = bn::regular_bg_tiles_ptr::allocate(2, bn::bpp_mode::BPP_4);
+            bn::regular_bg_map_double_buffer double_buffer = bn::regular_bg_map_double_buffer::allocate(
+                        bn::size(32, 32), bn::move(tiles), bn::move(palette));
+            BN_ASSERT(double_buffer.front_map() != double_buffer.back_map());
+
+            bn::regular_bg_map_ptr front_map = double_buffer.front_map();
+            bn::regular_bg_map_ptr back_map = double_buffer.back_map();
+            bn::regular_bg_ptr bg = bn::regular_bg_ptr::create(front_map);
+
+            // The BG displays the back map after a flip, and the maps are exchanged:
+            double_buffer.back_vram()[0] = 1;
+            double_buffer.flip(bg);
+            BN_ASSERT(bg.map() == back_map);
+            BN_ASSERT(double_buffer.front_map() == back_map);
+            BN_ASSERT(double_buffer.back_map() == front_map);
+            BN_ASSERT(double_buffer.front_vram()[0] == 1);
+
+            // The back map can't be written until the next V-Blank:
+            bn::core::update();
+            double_buffer.copy_front_to_back();
+            BN_ASSERT(double_buffer.back_vram()[0] == 1);
+
+            double_buffer.back_vram()[1] = 1;
+            double_buffer.flip(bg);
+            BN_ASSERT(bg.map() == front_map);
+            BN_ASSERT(double_buffer.front_map() == front_map);
+            BN_ASSERT(double_buffer.back_map() == back_map);
+            BN_ASSERT(double_buffer.front_vram()[0] == 1);
+            BN_ASSERT(double_buffer.front_vram()[1] == 1);
+        }
+
+        {
+            bn::bg_palette_ptr palette = bn::bg_palette_ptr::create(bn::bg_palette_item(colors, bn::bpp_mode::BPP_8));
+            bn::affine_bg_tiles_ptr tiles = bn::affine_bg_tiles_ptr::allocate(2);
+            bn::affine_bg_map_double_buffer double_buffer = bn::affine_bg_map_double_buffer::allocate(
+                        bn::size(16, 16), bn::move(tiles), bn::move(palette));
+            BN_ASSERT(double_buffer.front_map() != double_buffer.back_map());
+
+            bn::affine_bg_map_ptr front_map = double_buffer.front_map();
+            bn::affine_bg_map_ptr back_map = double_buffer.back_map();
+            bn::affine_bg_ptr bg = bn::affine_bg_ptr::create(front_map);
+
+            // Affine map cells are bytes and VRAM doesn't support byte writes, so cells are not modified here:
+            const bn::affine_bg_map_cell* back_cells = double_buffer.back_vram().data();
+            double_buffer.flip(bg);
+            BN_ASSERT(bg.map() == back_map);
+            BN_ASSERT(double_buffer.front_map() == back_map);
+            BN_ASSERT(double_buffer.back_map() == front_map);
+            BN_ASSERT(double_buffer.front_vram().data() == back_cells);
+
+            double_buffer.flip(bg);
+            BN_ASSERT(bg.map() == front_map);
+            BN_ASSERT(double_buffer.front_map() == front_map);
+            BN_ASSERT(double_buffer.back_map() == back_map);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef CAMERAS_TESTS_H
+#define CAMERAS_TESTS_H
+
+#include "bn_cameras.h"
+#include "bn_optional.h"
+#include "bn_camera_ptr.h"
+#include "tests.h"
+
+class cameras_tests : public tests
+{
+
+public:
+    cameras_tests() :
+        tests("cameras")
+    {
+        int used_cameras = bn::cameras::used_items_count();
+
+        {
+            bn::camera_ptr camera = bn::camera_ptr::create(16, 32);
+            BN_ASSERT(! camera.parallax());
+            BN_ASSERT(! camera.parent());
+
+            // Parallax cameras follow their parent camera:
+            bn::camera_ptr parallax_camera = bn::camera_ptr::create_parallax(camera, bn::fixed_point(0.5, 2));
+            BN_ASSERT(parallax_camera.parallax());
+            BN_ASSERT(parallax_camera.parent() == camera);
+            BN_ASSERT(parallax_camera.position() == bn::fixed_point(8, 64));
+
+            camera.set_position(-32, 8);
+            BN_ASSERT(parallax_camera.position() == bn::fixed_point(-16, 16));
+
+            parallax_camera.set_parallax_factor(bn::fixed_point(0.25, 0));
+            BN_ASSERT(parallax_camera.position() == bn::fixed_point(-8, 0));
+
+            // Parallax cameras can't be nested, but a camera can have multiple parallax children:
+            bn::camera_ptr other_parallax_camera = bn::camera_ptr::create_parallax(
+                        *parallax_camera.parent(), bn::fixed_point(1, 1));
+            BN_ASSERT(other_parallax_camera.parent() == camera);
+            BN_ASSERT(other_parallax_camera.position() == camera.position());
+
+            camera.set_x(64);
+            BN_ASSERT(parallax_camera.position() == bn::fixed_point(16, 0));
+            BN_ASSERT(other_parallax_camera.position() == bn::fixed_point(64, 8));
+
+            // Parallax cameras keep their parent camera alive:
+            bn::optional<bn::camera_ptr> optional_camera = bn::camera_ptr::create_optional(0, 0);
+            BN_ASSERT(optional_camera);
+
+            bn::optional<bn::camera_ptr> optional_parallax_camera =
+                    bn::camera_ptr::create_parallax_optional(*optional_camera, bn::fixed_point(2, 2));
+            BN_ASSERT(optional_parallax_camera);
+            BN_ASSERT(optional_parallax_camera->position() == bn::fixed_point(0, 0));
+
+            int released_camera_id = optional_camera->id();
+            optional_camera.reset();
+            BN_ASSERT(bn::cameras::used_items_count() == used_cameras + 5);
+
+            optional_parallax_camera->parent()->set_position(4, 8);
+            BN_ASSERT(optional_parallax_camera->position() == bn::fixed_point(8, 16));
+
+            // Released IDs are reused by new cameras, which don't follow the old parent camera:
+            int released_parallax_camera_id = optional_parallax_camera->id();
+            optional_parallax_camera.reset();
+            BN_ASSERT(bn::cameras::used_items_count() == used_cameras + 3);
+
+            bn::camera_ptr reused_camera = bn::camera_ptr::create(100, 100);
+            bn::camera_ptr other_reused_camera = bn::camera_ptr::create(200, 200);
+            BN_ASSERT(reused_camera.id() == released_camera_id || reused_camera.id() == released_parallax_camera_id);
+            BN_ASSERT(other_reused_camera.id() == released_camera_id ||
+                      other_reused_camera.id() == released_parallax_camera_id);
+            BN_ASSERT(! reused_camera.parallax());
+            BN_ASSERT(! other_reused_camera.parallax());
+
+            reused_camera.set_position(0, 0);
+            BN_ASSERT(other_reused_camera.position() == bn::fixed_point(200, 200));
+
+            // Parallax cameras created with a reused ID follow their new parent camera only:
+            bn::camera_ptr reused_parallax_camera = bn::camera_ptr::create_parallax(
+                        reused_camera, bn::fixed_point(1, 1));
+            other_reused_camera.set_position(300, 300);
+            BN_ASSERT(reused_parallax_camera.position() == bn::fixed_point(0, 0));
+
+            reused_camera.set_position(10, 20);
+            BN_ASSERT(reused_parallax_camera.position() == bn::fixed_point(10, 20));
+        }
+
+        BN_ASSERT(bn::cameras::used_items_count() == used_cameras);
+    }
+};
+
+#endif
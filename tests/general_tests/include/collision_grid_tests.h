@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef COLLISION_GRID_TESTS_H
+#define COLLISION_GRID_TESTS_H
+
+#include "bn_random.h"
+#include "bn_collision_grid.h"
+#include "tests.h"
+
+class collision_grid_tests : public tests
+{
+
+public:
+    collision_grid_tests() :
+        tests("collision_grid")
+    {
+        bn::collision_grid<32, 16> grid;
+        BN_ASSERT(grid.empty());
+        BN_ASSERT(grid.cell_size() == 16);
+
+        int a = grid.insert(bn::fixed_rect(0, 0, 16, 16));
+        int b = grid.insert(bn::top_left_fixed_rect(4, 4, 8, 8));
+        int c = grid.insert(bn::fixed_rect(100, 100, 8, 8));
+        BN_ASSERT(grid.size() == 3);
+        BN_ASSERT(grid.rect(b) == bn::top_left_fixed_rect(4, 4, 8, 8));
+
+        int pairs = 0;
+        grid.for_each_pair([&](int first_id, int second_id)
+        {
+            BN_ASSERT(first_id == a && second_id == b);
+            ++pairs;
+        });
+        BN_ASSERT(pairs == 1);
+
+        grid.update(c, bn::fixed_rect(8, 8, 8, 8));
+        pairs = 0;
+        grid.for_each_pair([&](int, int)
+        {
+            ++pairs;
+        });
+        BN_ASSERT(pairs == 3);
+
+        grid.erase(a);
+        BN_ASSERT(! grid.contains(a));
+
+        int hits = 0;
+        grid.for_each_intersection(bn::fixed_rect(0, 0, 2, 2), [&](int)
+        {
+            ++hits;
+        });
+        BN_ASSERT(hits == 0);
+
+        _random_test(grid);
+    }
+
+private:
+    static void _random_test(bn::icollision_grid& grid)
+    {
+        bn::fixed_rect rects[32];
+        bn::random random;
+        grid.clear();
+
+        for(int index = 0; index < 32; ++index)
+        {
+            rects[index] = bn::fixed_rect(bn::fixed(random.get_int(-128, 128)), bn::fixed(random.get_int(-128, 128)),
+                                          random.get_fixed(1, 48), random.get_fixed(1, 48));
+            BN_ASSERT(grid.insert(rects[index]) == index);
+        }
+
+        int brute_force_pairs = 0;
+
+        for(int index = 0; index < 32; ++index)
+        {
+            for(int other_index = index + 1; other_index < 32; ++other_index)
+            {
+                if(rects[index].intersects(rects[other_index]))
+                {
+                    ++brute_force_pairs;
+                }
+            }
+        }
+
+        int grid_pairs = 0;
+        grid.for_each_pair([&](int first_id, int second_id)
+        {
+            BN_ASSERT(first_id < second_id);
+            ++grid_pairs;
+        });
+        BN_ASSERT(grid_pairs == brute_force_pairs, grid_pairs, " - ", brute_force_pairs);
+
+        bn::fixed_rect query(0, 0, 64, 64);
+        int brute_force_hits = 0;
+
+        for(const bn::fixed_rect& rect : rects)
+        {
+            if(rect.intersects(query))
+            {
+                ++brute_force_hits;
+            }
+        }
+
+        int grid_hits = 0;
+        grid.for_each_intersection(query, [&](int id)
+        {
+            BN_ASSERT(rects[id].intersects(query));
+            ++grid_hits;
+        });
+        BN_ASSERT(grid_hits == brute_force_hits, grid_hits, " - ", brute_force_hits);
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef COMMIT_BUDGET_TESTS_H
+#define COMMIT_BUDGET_TESTS_H
+
+#include "bn_core.h"
+#include "bn_timers.h"
+#include "bn_commit_phase.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_tiles_item.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "bn_regular_bg_tiles_item.h"
+#include "tests.h"
+
+class commit_budget_tests : public tests
+{
+
+public:
+    commit_budget_tests() :
+        tests("commit_budget")
+    {
+        // Different tiles are used each time, so they are not reused before being removed:
+        static constexpr bn::tile tiles[128] = {};
+        constexpr bn::span<const bn::tile> first_tiles(tiles, 64);
+        constexpr bn::span<const bn::tile> second_tiles(tiles + 64, 64);
+        constexpr int tiles_bytes = 64 * int(sizeof(bn::tile));
+
+        BN_ASSERT(! bn::core::commit_budget_enabled());
+        BN_ASSERT(bn::core::commit_budget_ticks() == bn::timers::ticks_per_vblank());
+
+        bn::core::set_commit_budget_ticks(1);
+        BN_ASSERT(bn::core::commit_budget_ticks() == 1);
+
+        // Nothing is deferred if the commit budget is disabled:
+        {
+            bn::sprite_tiles_ptr sprite_tiles = bn::sprite_tiles_ptr::create(
+                        bn::sprite_tiles_item(first_tiles, bn::bpp_mode::BPP_4));
+            bn::core::update();
+            BN_ASSERT(! bn::core::last_commit_deferred());
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == tiles_bytes);
+        }
+
+        bn::core::set_commit_budget_enabled(true);
+        BN_ASSERT(bn::core::commit_budget_enabled());
+
+        // Sprite uploads are deferred with OAM, but background ones are not:
+        {
+            bn::sprite_tiles_ptr sprite_tiles = bn::sprite_tiles_ptr::create(
+                        bn::sprite_tiles_item(second_tiles, bn::bpp_mode::BPP_4));
+            bn::core::update();
+            BN_ASSERT(bn::core::last_commit_deferred());
+            BN_ASSERT(bn::core::last_commit_deferred(bn::commit_phase::SPRITES));
+            BN_ASSERT(bn::core::last_commit_deferred(bn::commit_phase::SPRITE_TILES));
+            BN_ASSERT(! bn::core::last_commit_deferred(bn::commit_phase::BG_BLOCKS));
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 0);
+            BN_ASSERT(bn::core::last_commit_estimated_ticks(bn::commit_phase::SPRITE_TILES) > 0);
+
+            // Nothing is deferred if something was deferred in the last V-Blank:
+            bn::regular_bg_tiles_ptr bg_tiles = bn::regular_bg_tiles_ptr::create(
+                        bn::regular_bg_tiles_item(first_tiles, bn::bpp_mode::BPP_4));
+            bn::core::update();
+            BN_ASSERT(! bn::core::last_commit_deferred());
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == tiles_bytes);
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::BG_BLOCKS) > 0);
+        }
+
+        // Background uploads are deferred with the backgrounds registers, but sprite ones are not:
+        {
+            bn::regular_bg_tiles_ptr bg_tiles = bn::regular_bg_tiles_ptr::create(
+                        bn::regular_bg_tiles_item(second_tiles, bn::bpp_mode::BPP_4));
+            bn::core::update();
+            BN_ASSERT(bn::core::last_commit_deferred());
+            BN_ASSERT(bn::core::last_commit_deferred(bn::commit_phase::BG_BLOCKS));
+            BN_ASSERT(! bn::core::last_commit_deferred(bn::commit_phase::SPRITES));
+            BN_ASSERT(! bn::core::last_commit_deferred(bn::commit_phase::SPRITE_TILES));
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::BG_BLOCKS) == 0);
+
+            bn::core::update();
+            BN_ASSERT(! bn::core::last_commit_deferred());
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::BG_BLOCKS) > 0);
+        }
+
+        bn::core::set_commit_budget_enabled(false);
+        bn::core::set_commit_budget_ticks(bn::timers::ticks_per_vblank());
+        bn::core::update();
+    }
+};
+
+#endif
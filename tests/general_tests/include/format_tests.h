@@ -7,6 +7,7 @@
 #define FORMAT_TESTS_H
 
 #include "bn_format.h"
+#include "bn_format_to.h"
 #include "tests.h"
 
 class format_tests : public tests
@@ -22,6 +23,38 @@ public:
         BN_ASSERT(bn::format<32>("Hello {{!", "world") == bn::string<32>("Hello {!"));
         BN_ASSERT(bn::format<32>("Hello }}!", "world") == bn::string<32>("Hello }!"));
         BN_ASSERT(bn::format<32>("We have {} {}", 4, "apples") == bn::string<32>("We have 4 apples"));
+
+        BN_ASSERT(_format_to(0) == "0");
+        BN_ASSERT(_format_to(12345) == "12345");
+        BN_ASSERT(_format_to(-2147483647 - 1) == "-2147483648");
+        BN_ASSERT(_format_to(4294967295U) == "4294967295");
+        BN_ASSERT(_format_to(int64_t(-9223372036854775807LL - 1)) == "-9223372036854775808");
+        BN_ASSERT(_format_to(uint64_t(18446744073709551615ULL)) == "18446744073709551615");
+        BN_ASSERT(_format_to(42, 6) == "    42");
+        BN_ASSERT(_format_to(42, 6, '0') == "000042");
+        BN_ASSERT(_format_to(-42, 6) == "   -42");
+        BN_ASSERT(_format_to(-42, 6, '0') == "-00042");
+        BN_ASSERT(_format_to(123456, 3) == "123456");
+
+        BN_ASSERT(_format_to(bn::fixed(1.5), 2) == "1.50");
+        BN_ASSERT(_format_to(bn::fixed(-1.25), 3, 8, '0') == "-001.250");
+        BN_ASSERT(_format_to(bn::fixed(-1.5), 0) == "-1");
+        BN_ASSERT(_format_to(bn::fixed(-0.5), 0) == "0");
+        BN_ASSERT(_format_to(bn::fixed(2), 1, 5) == "  2.0");
+
+        for(int value = -1000; value <= 1000; value += 7)
+        {
+            BN_ASSERT(_format_to(value) == bn::to_string<16>(value));
+        }
+    }
+
+private:
+    template<typename Type, typename... Args>
+    [[nodiscard]] static bn::string<32> _format_to(Type value, Args... args)
+    {
+        bn::array<char, 32> buffer;
+        int size = bn::format_to(buffer, value, args...);
+        return bn::string<32>(buffer.data(), size);
     }
 };
 
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef FRAME_ARENA_TESTS_H
+#define FRAME_ARENA_TESTS_H
+
+#include "bn_core.h"
+#include "bn_memory.h"
+#include "bn_frame_arena.h"
+#include "bn_scoped_scratch.h"
+#include "tests.h"
+
+class frame_arena_tests : public tests
+{
+
+public:
+    frame_arena_tests() :
+        tests("frame_arena")
+    {
+        BN_ASSERT(bn::frame_arena::used_ewram() == 0);
+        BN_ASSERT(bn::frame_arena::used_iwram() == 0);
+
+        int available_ewram = bn::frame_arena::available_ewram();
+        void* ptr = bn::frame_arena::ewram_alloc(5);
+        BN_ASSERT(ptr);
+        BN_ASSERT(bn::aligned<4>(ptr));
+        BN_ASSERT(bn::frame_arena::used_ewram() == 8);
+        BN_ASSERT(bn::frame_arena::available_ewram() == available_ewram - 8);
+
+        {
+            bn::scoped_scratch scratch;
+
+            bn::span<uint16_t> values = bn::frame_arena::ewram_alloc_array<uint16_t>(3);
+            BN_ASSERT(values.size() == 3);
+            BN_ASSERT(bn::aligned<4>(values.data()));
+            BN_ASSERT(bn::frame_arena::used_ewram() == 16);
+            BN_ASSERT(scratch.used_ewram() == 8);
+
+            {
+                bn::scoped_scratch nested_scratch;
+
+                void* iwram_ptr = bn::frame_arena::iwram_alloc(4);
+                BN_ASSERT(iwram_ptr);
+                BN_ASSERT(bn::frame_arena::used_iwram() == 4);
+                BN_ASSERT(nested_scratch.used_iwram() == 4);
+                BN_ASSERT(scratch.used_iwram() == 4);
+            }
+
+            BN_ASSERT(bn::frame_arena::used_iwram() == 0);
+            BN_ASSERT(bn::frame_arena::frame_peak_iwram() == 4);
+        }
+
+        BN_ASSERT(bn::frame_arena::used_ewram() == 8);
+        BN_ASSERT(bn::frame_arena::frame_peak_ewram() == 16);
+
+        bn::core::update();
+        BN_ASSERT(bn::frame_arena::used_ewram() == 0);
+        BN_ASSERT(bn::frame_arena::frame_peak_ewram() == 0);
+        BN_ASSERT(bn::frame_arena::last_frame_peak_ewram() == 16);
+        BN_ASSERT(bn::frame_arena::last_frame_peak_iwram() == 4);
+        BN_ASSERT(bn::frame_arena::peak_ewram() >= 16);
+
+        bn::frame_arena::reset_peaks();
+        BN_ASSERT(bn::frame_arena::peak_ewram() == 0);
+        BN_ASSERT(bn::frame_arena::peak_iwram() == 0);
+    }
+};
+
+#endif
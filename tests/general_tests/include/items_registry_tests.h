@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef ITEMS_REGISTRY_TESTS_H
+#define ITEMS_REGISTRY_TESTS_H
+
+#include "bn_items_registry.h"
+#include "tests.h"
+
+class items_registry_tests : public tests
+{
+
+public:
+    items_registry_tests() :
+        tests("items_registry")
+    {
+        // Name hashes calculated by the graphics tool:
+        BN_ASSERT(bn::hash<bn::string_view>()("hero") == 0x6a7e3877);
+        BN_ASSERT(bn::hash<bn::string_view>()("enemy_a") == 0xd7e5566f);
+        BN_ASSERT(bn::hash<bn::string_view>()("x") == 0x050c5d67);
+
+        constexpr bn::items_registry_entry entries[] = {
+            bn::items_registry_entry(0x050c5d67, "x", 2),
+            bn::items_registry_entry(0x5f5fd9b3, "bullet", 0),
+            bn::items_registry_entry(0x6a7e3877, "hero", 3),
+            bn::items_registry_entry(0x6a7e3877, "hero_collision", 4),
+            bn::items_registry_entry(0xd7e5566f, "enemy_a", 1),
+        };
+
+        BN_ASSERT(bn::items_registry_find(entries, "x") == 2);
+        BN_ASSERT(bn::items_registry_find(entries, "bullet") == 0);
+        BN_ASSERT(bn::items_registry_find(entries, "hero") == 3);
+        BN_ASSERT(bn::items_registry_find(entries, "enemy_a") == 1);
+        BN_ASSERT(bn::items_registry_find(entries, "enemy_b") == -1);
+        BN_ASSERT(bn::items_registry_find(entries, "") == -1);
+        BN_ASSERT(bn::items_registry_find(bn::span<const bn::items_registry_entry>(), "hero") == -1);
+    }
+};
+
+#endif
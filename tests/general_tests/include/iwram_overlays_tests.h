@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef IWRAM_OVERLAYS_TESTS_H
+#define IWRAM_OVERLAYS_TESTS_H
+
+#include "bn_iwram_overlays.h"
+#include "tests.h"
+
+BN_CODE_IWRAM_OVERLAY(0) int iwram_overlay_0_function(int a, int b);
+
+BN_CODE_IWRAM_OVERLAY(1) int iwram_overlay_1_function(int a, int b);
+
+class iwram_overlays_tests : public tests
+{
+
+public:
+    iwram_overlays_tests() :
+        tests("iwram_overlays")
+    {
+        if constexpr(bn::iwram_overlays::supported())
+        {
+            BN_ASSERT(bn::iwram_overlays::size(0) > 0);
+            BN_ASSERT(bn::iwram_overlays::size(1) > 0);
+            BN_ASSERT(bn::iwram_overlays::size(0) <= bn::iwram_overlays::region_size());
+            BN_ASSERT(bn::iwram_overlays::size(1) <= bn::iwram_overlays::region_size());
+        }
+
+        BN_ASSERT(! bn::iwram_overlays::loaded());
+
+        bn::iwram_overlays::load(0);
+        BN_ASSERT(bn::iwram_overlays::loaded() == 0);
+        BN_ASSERT(iwram_overlay_0_function(6, 7) == 43);
+
+        bn::iwram_overlays::load(1);
+        BN_ASSERT(bn::iwram_overlays::loaded() == 1);
+        BN_ASSERT(iwram_overlay_1_function(6, 7) == -1);
+
+        // Overlay 0 code has been overwritten, so it must be copied again:
+        bn::iwram_overlays::load(0);
+        BN_ASSERT(bn::iwram_overlays::loaded() == 0);
+        BN_ASSERT(iwram_overlay_0_function(3, 5) == 16);
+
+        bn::iwram_overlays::unload();
+        BN_ASSERT(! bn::iwram_overlays::loaded());
+    }
+};
+
+#endif
@@ -8,6 +8,7 @@
 
 #include "bn_memory.h"
 #include "bn_cstdlib.h"
+#include "bn_cstring.h"
 #include "tests.h"
 
 class memory_tests : public tests
@@ -52,6 +53,21 @@ public:
         bn::free(ptr);
         BN_ASSERT(bn::memory::used_alloc_ewram() == 0);
 
+        BN_ASSERT(bn::memory::used_alloc_iwram() == 0);
+        ptr = bn::memory::iwram_alloc(4);
+
+        if(ptr)
+        {
+            BN_ASSERT(bn::memory::used_alloc_iwram() > 0);
+
+            bn::memory::iwram_free(ptr);
+            BN_ASSERT(bn::memory::used_alloc_iwram() == 0);
+        }
+        else
+        {
+            BN_ASSERT(bn::memory::available_alloc_iwram() == 0);
+        }
+
         uint32_t u32_array[3];
         BN_ASSERT(bn::aligned<4>(u32_array));
         BN_ASSERT(bn::aligned<4>(static_cast<const void*>(u32_array)));
@@ -67,6 +83,27 @@ public:
         BN_ASSERT(! bn::aligned<4>(static_cast<const void*>(u16_array + 1)));
         BN_ASSERT(bn::aligned<4>(u16_array + 2));
         BN_ASSERT(bn::aligned<4>(static_cast<const void*>(u16_array + 2)));
+
+        alignas(4) uint8_t lhs_bytes[32];
+        alignas(4) uint8_t rhs_bytes[32];
+
+        for(int index = 0; index < 32; ++index)
+        {
+            lhs_bytes[index] = uint8_t(index);
+            rhs_bytes[index] = uint8_t(index);
+        }
+
+        BN_ASSERT(bn::memcmp(lhs_bytes, rhs_bytes, 32) == 0);
+        BN_ASSERT(bn::memcmp(lhs_bytes + 1, rhs_bytes + 1, 31) == 0);
+        BN_ASSERT(bn::memcmp(lhs_bytes + 1, rhs_bytes + 2, 16) < 0);
+        BN_ASSERT(bn::memcmp(lhs_bytes + 2, rhs_bytes + 1, 16) > 0);
+
+        lhs_bytes[8] = 1;
+        rhs_bytes[9] = 255;
+        BN_ASSERT(bn::memcmp(lhs_bytes, rhs_bytes, 32) < 0);
+        BN_ASSERT(bn::memcmp(rhs_bytes, lhs_bytes, 32) > 0);
+        BN_ASSERT(bn::memcmp(lhs_bytes + 3, rhs_bytes + 3, 29) < 0);
+        BN_ASSERT(bn::memcmp(lhs_bytes, rhs_bytes, 8) == 0);
     }
 };
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef PALETTE_GROUP_TESTS_H
+#define PALETTE_GROUP_TESTS_H
+
+#include "bn_sprite_items_palette_group_first.h"
+#include "bn_sprite_items_palette_group_third.h"
+#include "bn_sprite_items_palette_group_second.h"
+#include "bn_sprite_items_palette_group_fourth.h"
+#include "bn_sprite_palette_items_palette_group_packed.h"
+#include "tests.h"
+
+class palette_group_tests : public tests
+{
+
+public:
+    palette_group_tests() :
+        tests("palette_group")
+    {
+        constexpr bn::color transparent(31, 0, 31);
+        constexpr bn::color red(31, 0, 0);
+        constexpr bn::color green(0, 31, 0);
+        constexpr bn::color blue(0, 0, 31);
+        constexpr bn::color yellow(31, 31, 0);
+
+        // Original palettes of each sprite:
+        const bn::color first_colors[] = { transparent, red, green, blue };
+        const bn::color second_colors[] = { transparent, blue, green, red };
+        const bn::color fourth_colors[] = { transparent, yellow, red };
+        bn::color third_colors[15] = { transparent, blue };
+
+        for(int index = 2; index < 15; ++index)
+        {
+            third_colors[index] = bn::color(index * 2, 31 - (index * 2), 16);
+        }
+
+        // The second sprite colors are a subset of the first sprite ones, and the fourth sprite colors
+        // fit with them in the same palette. The third sprite colors only share blue with them,
+        // but they don't fit in the same palette:
+        const bn::sprite_palette_item& third_palette_item = bn::sprite_palette_items::palette_group_packed_0;
+        const bn::sprite_palette_item& shared_palette_item = bn::sprite_palette_items::palette_group_packed_1;
+        BN_ASSERT(bn::sprite_items::palette_group_first.palette_item() == shared_palette_item);
+        BN_ASSERT(bn::sprite_items::palette_group_second.palette_item() == shared_palette_item);
+        BN_ASSERT(bn::sprite_items::palette_group_third.palette_item() == third_palette_item);
+        BN_ASSERT(bn::sprite_items::palette_group_fourth.palette_item() == shared_palette_item);
+        BN_ASSERT(third_palette_item != shared_palette_item);
+
+        // Only used colors are packed, after the transparent one:
+        BN_ASSERT(shared_palette_item.colors_ref().size() == 16);
+        BN_ASSERT(shared_palette_item.colors_ref()[0] == transparent);
+        BN_ASSERT(shared_palette_item.colors_ref()[5] == bn::color());
+        BN_ASSERT(third_palette_item.colors_ref()[0] == transparent);
+        BN_ASSERT(third_palette_item.colors_ref()[14] != bn::color());
+
+        // Remapped tiles reference the original colors in the packed palettes:
+        _check_colors(bn::sprite_items::palette_group_first, first_colors,
+                      [](int, int y) { return y % 4; });
+        _check_colors(bn::sprite_items::palette_group_second, second_colors,
+                      [](int x, int y) { return x == 0 && y == 0 ? 0 : ((x + y) % 2) + 1; });
+        _check_colors(bn::sprite_items::palette_group_third, third_colors,
+                      [](int x, int y) { return (x + (y * 8)) % 15; });
+        _check_colors(bn::sprite_items::palette_group_fourth, fourth_colors,
+                      [](int x, int) { return x < 4 ? 1 : 2; });
+    }
+
+private:
+    static void _check_colors(const bn::sprite_item& sprite_item, const bn::color* original_colors,
+                              int (*original_color_index)(int x, int y))
+    {
+        const bn::tile& tile = sprite_item.tiles_item().tiles_ref()[0];
+        bn::span<const bn::color> colors = sprite_item.palette_item().colors_ref();
+
+        for(int y = 0; y < 8; ++y)
+        {
+            for(int x = 0; x < 8; ++x)
+            {
+                int color_index = int((tile.data[y] >> (x * 4)) & 0xF);
+
+                if(int original_index = original_color_index(x, y))
+                {
+                    BN_ASSERT(color_index && colors[color_index] == original_colors[original_index],
+                              x, " - ", y, " - ", color_index);
+                }
+                else
+                {
+                    BN_ASSERT(! color_index, x, " - ", y, " - ", color_index);
+                }
+            }
+        }
+    }
+};
+
+#endif
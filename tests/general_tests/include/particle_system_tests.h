@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef PARTICLE_SYSTEM_TESTS_H
+#define PARTICLE_SYSTEM_TESTS_H
+
+#include "bn_core.h"
+#include "bn_color.h"
+#include "bn_sprites.h"
+#include "bn_particle_system.h"
+#include "bn_sprite_palette_item.h"
+#include "tests.h"
+
+class particle_system_tests : public tests
+{
+
+public:
+    particle_system_tests() :
+        tests("particle_system")
+    {
+        static constexpr bn::color colors[16] = {};
+
+        // Size of a hardware sprite handle in OAM:
+        constexpr int handle_bytes = 8;
+
+        bn::sprites::set_reserved_handles_count(4);
+        bn::core::update();
+
+        {
+            bn::particle_system<4> particles(
+                        bn::sprite_shape_size(bn::sprite_shape::SQUARE, bn::sprite_size::SMALL),
+                        bn::sprite_tiles_ptr::allocate(1, bn::bpp_mode::BPP_4),
+                        bn::sprite_palette_ptr::create(bn::sprite_palette_item(colors, bn::bpp_mode::BPP_4)), 0);
+            BN_ASSERT(particles.empty());
+            BN_ASSERT(particles.max_size() == 4);
+            BN_ASSERT(particles.available() == 4);
+            BN_ASSERT(particles.first_handle_index() == 0);
+
+            // Particles without frames are not emitted:
+            BN_ASSERT(! particles.emit(bn::fixed_point(), bn::fixed_point(), 0));
+            BN_ASSERT(particles.empty());
+
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(1, 0), 1));
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(0, 1), 2));
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(), 3));
+            BN_ASSERT(particles.emit(bn::fixed_point(1000, 1000), bn::fixed_point(), 3));
+            BN_ASSERT(particles.full());
+            BN_ASSERT(particles.available() == 0);
+
+            // Particles are not emitted if there's no more capacity:
+            BN_ASSERT(! particles.emit(bn::fixed_point(), bn::fixed_point(), 1));
+            BN_ASSERT(particles.size() == 4);
+
+            // Particles expire after the given number of updates, and only the ones on screen are written:
+            particles.update();
+            BN_ASSERT(particles.size() == 3);
+
+            bn::core::update();
+            BN_ASSERT(bn::sprites::committed_bytes() == 2 * handle_bytes);
+
+            // Handles written in the last update are hidden if they are not written again:
+            particles.update();
+            BN_ASSERT(particles.size() == 2);
+
+            bn::core::update();
+            BN_ASSERT(bn::sprites::committed_bytes() == 2 * handle_bytes);
+
+            particles.update();
+            BN_ASSERT(particles.empty());
+
+            bn::core::update();
+            BN_ASSERT(bn::sprites::committed_bytes() == handle_bytes);
+
+            particles.update();
+            bn::core::update();
+            BN_ASSERT(bn::sprites::committed_bytes() == 0);
+
+            // Hidden particles are not written:
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(), 10));
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(), 10));
+            particles.set_visible(false);
+            particles.update();
+            BN_ASSERT(particles.size() == 2);
+
+            bn::core::update();
+            BN_ASSERT(bn::sprites::committed_bytes() == 0);
+
+            particles.set_visible(true);
+            particles.update();
+            bn::core::update();
+            BN_ASSERT(bn::sprites::committed_bytes() == 2 * handle_bytes);
+
+            // Clear removes all particles:
+            particles.clear();
+            BN_ASSERT(particles.empty());
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(), 10));
+            BN_ASSERT(particles.emit(bn::fixed_point(), bn::fixed_point(), 10));
+            particles.update();
+            bn::core::update();
+        }
+
+        // Written handles are hidden when the particle system is destroyed:
+        bn::core::update();
+        BN_ASSERT(bn::sprites::committed_bytes() == 2 * handle_bytes);
+
+        bn::core::update();
+        BN_ASSERT(bn::sprites::committed_bytes() == 0);
+
+        bn::sprites::set_reserved_handles_count(0);
+        bn::core::update();
+    }
+};
+
+#endif
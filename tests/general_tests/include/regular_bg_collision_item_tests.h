@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef REGULAR_BG_COLLISION_ITEM_TESTS_H
+#define REGULAR_BG_COLLISION_ITEM_TESTS_H
+
+#include "bn_regular_bg_collision_item.h"
+#include "tests.h"
+
+class regular_bg_collision_item_tests : public tests
+{
+
+public:
+    regular_bg_collision_item_tests() :
+        tests("regular_bg_collision_item")
+    {
+        using cell_type = bn::regular_bg_collision_cell_type;
+
+        // Two 32x32 maps. In the first one:
+        // * Row 20 is a floor from column 0 to column 15.
+        // * Column 10 is a wall from row 15 to row 19.
+        // * Row 5 is a ceiling from column 20 to column 25.
+        // * Cell (13, 19) is a slope over the floor, and cell (18, 10) is a slope in the air.
+        // The second one is empty.
+        static uint32_t words[2 * 2 * 32] = {};
+
+        for(int x = 0; x <= 15; ++x)
+        {
+            _set_cell(words, x, 20, cell_type::SOLID);
+        }
+
+        for(int y = 15; y <= 19; ++y)
+        {
+            _set_cell(words, 10, y, cell_type::SOLID);
+        }
+
+        for(int x = 20; x <= 25; ++x)
+        {
+            _set_cell(words, x, 5, cell_type::SOLID);
+        }
+
+        _set_cell(words, 13, 19, cell_type::SLOPE_UP);
+        _set_cell(words, 18, 10, cell_type::SLOPE_DOWN);
+
+        bn::regular_bg_collision_item item(words[0], bn::size(32, 32), 2);
+        BN_ASSERT(item.maps_count() == 2);
+        BN_ASSERT(item.words_ptr(1) == words + 64);
+
+        // Cell types:
+        BN_ASSERT(item.cell_type(0, 0) == cell_type::EMPTY);
+        BN_ASSERT(item.cell_type(10, 15) == cell_type::SOLID);
+        BN_ASSERT(item.cell_type(bn::point(15, 20)) == cell_type::SOLID);
+        BN_ASSERT(item.cell_type(13, 19) == cell_type::SLOPE_UP);
+        BN_ASSERT(item.cell_type(18, 10) == cell_type::SLOPE_DOWN);
+        BN_ASSERT(item.cell_type(10, 15, 1) == cell_type::EMPTY);
+
+        // Cells outside the map are solid:
+        BN_ASSERT(item.cell_type(-1, 0) == cell_type::SOLID);
+        BN_ASSERT(item.cell_type(32, 0) == cell_type::SOLID);
+        BN_ASSERT(item.cell_type(0, -1) == cell_type::SOLID);
+        BN_ASSERT(item.cell_type(bn::point(0, 32), 1) == cell_type::SOLID);
+
+        // Misses:
+        _check(item.sweep(bn::top_left_fixed_rect(16, 16, 8, 8), bn::fixed_point(8, 8)),
+               bn::fixed_point(24, 24), false, false, false, false);
+        _check(item.sweep(bn::top_left_fixed_rect(64, 144, 8, 8), bn::fixed_point(7.5, 0)),
+               bn::fixed_point(71.5, 144), false, false, false, false);
+        _check(item.sweep(bn::top_left_fixed_rect(24, 140, 8, 8), bn::fixed_point(0, 12)),
+               bn::fixed_point(24, 152), false, false, false, false);
+
+        // Walls, ceilings and floors:
+        _check(item.sweep(bn::top_left_fixed_rect(64, 144, 8, 8), bn::fixed_point(30, 0)),
+               bn::fixed_point(72, 144), false, true, false, false);
+        _check(item.sweep(bn::top_left_fixed_rect(96, 144, 8, 8), bn::fixed_point(-30, 0)),
+               bn::fixed_point(88, 144), true, false, false, false);
+        _check(item.sweep(bn::top_left_fixed_rect(168, 64, 8, 8), bn::fixed_point(0, -40)),
+               bn::fixed_point(168, 48), false, false, true, false);
+        _check(item.sweep(bn::top_left_fixed_rect(24, 140, 8, 8), bn::fixed_point(0, 40)),
+               bn::fixed_point(24, 152), false, false, false, true);
+        _check(item.sweep(bn::top_left_fixed_rect(64, 130, 8, 8), bn::fixed_point(30, 30)),
+               bn::fixed_point(72, 152), false, true, false, true);
+
+        // Slopes lift rectangles walking over them, but they block the other rows:
+        _check(item.sweep(bn::top_left_fixed_rect(96, 152, 8, 8), bn::fixed_point(4, 0)),
+               bn::fixed_point(100, 148), false, false, false, true);
+        _check(item.sweep(bn::top_left_fixed_rect(128, 80, 8, 16), bn::fixed_point(20, 0)),
+               bn::fixed_point(136, 80), false, true, false, false);
+
+        // Map edges:
+        _check(item.sweep(bn::top_left_fixed_rect(4, 100, 8, 8), bn::fixed_point(-20, 0)),
+               bn::fixed_point(0, 100), true, false, false, false);
+        _check(item.sweep(bn::top_left_fixed_rect(240, 100, 8, 8), bn::fixed_point(20, 0)),
+               bn::fixed_point(248, 100), false, true, false, false);
+        _check(item.sweep(bn::top_left_fixed_rect(8, 4, 8, 8), bn::fixed_point(0, -20)),
+               bn::fixed_point(8, 0), false, false, true, false);
+        _check(item.sweep(bn::top_left_fixed_rect(200, 200, 8, 8), bn::fixed_point(0, 100)),
+               bn::fixed_point(200, 248), false, false, false, true);
+
+        // Other maps:
+        _check(item.sweep(bn::top_left_fixed_rect(64, 144, 8, 8), bn::fixed_point(30, 30), 1),
+               bn::fixed_point(94, 174), false, false, false, false);
+
+        // Batch sweeps give the same results as single ones:
+        bn::top_left_fixed_rect rects[] = {
+            bn::top_left_fixed_rect(16, 16, 8, 8),
+            bn::top_left_fixed_rect(64, 144, 8, 8),
+            bn::top_left_fixed_rect(24, 140, 8, 8),
+            bn::top_left_fixed_rect(200, 200, 8, 8)
+        };
+        bn::fixed_point deltas[] = {
+            bn::fixed_point(8, 8),
+            bn::fixed_point(30, 0),
+            bn::fixed_point(0, 40),
+            bn::fixed_point(0, 100)
+        };
+        bn::regular_bg_collision_result results[4];
+        item.sweep(rects, deltas, results);
+        _check(results[0], bn::fixed_point(24, 24), false, false, false, false);
+        _check(results[1], bn::fixed_point(72, 144), false, true, false, false);
+        _check(results[2], bn::fixed_point(24, 152), false, false, false, true);
+        _check(results[3], bn::fixed_point(200, 248), false, false, false, true);
+
+        item.sweep(rects, deltas, results, 1);
+        _check(results[1], bn::fixed_point(94, 144), false, false, false, false);
+        _check(results[3], bn::fixed_point(200, 248), false, false, false, true);
+    }
+
+private:
+    static void _set_cell(uint32_t* words, int x, int y, bn::regular_bg_collision_cell_type type)
+    {
+        words[(y * 2) + (x / 16)] |= uint32_t(type) << ((x % 16) * 2);
+    }
+
+    static void _check(const bn::regular_bg_collision_result& result, const bn::fixed_point& position,
+                       bool left_hit, bool right_hit, bool top_hit, bool bottom_hit)
+    {
+        BN_ASSERT(result.rect().position() == position, result.rect().x(), " - ", result.rect().y());
+        BN_ASSERT(result.left_hit() == left_hit);
+        BN_ASSERT(result.right_hit() == right_hit);
+        BN_ASSERT(result.top_hit() == top_hit);
+        BN_ASSERT(result.bottom_hit() == bottom_hit);
+    }
+};
+
+#endif
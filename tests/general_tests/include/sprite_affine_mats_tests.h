@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_AFFINE_MATS_TESTS_H
+#define SPRITE_AFFINE_MATS_TESTS_H
+
+#include "bn_vector.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_affine_mats.h"
+#include "bn_sprite_affine_mat_ptr.h"
+#include "bn_sprite_items_common_variable_8x16_font.h"
+#include "tests.h"
+
+class sprite_affine_mats_tests : public tests
+{
+
+public:
+    sprite_affine_mats_tests() :
+        tests("sprite_affine_mats")
+    {
+        bn::sprite_affine_mats::set_auto_share_enabled(true);
+
+        {
+            const bn::sprite_item& sprite_item = bn::sprite_items::common_variable_8x16_font;
+            bn::sprite_ptr first_sprite = sprite_item.create_sprite(0, 0);
+            bn::sprite_ptr second_sprite = sprite_item.create_sprite(0, 0);
+            first_sprite.set_rotation_angle(45);
+            second_sprite.set_rotation_angle(45);
+            BN_ASSERT(first_sprite.affine_mat()->shared());
+            BN_ASSERT(first_sprite.affine_mat() == second_sprite.affine_mat());
+            BN_ASSERT(bn::sprite_affine_mats::used_count() == 1);
+
+            second_sprite.set_rotation_angle(90);
+            BN_ASSERT(first_sprite.affine_mat() != second_sprite.affine_mat());
+            BN_ASSERT(bn::sprite_affine_mats::used_count() == 2);
+
+            // Unique shared affine mats are updated in place, so they can be modified with all of them in use:
+            bn::vector<bn::sprite_ptr, 32> sprites;
+
+            while(bn::sprite_affine_mats::available_count())
+            {
+                bn::sprite_ptr sprite = sprite_item.create_sprite(0, 0);
+                sprite.set_rotation_angle(100 + sprites.size());
+                sprites.push_back(bn::move(sprite));
+            }
+
+            int affine_mat_id = second_sprite.affine_mat()->id();
+            second_sprite.set_rotation_angle(200);
+            BN_ASSERT(second_sprite.affine_mat()->id() == affine_mat_id);
+            BN_ASSERT(second_sprite.rotation_angle() == 200);
+            BN_ASSERT(second_sprite.affine_mat()->shared());
+
+            // And they are replaced with an existing one if it has the same attributes:
+            second_sprite.set_rotation_angle(45);
+            BN_ASSERT(first_sprite.affine_mat() == second_sprite.affine_mat());
+            BN_ASSERT(bn::sprite_affine_mats::available_count() == 1);
+
+            sprites.front().set_rotation_angle(45);
+            BN_ASSERT(first_sprite.affine_mat() == sprites.front().affine_mat());
+            BN_ASSERT(bn::sprite_affine_mats::available_count() == 2);
+        }
+
+        BN_ASSERT(bn::sprite_affine_mats::used_count() == 0);
+        bn::sprite_affine_mats::set_auto_share_enabled(false);
+    }
+};
+
+#endif
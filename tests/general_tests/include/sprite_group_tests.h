@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_GROUP_TESTS_H
+#define SPRITE_GROUP_TESTS_H
+
+#include "bn_core.h"
+#include "bn_color.h"
+#include "bn_sprite_group.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_shape_size.h"
+#include "bn_sprite_palette_ptr.h"
+#include "bn_sprite_palette_item.h"
+#include "tests.h"
+
+class sprite_group_tests : public tests
+{
+
+public:
+    sprite_group_tests() :
+        tests("sprite_group")
+    {
+        static constexpr bn::color colors[16] = {};
+
+        bn::sprite_tiles_ptr tiles = bn::sprite_tiles_ptr::allocate(4, bn::bpp_mode::BPP_4);
+        bn::sprite_palette_ptr palette = bn::sprite_palette_ptr::create(
+                    bn::sprite_palette_item(colors, bn::bpp_mode::BPP_4));
+        bn::sprite_shape_size shape_size(bn::sprite_shape::SQUARE, bn::sprite_size::NORMAL);
+        bn::sprite_ptr first_sprite = bn::sprite_ptr::create(shape_size, tiles, palette);
+        bn::sprite_ptr second_sprite = bn::sprite_ptr::create(shape_size, tiles, palette);
+
+        bn::sprite_group<3> group(bn::fixed_point(10, 20));
+        BN_ASSERT(group.empty());
+        BN_ASSERT(group.max_size() == 3);
+        BN_ASSERT(group.position() == bn::fixed_point(10, 20));
+
+        group.push_back(first_sprite, bn::fixed_point());
+        group.push_back(second_sprite, bn::fixed_point(8, -4));
+        BN_ASSERT(group.size() == 2);
+        BN_ASSERT(group.sprite(1) == second_sprite);
+        BN_ASSERT(group.local_position(1) == bn::fixed_point(8, -4));
+
+        // Sprites are moved when the group is updated:
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(10, 20));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(18, 16));
+
+        // Only the last position set before the update is propagated:
+        group.set_position(100, 100);
+        group.set_x(-30);
+        group.set_y(40.5);
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(10, 20));
+
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(-30, 40.5));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(-22, 36.5));
+
+        group.set_local_position(0, bn::fixed_point(-2, 3));
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(-32, 43.5));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(-22, 36.5));
+
+        // Visibility and cameras are propagated to all sprites, including the ones added later:
+        bn::camera_ptr camera = bn::camera_ptr::create(0, 0);
+        group.set_visible(false);
+        group.set_camera(camera);
+        BN_ASSERT(! first_sprite.visible());
+        BN_ASSERT(second_sprite.camera() == camera);
+
+        bn::sprite_ptr third_sprite = bn::sprite_ptr::create(shape_size, tiles, palette);
+        group.push_back(third_sprite, bn::fixed_point(0, 16));
+        BN_ASSERT(group.full());
+        BN_ASSERT(! third_sprite.visible());
+        BN_ASSERT(third_sprite.camera() == camera);
+
+        group.set_visible(true);
+        group.remove_camera();
+        BN_ASSERT(third_sprite.visible());
+        BN_ASSERT(! first_sprite.camera());
+
+        // Scaling the group scales the local positions, and all sprites share its affine matrix:
+        group.set_position(0, 0);
+        group.set_scale(2);
+        BN_ASSERT(group.horizontal_scale() == 2);
+        BN_ASSERT(group.vertical_scale() == 2);
+        BN_ASSERT(group.affine_mat());
+        BN_ASSERT(first_sprite.affine_mat() == group.affine_mat());
+        BN_ASSERT(third_sprite.affine_mat() == group.affine_mat());
+
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(-4, 6));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(16, -8));
+        BN_ASSERT(third_sprite.position() == bn::fixed_point(0, 32));
+
+        group.set_scale(1, 0.5);
+        bn::core::update();
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(8, -2));
+        BN_ASSERT(third_sprite.position() == bn::fixed_point(0, 8));
+
+        // Rotating the group rotates the local positions counterclockwise:
+        group.set_scale(1);
+        group.set_rotation_angle(90);
+        BN_ASSERT(group.rotation_angle() == 90);
+
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(3, 2));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(-4, -8));
+        BN_ASSERT(third_sprite.position() == bn::fixed_point(16, 0));
+
+        // Removing the affine matrix restores the local positions:
+        group.remove_affine_mat();
+        BN_ASSERT(! group.affine_mat());
+        BN_ASSERT(! second_sprite.affine_mat());
+        BN_ASSERT(group.rotation_angle() == 0);
+        BN_ASSERT(group.horizontal_scale() == 1);
+
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(-2, 3));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(8, -4));
+        BN_ASSERT(third_sprite.position() == bn::fixed_point(0, 16));
+
+        // Erased sprites are not moved anymore:
+        group.erase(0);
+        BN_ASSERT(group.size() == 2);
+        BN_ASSERT(group.sprite(0) == second_sprite);
+
+        group.set_position(50, 50);
+        bn::core::update();
+        BN_ASSERT(first_sprite.position() == bn::fixed_point(-2, 3));
+        BN_ASSERT(second_sprite.position() == bn::fixed_point(58, 46));
+
+        group.clear();
+        BN_ASSERT(group.empty());
+    }
+};
+
+#endif
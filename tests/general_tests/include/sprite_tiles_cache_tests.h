@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_TILES_CACHE_TESTS_H
+#define SPRITE_TILES_CACHE_TESTS_H
+
+#include "bn_color.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_shape_size.h"
+#include "bn_sprite_palette_ptr.h"
+#include "bn_sprite_tiles_cache.h"
+#include "bn_sprite_palette_item.h"
+#include "bn_sprite_animate_actions.h"
+#include "tests.h"
+
+class sprite_tiles_cache_tests : public tests
+{
+
+public:
+    sprite_tiles_cache_tests() :
+        tests("sprite_tiles_cache")
+    {
+        // The first word of each tile set is its graphics index plus one:
+        static constexpr bn::tile tiles[] = {
+            { { 1 } }, {}, {}, {},
+            { { 2 } }, {}, {}, {},
+            { { 3 } }, {}, {}, {},
+            { { 4 } }, {}, {}, {},
+            { { 5 } }, {}, {}, {},
+            { { 6 } }, {}, {}, {},
+        };
+
+        constexpr bn::sprite_tiles_item tiles_item(tiles, bn::bpp_mode::BPP_4, 6);
+
+        // Slots count is clamped to the number of tile sets:
+        {
+            bn::sprite_tiles_cache<8> cache(tiles_item);
+            BN_ASSERT(cache.slots_count() == 6);
+
+            bn::sprite_tiles_cache<8> other_cache(tiles_item, 3);
+            BN_ASSERT(other_cache.slots_count() == 3);
+        }
+
+        // Hits and misses are counted by tiles and prefetch calls:
+        {
+            bn::sprite_tiles_cache<4> cache(tiles_item, 3);
+            BN_ASSERT(! cache.contains(0));
+            BN_ASSERT(cache.hits() == 0);
+            BN_ASSERT(cache.misses() == 0);
+
+            bn::sprite_tiles_ptr first_tiles = cache.tiles(0);
+            BN_ASSERT(_graphics_index(first_tiles) == 0);
+            BN_ASSERT(cache.contains(0));
+            BN_ASSERT(cache.hits() == 0);
+            BN_ASSERT(cache.misses() == 1);
+
+            BN_ASSERT(cache.tiles(0) == first_tiles);
+            BN_ASSERT(cache.hits() == 1);
+            BN_ASSERT(cache.misses() == 1);
+
+            cache.prefetch(1);
+            BN_ASSERT(cache.contains(1));
+            BN_ASSERT(cache.hits() == 1);
+            BN_ASSERT(cache.misses() == 2);
+
+            cache.prefetch(1);
+            BN_ASSERT(cache.hits() == 2);
+            BN_ASSERT(cache.misses() == 2);
+
+            bn::sprite_tiles_ptr second_tiles = cache.tiles(1);
+            BN_ASSERT(second_tiles != first_tiles);
+            BN_ASSERT(_graphics_index(second_tiles) == 1);
+            BN_ASSERT(cache.hits() == 3);
+            BN_ASSERT(cache.misses() == 2);
+
+            cache.reset_stats();
+            BN_ASSERT(cache.hits() == 0);
+            BN_ASSERT(cache.misses() == 0);
+
+            // Clear marks all slots as empty, but keeps them reserved:
+            cache.clear();
+            BN_ASSERT(! cache.contains(0));
+            BN_ASSERT(! cache.contains(1));
+            BN_ASSERT(cache.slots_count() == 3);
+
+            BN_ASSERT(_graphics_index(cache.tiles(1)) == 1);
+            BN_ASSERT(cache.hits() == 0);
+            BN_ASSERT(cache.misses() == 1);
+        }
+
+        // The least recently used tile set is replaced, except the current and the previous ones:
+        {
+            bn::sprite_tiles_cache<4> cache(tiles_item);
+            BN_ASSERT(cache.slots_count() == 4);
+
+            bn::sprite_tiles_ptr first_tiles = cache.tiles(0);
+            cache.prefetch(1);
+            cache.prefetch(2);
+            cache.prefetch(3);
+            cache.prefetch(1);
+
+            cache.prefetch(4);
+            BN_ASSERT(cache.contains(0));
+            BN_ASSERT(cache.contains(1));
+            BN_ASSERT(! cache.contains(2));
+            BN_ASSERT(cache.contains(3));
+            BN_ASSERT(cache.contains(4));
+
+            cache.prefetch(5);
+            BN_ASSERT(cache.contains(0));
+            BN_ASSERT(! cache.contains(3));
+            BN_ASSERT(cache.contains(5));
+            BN_ASSERT(_graphics_index(first_tiles) == 0);
+
+            bn::sprite_tiles_ptr second_tiles = cache.tiles(1);
+            cache.prefetch(2);
+            BN_ASSERT(cache.contains(0));
+            BN_ASSERT(cache.contains(1));
+            BN_ASSERT(cache.contains(2));
+            BN_ASSERT(! cache.contains(4));
+            BN_ASSERT(_graphics_index(first_tiles) == 0);
+            BN_ASSERT(_graphics_index(second_tiles) == 1);
+        }
+
+        // The previous tile set is replaced if there's no other slot available:
+        {
+            bn::sprite_tiles_cache<2> cache(tiles_item);
+            bn::sprite_tiles_ptr first_tiles = cache.tiles(0);
+            bn::sprite_tiles_ptr second_tiles = cache.tiles(1);
+
+            BN_ASSERT(cache.tiles(2) == first_tiles);
+            BN_ASSERT(! cache.contains(0));
+            BN_ASSERT(cache.contains(1));
+            BN_ASSERT(_graphics_index(first_tiles) == 2);
+            BN_ASSERT(_graphics_index(second_tiles) == 1);
+        }
+
+        // Streamed animate actions take each tile set from the cache and prefetch the next one:
+        {
+            static constexpr bn::color colors[16] = {};
+            static constexpr uint16_t graphics_indexes[] = { 0, 1, 1, 2 };
+
+            bn::sprite_tiles_cache<3> cache(tiles_item);
+            bn::sprite_ptr sprite = bn::sprite_ptr::create(
+                        bn::sprite_shape_size(bn::sprite_shape::SQUARE, bn::sprite_size::NORMAL), cache.tiles(0),
+                        bn::sprite_palette_ptr::create(bn::sprite_palette_item(colors, bn::bpp_mode::BPP_4)));
+            bn::sprite_streamed_animate_action<4> action = bn::sprite_streamed_animate_action<4>::once(
+                        sprite, 1, cache, graphics_indexes);
+            BN_ASSERT(cache.misses() == 1);
+
+            action.update();
+            BN_ASSERT(action.current_index() == 1);
+            BN_ASSERT(action.next_change_updates() == 1);
+            BN_ASSERT(_graphics_index(sprite.tiles()) == 0);
+            BN_ASSERT(cache.contains(1));
+            BN_ASSERT(cache.misses() == 2);
+
+            action.update();
+            BN_ASSERT(action.current_index() == 1);
+            BN_ASSERT(_graphics_index(sprite.tiles()) == 0);
+
+            action.update();
+            BN_ASSERT(action.current_index() == 2);
+            BN_ASSERT(_graphics_index(sprite.tiles()) == 1);
+            BN_ASSERT(! cache.contains(2));
+            BN_ASSERT(cache.misses() == 2);
+
+            action.update();
+            action.update();
+            BN_ASSERT(action.current_index() == 3);
+            BN_ASSERT(_graphics_index(sprite.tiles()) == 1);
+            BN_ASSERT(cache.contains(2));
+            BN_ASSERT(cache.misses() == 3);
+
+            action.update();
+            action.update();
+            BN_ASSERT(action.done());
+            BN_ASSERT(_graphics_index(sprite.tiles()) == 2);
+            BN_ASSERT(cache.hits() == 3);
+            BN_ASSERT(cache.misses() == 3);
+        }
+    }
+
+private:
+    [[nodiscard]] static int _graphics_index(bn::sprite_tiles_ptr tiles)
+    {
+        return int((*tiles.vram())[0].data[0]) - 1;
+    }
+};
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_TILES_DELTA_TESTS_H
+#define SPRITE_TILES_DELTA_TESTS_H
+
+#include "bn_core.h"
+#include "bn_color.h"
+#include "bn_sprite_ptr.h"
+#include "bn_commit_phase.h"
+#include "bn_sprite_shape_size.h"
+#include "bn_sprite_palette_ptr.h"
+#include "bn_sprite_palette_item.h"
+#include "bn_sprite_tiles_delta_item.h"
+#include "bn_sprite_animate_actions.h"
+#include "tests.h"
+
+#include "../../butano/src/bn_sprite_tiles_manager.h"
+#include "../../butano/hw/include/bn_hw_sprite_tiles.h"
+
+class sprite_tiles_delta_tests : public tests
+{
+
+public:
+    sprite_tiles_delta_tests() :
+        tests("sprite_tiles_delta")
+    {
+        // Three tile sets of four tiles each. The first word of each tile identifies it:
+        static constexpr bn::tile tiles[] = {
+            { { 1 } }, { { 2 } }, { { 3 } }, { { 4 } },
+            { { 1 } }, { { 5 } }, { { 3 } }, { { 6 } },
+            { { 1 } }, { { 5 } }, { { 7 } }, { { 8 } },
+        };
+
+        // Changed tiles of each tile set with respect to the previous one (the last one for the first tile set):
+        static constexpr uint16_t delta[] = {
+            0, 3, 5, 7,
+            1, 2, 3,
+            1, 3,
+            2, 3,
+        };
+
+        constexpr int tile_bytes = int(sizeof(bn::tile));
+        constexpr bn::sprite_tiles_item tiles_item(tiles, bn::bpp_mode::BPP_4, 3);
+        constexpr bn::sprite_tiles_delta_item tiles_delta_item(tiles_item, delta);
+        BN_ASSERT(tiles_delta_item.previous_graphics_index(0) == 2);
+        BN_ASSERT(tiles_delta_item.previous_graphics_index(2) == 1);
+        BN_ASSERT(tiles_delta_item.changed_tiles(0).size() == 3);
+        BN_ASSERT(tiles_delta_item.changed_tiles(1)[1] == 3);
+
+        static constexpr bn::color colors[16] = {};
+        bn::sprite_ptr sprite = bn::sprite_ptr::create(
+                    bn::sprite_shape_size(bn::sprite_shape::SQUARE, bn::sprite_size::NORMAL),
+                    tiles_item.create_tiles(0),
+                    bn::sprite_palette_ptr::create(bn::sprite_palette_item(colors, bn::bpp_mode::BPP_4)));
+        bn::core::update();
+        BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 4 * tile_bytes);
+        _check_vram(sprite, tiles_item, 0);
+
+        // Only the changed tiles are uploaded, and the tiles are replaced in place:
+        int tiles_id = sprite.tiles().id();
+        sprite.set_tiles(tiles_delta_item, 1);
+        BN_ASSERT(sprite.tiles().id() == tiles_id);
+
+        bn::core::update();
+        BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 2 * tile_bytes);
+        _check_vram(sprite, tiles_item, 1);
+
+        sprite.set_tiles(tiles_delta_item, 2);
+        bn::core::update();
+        BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 2 * tile_bytes);
+        _check_vram(sprite, tiles_item, 2);
+
+        sprite.set_tiles(tiles_delta_item, 0);
+        bn::core::update();
+        BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 3 * tile_bytes);
+        _check_vram(sprite, tiles_item, 0);
+
+        // Consecutive deltas in the same frame upload all tiles:
+        sprite.set_tiles(tiles_delta_item, 1);
+        sprite.set_tiles(tiles_delta_item, 2);
+        BN_ASSERT(sprite.tiles().id() == tiles_id);
+
+        bn::core::update();
+        BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 4 * tile_bytes);
+        _check_vram(sprite, tiles_item, 2);
+
+        // Tile sets which don't follow the current one are fully uploaded:
+        sprite.set_tiles(tiles_delta_item, 1);
+        bn::core::update();
+        BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 4 * tile_bytes);
+        _check_vram(sprite, tiles_item, 1);
+
+        // Delta animate actions upload only the changed tiles of each tile set, also when they loop:
+        {
+            static constexpr uint16_t graphics_indexes[] = { 1, 2, 0 };
+
+            bn::sprite_delta_animate_action<3> action = bn::sprite_delta_animate_action<3>::forever(
+                        sprite, 0, tiles_delta_item, graphics_indexes);
+            action.update();
+            bn::core::update();
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 0);
+            _check_vram(sprite, tiles_item, 1);
+
+            action.update();
+            bn::core::update();
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 2 * tile_bytes);
+            _check_vram(sprite, tiles_item, 2);
+
+            action.update();
+            bn::core::update();
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 3 * tile_bytes);
+            _check_vram(sprite, tiles_item, 0);
+
+            action.update();
+            BN_ASSERT(action.current_index() == 1);
+
+            bn::core::update();
+            BN_ASSERT(bn::core::last_commit_bytes(bn::commit_phase::SPRITE_TILES) == 2 * tile_bytes);
+            _check_vram(sprite, tiles_item, 1);
+        }
+    }
+
+private:
+    static void _check_vram(const bn::sprite_ptr& sprite, const bn::sprite_tiles_item& tiles_item,
+                            int graphics_index)
+    {
+        int start_tile = bn::sprite_tiles_manager::start_tile(sprite.tiles().id());
+        const bn::tile* vram_tiles = bn::hw::sprite_tiles::vram(start_tile);
+        bn::span<const bn::tile> frame_tiles = tiles_item.graphics_tiles_ref(graphics_index);
+
+        for(int index = 0, limit = frame_tiles.size(); index < limit; ++index)
+        {
+            for(int word_index = 0; word_index < 8; ++word_index)
+            {
+                BN_ASSERT(vram_tiles[index].data[word_index] == frame_tiles[index].data[word_index],
+                          graphics_index, " - ", index, " - ", word_index);
+            }
+        }
+    }
+};
+
+#endif
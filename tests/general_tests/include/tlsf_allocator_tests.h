@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef TLSF_ALLOCATOR_TESTS_H
+#define TLSF_ALLOCATOR_TESTS_H
+
+#include "bn_vector.h"
+#include "bn_tlsf_allocator.h"
+#include "tests.h"
+
+class tlsf_allocator_tests : public tests
+{
+
+public:
+    tlsf_allocator_tests() :
+        tests("tlsf_allocator")
+    {
+        constexpr int buffer_size = 512;
+        alignas(int) uint8_t buffer[buffer_size];
+        bn::tlsf_allocator allocator(buffer, buffer_size);
+        BN_ASSERT(allocator.empty());
+        BN_ASSERT(allocator.used_bytes() == 0);
+        BN_ASSERT(allocator.available_bytes() == buffer_size);
+
+        // Alloc and free:
+        void* ptr = allocator.alloc(0);
+        BN_ASSERT(ptr);
+        BN_ASSERT(allocator.used_bytes() == 16);
+
+        allocator.free(ptr);
+        BN_ASSERT(allocator.empty());
+
+        ptr = allocator.alloc(4);
+        BN_ASSERT(ptr);
+        BN_ASSERT(allocator.used_bytes() == 16);
+
+        allocator.free(ptr);
+        BN_ASSERT(allocator.empty());
+
+        ptr = allocator.alloc(12);
+        BN_ASSERT(ptr);
+        BN_ASSERT(allocator.used_bytes() == 20);
+
+        allocator.free(ptr);
+        BN_ASSERT(allocator.empty());
+
+        allocator.free(nullptr);
+        BN_ASSERT(allocator.empty());
+
+        // Freed items are reused:
+        void* first_ptr = allocator.alloc(8);
+        void* second_ptr = allocator.alloc(100);
+        void* third_ptr = allocator.alloc(8);
+        BN_ASSERT(first_ptr && second_ptr && third_ptr);
+        BN_ASSERT(allocator.used_bytes() == 16 + 108 + 16);
+
+        allocator.free(second_ptr);
+        BN_ASSERT(allocator.used_bytes() == 16 + 16);
+
+        void* fourth_ptr = allocator.alloc(100);
+        BN_ASSERT(fourth_ptr == second_ptr);
+        BN_ASSERT(allocator.used_bytes() == 16 + 108 + 16);
+
+        // Free items are coalesced with both neighbours:
+        allocator.free(fourth_ptr);
+        allocator.free(first_ptr);
+        allocator.free(third_ptr);
+        BN_ASSERT(allocator.empty());
+        BN_ASSERT(allocator.available_bytes() == buffer_size);
+
+        ptr = allocator.alloc(buffer_size - 8);
+        BN_ASSERT(ptr);
+        BN_ASSERT(allocator.full());
+
+        allocator.free(ptr);
+        BN_ASSERT(allocator.empty());
+
+        // Calloc:
+        auto int_ptr = static_cast<int*>(allocator.alloc(16));
+        BN_ASSERT(int_ptr);
+
+        for(int index = 0; index < 4; ++index)
+        {
+            int_ptr[index] = index + 1;
+        }
+
+        allocator.free(int_ptr);
+
+        int_ptr = static_cast<int*>(allocator.calloc(4, 4));
+        BN_ASSERT(int_ptr);
+
+        for(int index = 0; index < 4; ++index)
+        {
+            BN_ASSERT(int_ptr[index] == 0);
+        }
+
+        // Realloc:
+        for(int index = 0; index < 4; ++index)
+        {
+            int_ptr[index] = index + 1;
+        }
+
+        BN_ASSERT(allocator.realloc(int_ptr, 16) == int_ptr);
+
+        int_ptr = static_cast<int*>(allocator.realloc(int_ptr, 64));
+        BN_ASSERT(int_ptr);
+        BN_ASSERT(allocator.used_bytes() == 72);
+
+        for(int index = 0; index < 4; ++index)
+        {
+            BN_ASSERT(int_ptr[index] == index + 1);
+        }
+
+        int_ptr = static_cast<int*>(allocator.realloc(int_ptr, 8));
+        BN_ASSERT(int_ptr);
+        BN_ASSERT(allocator.used_bytes() == 16);
+        BN_ASSERT(int_ptr[0] == 1);
+        BN_ASSERT(int_ptr[1] == 2);
+
+        BN_ASSERT(! allocator.realloc(int_ptr, buffer_size));
+        BN_ASSERT(allocator.used_bytes() == 16);
+
+        allocator.free(int_ptr);
+        BN_ASSERT(allocator.empty());
+
+        ptr = allocator.realloc(nullptr, 4);
+        BN_ASSERT(ptr);
+        BN_ASSERT(allocator.used_bytes() == 16);
+
+        allocator.free(ptr);
+        BN_ASSERT(allocator.empty());
+
+        // Exhaustion:
+        BN_ASSERT(! allocator.alloc(buffer_size));
+        BN_ASSERT(allocator.empty());
+
+        bn::vector<void*, buffer_size / 16> ptrs;
+
+        while(void* new_ptr = allocator.alloc(4))
+        {
+            BN_ASSERT(! ptrs.full());
+            ptrs.push_back(new_ptr);
+        }
+
+        BN_ASSERT(ptrs.full());
+        BN_ASSERT(allocator.full());
+        BN_ASSERT(allocator.available_bytes() == 0);
+        BN_ASSERT(! allocator.alloc(0));
+
+        for(int index = 0, limit = ptrs.size(); index < limit; index += 2)
+        {
+            allocator.free(ptrs[index]);
+        }
+
+        BN_ASSERT(allocator.available_bytes() == buffer_size / 2);
+        BN_ASSERT(! allocator.alloc(16));
+
+        for(int index = 1, limit = ptrs.size(); index < limit; index += 2)
+        {
+            allocator.free(ptrs[index]);
+        }
+
+        BN_ASSERT(allocator.empty());
+        BN_ASSERT(allocator.alloc(buffer_size - 8) == ptrs.front());
+        allocator.free(ptrs.front());
+        BN_ASSERT(allocator.empty());
+    }
+};
+
+#endif
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2020-2025 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "iwram_overlays_tests.h"
+
+int iwram_overlay_0_function(int a, int b)
+{
+    return (a * b) + 1;
+}
+
+int iwram_overlay_1_function(int a, int b)
+{
+    return a - b;
+}
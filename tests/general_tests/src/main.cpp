@@ -22,6 +22,21 @@
 #include "format_tests.h"
 #include "memory_tests.h"
 #include "sram_tests.h"
+#include "collision_grid_tests.h"
+#include "cameras_tests.h"
+#include "frame_arena_tests.h"
+#include "items_registry_tests.h"
+#include "sprite_affine_mats_tests.h"
+#include "bg_map_double_buffers_tests.h"
+#include "iwram_overlays_tests.h"
+#include "tlsf_allocator_tests.h"
+#include "commit_budget_tests.h"
+#include "sprite_tiles_cache_tests.h"
+#include "particle_system_tests.h"
+#include "regular_bg_collision_item_tests.h"
+#include "sprite_tiles_delta_tests.h"
+#include "sprite_group_tests.h"
+#include "palette_group_tests.h"
 
 #if ! BN_CFG_ASSERT_ENABLED
     static_assert(false, "Enable asserts in bn_config_assert.h to run tests");
@@ -48,6 +63,21 @@ int main()
     optional_tests();
     any_tests();
     format_tests();
+    collision_grid_tests();
+    cameras_tests();
+    frame_arena_tests();
+    items_registry_tests();
+    sprite_affine_mats_tests();
+    bg_map_double_buffers_tests();
+    iwram_overlays_tests();
+    tlsf_allocator_tests();
+    commit_budget_tests();
+    sprite_tiles_cache_tests();
+    particle_system_tests();
+    regular_bg_collision_item_tests();
+    sprite_tiles_delta_tests();
+    sprite_group_tests();
+    palette_group_tests();
     memory_tests memory_tests(used_stack_iwram);
     sram_tests sram_tests;
 
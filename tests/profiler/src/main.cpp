@@ -7,12 +7,17 @@
 #include "bn_core.h"
 #include "bn_limits.h"
 #include "bn_random.h"
+#include "bn_sstream.h"
+#include "bn_format_to.h"
 #include "bn_profiler.h"
 #include "bn_unique_ptr.h"
 #include "bn_seed_random.h"
+#include "bn_collision_grid.h"
+#include "bn_tlsf_allocator.h"
 #include "bn_best_fit_allocator.h"
 
 #include "../../butano/hw/include/bn_hw_dma.h"
+#include "../../butano/hw/include/bn_hw_text.h"
 #include "../../butano/hw/include/bn_hw_memory.h"
 #include "../../butano/hw/include/bn_hw_decompress.h"
 
@@ -558,6 +563,210 @@ void huff_decomp_test()
     BN_PROFILER_STOP();
 }
 
+template<int Count>
+void collision_test(const char* brute_force_id, const char* grid_id, int& integer)
+{
+    bn::unique_ptr<bn::array<bn::fixed_rect, Count>> rects_ptr(new bn::array<bn::fixed_rect, Count>());
+    bn::array<bn::fixed_rect, Count>& rects = *rects_ptr;
+    bn::random random;
+
+    for(bn::fixed_rect& rect : rects)
+    {
+        rect = bn::fixed_rect(random.get_fixed(-256, 256), random.get_fixed(-256, 256),
+                              random.get_fixed(4, 24), random.get_fixed(4, 24));
+    }
+
+    int brute_force_pairs = 0;
+    BN_PROFILER_START(brute_force_id);
+
+    for(int index = 0; index < Count; ++index)
+    {
+        const bn::fixed_rect& rect = rects[index];
+
+        for(int other_index = index + 1; other_index < Count; ++other_index)
+        {
+            if(rect.intersects(rects[other_index]))
+            {
+                ++brute_force_pairs;
+            }
+        }
+    }
+
+    BN_PROFILER_STOP();
+
+    using grid_type = bn::collision_grid<Count, 32>;
+    bn::unique_ptr<grid_type> grid_ptr(new grid_type());
+    grid_type& grid = *grid_ptr;
+
+    for(const bn::fixed_rect& rect : rects)
+    {
+        grid.insert(rect);
+    }
+
+    int grid_pairs = 0;
+    BN_PROFILER_START(grid_id);
+
+    grid.for_each_pair([&grid_pairs](int, int)
+    {
+        ++grid_pairs;
+    });
+
+    BN_PROFILER_STOP();
+
+    BN_ASSERT(brute_force_pairs == grid_pairs, "Invalid collision pairs: ", brute_force_pairs, " - ", grid_pairs);
+    integer += grid_pairs;
+}
+
+void collision_test(int& integer)
+{
+    collision_test<50>("collision_brute_force_50", "collision_grid_50", integer);
+    collision_test<200>("collision_brute_force_200", "collision_grid_200", integer);
+    collision_test<500>("collision_brute_force_500", "collision_grid_500", integer);
+}
+
+constexpr int allocator_buffer_bytes = 64 * 1024;
+constexpr int allocator_slots = 128;
+constexpr int allocator_operations = 4096;
+
+template<typename Allocator>
+void allocator_test(const char* id, int& integer)
+{
+    bn::unique_ptr<bn::array<uint8_t, allocator_buffer_bytes>> buffer_ptr(
+                new bn::array<uint8_t, allocator_buffer_bytes>());
+    bn::unique_ptr<bn::array<int, allocator_operations>> sizes_ptr(new bn::array<int, allocator_operations>());
+    bn::array<int, allocator_operations>& sizes = *sizes_ptr;
+
+    bn::array<uint8_t, allocator_operations> slots;
+    bn::random random;
+
+    for(int index = 0; index < allocator_operations; ++index)
+    {
+        // Mostly small allocations with a few big ones, to fragment the buffer:
+        sizes[index] = random.get_int(8) ? random.get_int(4, 128) : random.get_int(256, 2048);
+        slots[index] = uint8_t(random.get_int(allocator_slots));
+    }
+
+    Allocator allocator(buffer_ptr->data(), allocator_buffer_bytes);
+    bn::array<void*, allocator_slots> ptrs = {};
+    int failed_allocations = 0;
+    BN_PROFILER_START(id);
+
+    for(int index = 0; index < allocator_operations; ++index)
+    {
+        void*& ptr = ptrs[slots[index]];
+
+        if(ptr)
+        {
+            allocator.free(ptr);
+            ptr = nullptr;
+        }
+        else
+        {
+            ptr = allocator.alloc(sizes[index]);
+            failed_allocations += ! ptr;
+        }
+    }
+
+    for(void* ptr : ptrs)
+    {
+        allocator.free(ptr);
+    }
+
+    BN_PROFILER_STOP();
+
+    integer += failed_allocations;
+}
+
+void allocator_test(int& integer)
+{
+    allocator_test<bn::best_fit_allocator>("alloc_best_fit", integer);
+    allocator_test<bn::tlsf_allocator>("alloc_tlsf", integer);
+}
+
+template<typename Type>
+void format_test(const char* posprintf_id, const char* sstream_id, const char* format_to_id, Type seed,
+                 int& integer)
+{
+    bn::array<char, 32> buffer;
+    int posprintf_size = 0;
+    int sstream_size = 0;
+    int format_to_size = 0;
+
+    if(posprintf_id)
+    {
+        BN_PROFILER_START(posprintf_id);
+
+        for(int i = 0; i < its; ++i)
+        {
+            posprintf_size += bn::hw::text::parse(Type(seed * i), buffer);
+        }
+
+        BN_PROFILER_STOP();
+    }
+
+    BN_PROFILER_START(sstream_id);
+
+    for(int i = 0; i < its; ++i)
+    {
+        bn::string<32> string;
+        bn::ostringstream stream(string);
+        stream << Type(seed * i);
+        sstream_size += string.size();
+    }
+
+    BN_PROFILER_STOP();
+
+    BN_PROFILER_START(format_to_id);
+
+    for(int i = 0; i < its; ++i)
+    {
+        format_to_size += bn::format_to(buffer, Type(seed * i));
+    }
+
+    BN_PROFILER_STOP();
+
+    BN_ASSERT(! posprintf_id || posprintf_size == format_to_size,
+              "Invalid posprintf size: ", posprintf_size, " - ", format_to_size);
+    BN_ASSERT(sstream_size == format_to_size, "Invalid sstream size: ", sstream_size, " - ", format_to_size);
+    integer += format_to_size;
+}
+
+void format_test(int& integer)
+{
+    format_test<int>("format_int_posprintf", "format_int_sstream", "format_int_to", -21474, integer);
+    format_test<int64_t>("format_int64_posprintf", "format_int64_sstream", "format_int64_to",
+                         -922337203685477LL, integer);
+
+    bn::array<char, 32> buffer;
+    int sstream_size = 0;
+    int format_to_size = 0;
+
+    BN_PROFILER_START("format_fixed_sstream");
+
+    for(int i = 0; i < its; ++i)
+    {
+        bn::string<32> string;
+        bn::ostringstream stream(string);
+        stream.set_precision(6);
+        stream << bn::fixed::from_data(i * -12345);
+        sstream_size += string.size();
+    }
+
+    BN_PROFILER_STOP();
+
+    BN_PROFILER_START("format_fixed_to");
+
+    for(int i = 0; i < its; ++i)
+    {
+        format_to_size += bn::format_to(buffer, bn::fixed::from_data(i * -12345), 2);
+    }
+
+    BN_PROFILER_STOP();
+
+    integer += sstream_size;
+    integer += format_to_size;
+}
+
 }
 
 int main()
@@ -575,6 +784,9 @@ int main()
     rl_decomp_test();
     lz77_decomp_test();
     huff_decomp_test();
+    collision_test(integer);
+    allocator_test(integer);
+    format_test(integer);
 
     if(integer)
     {